@@ -0,0 +1,32 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/front.hpp>
+#include <Lz/cached_begin.hpp>
+#include <Lz/filter.hpp>
+#include <iostream>
+#include <vector>
+
+int main() {
+    std::vector<int> vec = { 1, 3, 5, 7, 9, 10, 11, 12 };
+    int predicate_calls = 0;
+    auto filtered = vec | lz::filter([&predicate_calls](int i) {
+                        ++predicate_calls;
+                        return i % 2 == 0;
+                    });
+
+    // lz::filter searches for its first element every time begin() is called
+    static_cast<void>(lz::empty(filtered));
+    static_cast<void>(lz::front(filtered));
+    std::cout << "Predicate calls without cache: " << predicate_calls << '\n'; // 18
+    predicate_calls = 0;
+
+    // lz::cache_begin only searches once, the first time begin() is called
+    auto cached = filtered | lz::cache_begin;
+    static_cast<void>(lz::empty(cached));
+    static_cast<void>(lz::front(cached));
+    std::cout << "Predicate calls with cache: " << predicate_calls << '\n'; // 6
+
+    for (int i : cached) {
+        std::cout << i << ' ';
+    }
+    // Output: 10 12
+}
@@ -0,0 +1,35 @@
+#include <Lz/algorithm/for_each.hpp>
+#include <Lz/channel.hpp>
+#include <Lz/filter.hpp>
+#include <iostream>
+#include <thread>
+
+int main() {
+    // A channel that holds at most 64 elements. Consumers take at most 8 elements at once
+    lz::channel<int> channel(64, 8);
+
+    std::thread producer([&channel]() {
+        for (int i = 0; i < 10; ++i) {
+            channel.push(i);
+        }
+        // The iteration ends once the channel is closed and all elements are consumed
+        channel.close();
+    });
+
+    auto evens = channel | lz::filter([](int i) { return i % 2 == 0; });
+
+#ifdef LZ_HAS_CXX_17
+    for (int i : evens) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    }
+#else
+    lz::for_each(evens, [](int i) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    });
+#endif
+    // Output: 0 2 4 6 8
+
+    producer.join();
+}
@@ -0,0 +1,27 @@
+#include <Lz/concatenate_dynamic.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main() {
+    // For instance, buffers that were received over the network
+    std::vector<std::string> buffers = { "GET /ind", "", "ex.html", " HTTP/1.1" };
+    auto stream = buffers | lz::concat_dynamic;
+
+    std::cout << "Size: " << stream.size() << '\n'; // 24, O(1)
+
+    // Random access in O(log n), where n is the number of buffers
+    auto begin = stream.begin();
+    std::cout << begin[4] << begin[10] << '\n';
+    // Output: /.
+
+    // Process the buffers one by one
+    for (std::size_t i = 0; i < stream.segment_count(); ++i) {
+        for (char c : stream.segment(i)) {
+            std::cout << c;
+        }
+        std::cout << '|';
+    }
+    // Output: GET /ind|ex.html| HTTP/1.1|
+    std::cout << '\n';
+}
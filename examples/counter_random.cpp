@@ -0,0 +1,29 @@
+#include <Lz/procs/to.hpp>
+#include <Lz/random.hpp>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main() {
+    // The i-th number only depends on the seed (42) and i
+    const auto random = lz::counter_random(0, 10, 42, 5);
+
+    for (auto it = random.begin(); it != random.end(); ++it) {
+        std::cout << *it << ' ';
+        // Or use fmt::print("{} ", *it);
+    }
+    std::cout << '\n';
+    // Output: the same 5 numbers between [0, 10] every run
+
+    // Accessing the numbers in any order gives the same numbers
+    std::cout << random.begin()[4] << ' ' << random.begin()[0] << '\n';
+    // Output: the last and first number of the line above
+
+    // Converting using multiple threads gives the same result as converting sequentially
+    std::normal_distribution<double> dist(0., 1.);
+    const auto normal = lz::counter_random(dist, 7, 100000);
+    const auto sequential = normal | lz::to<std::vector>();
+    const auto parallel = normal | lz::to<std::vector>(lz::par);
+    std::cout << std::boolalpha << (sequential == parallel) << '\n';
+    // Output: true
+}
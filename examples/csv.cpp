@@ -0,0 +1,38 @@
+#include <Lz/csv.hpp>
+#include <iostream>
+#include <string>
+
+int main() {
+    std::string buffer = "name,quote\n"
+                         "Ada,\"Hello, \"\"world\"\"\"\n"
+                         "Grace,\"multi\nline\"\n";
+
+    // The fields refer to buffer, only fields with escaped quotes ("") are copied
+    auto records = buffer | lz::csv;
+    std::cout << "Records: " << records.size() << '\n';
+    // Output: Records: 3
+
+    for (auto it = records.begin(); it != records.end(); ++it) {
+        const lz::csv_record record = *it;
+        for (auto field = record.begin(); field != record.end(); ++field) {
+            const lz::csv_field value = *field;
+            const lz::string_view view = value.value();
+            std::cout << '[';
+            std::cout.write(view.data(), static_cast<std::streamsize>(view.size()));
+            std::cout << "] ";
+            // Or use fmt::print("[{}] ", view);
+        }
+        std::cout << '\n';
+    }
+    // Output:
+    // [name] [quote]
+    // [Ada] [Hello, "world"]
+    // [Grace] [multi
+    // line]
+
+    // Tab separated values
+    std::string tsv = "a\tb\nc\td\n";
+    auto tsv_records = tsv | lz::csv(lz::csv_options{ '\t' });
+    std::cout << tsv_records.begin()[1][0].str() << '\n';
+    // Output: c
+}
@@ -0,0 +1,59 @@
+#include <Lz/detail/compiler_config.hpp>
+
+#ifdef LZ_HAS_COROUTINES
+
+#include <Lz/algorithm/for_each.hpp>
+#include <Lz/generator.hpp>
+#include <Lz/take_while.hpp>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+namespace {
+lz::generator<int> fibonacci() {
+    int a = 0, b = 1;
+    while (true) {
+        co_yield a;
+        a = std::exchange(b, a + b);
+    }
+}
+
+struct node {
+    int value;
+    std::unique_ptr<node> left;
+    std::unique_ptr<node> right;
+};
+
+// In order traversal, without hand rolled stack
+lz::generator<int> walk(const node* n) {
+    if (n == nullptr) {
+        co_return;
+    }
+    co_yield lz::elements_of(walk(n->left.get()));
+    co_yield n->value;
+    co_yield lz::elements_of(walk(n->right.get()));
+}
+} // namespace
+
+int main() {
+    for (int i : fibonacci() | lz::take_while([](int i) { return i < 50; })) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    }
+    // Output: 0 1 1 2 3 5 8 13 21 34
+    std::cout << '\n';
+
+    node root{ 2, std::make_unique<node>(node{ 1, nullptr, nullptr }), std::make_unique<node>(node{ 3, nullptr, nullptr }) };
+    for (int i : walk(&root)) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    }
+    // Output: 1 2 3
+}
+
+#else
+
+int main() {
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include <Lz/algorithm/for_each.hpp>
+#include <Lz/group_by_hashed.hpp>
+#include <iostream>
+#include <vector>
+
+struct order {
+    int customer;
+    double amount;
+};
+
+int main() {
+    // Does not need to be sorted, as opposed to lz::group_by
+    std::vector<order> orders = { { 3, 1.5 }, { 1, 10.0 }, { 2, 5.0 }, { 1, 2.5 }, { 3, 0.5 } };
+
+    auto totals = lz::group_by_hashed(
+        orders, [](const order& o) { return o.customer; }, [](double acc, const order& o) { return acc + o.amount; }, 0.0);
+
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    // The initial aggregate defaults to a value initialized value_type of the input iterable
+    auto sums = vec | lz::group_by_hashed([](int i) { return i % 2; }, std::plus<int>{});
+
+#ifdef LZ_HAS_CXX_17
+    for (auto&& pair : totals) {
+        std::cout << "Customer " << pair.first << " spent " << pair.second << '\n';
+        // Or use fmt::print("Customer {} spent {}\n", pair.first, pair.second);
+    }
+    /* Output:
+    Customer 3 spent 2
+    Customer 1 spent 12.5
+    Customer 2 spent 5
+    */
+
+    std::cout << '\n';
+
+    for (auto&& pair : sums) {
+        std::cout << "Remainder " << pair.first << " sum " << pair.second << '\n';
+        // Or use fmt::print("Remainder {} sum {}\n", pair.first, pair.second);
+    }
+    /* Output:
+    Remainder 1 sum 9
+    Remainder 0 sum 6
+    */
+#else
+    lz::for_each(totals, [](const std::pair<int, double>& pair) {
+        std::cout << "Customer " << pair.first << " spent " << pair.second << '\n';
+        // Or use fmt::print("Customer {} spent {}\n", pair.first, pair.second);
+    });
+    /* Output:
+    Customer 3 spent 2
+    Customer 1 spent 12.5
+    Customer 2 spent 5
+    */
+
+    std::cout << '\n';
+
+    lz::for_each(sums, [](const std::pair<int, int>& pair) {
+        std::cout << "Remainder " << pair.first << " sum " << pair.second << '\n';
+        // Or use fmt::print("Remainder {} sum {}\n", pair.first, pair.second);
+    });
+    /* Output:
+    Remainder 1 sum 9
+    Remainder 0 sum 6
+    */
+#endif
+}
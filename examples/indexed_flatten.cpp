@@ -0,0 +1,22 @@
+#include <Lz/indexed_flatten.hpp>
+#include <iostream>
+#include <vector>
+
+int main() {
+    std::vector<std::vector<int>> jagged = { { 1, 2, 3 }, {}, { 4, 5 }, { 6 } };
+    auto flattened = jagged | lz::indexed_flatten;
+
+    std::cout << "Size: " << flattened.size() << '\n'; // 6, O(1)
+
+    // Random access in O(log n), where n is the number of inner vectors
+    auto begin = flattened.begin();
+    std::cout << begin[0] << ' ' << begin[3] << ' ' << begin[5] << '\n';
+    // Output: 1 4 6
+
+    for (auto it = flattened.end(); it != flattened.begin();) {
+        --it;
+        std::cout << *it << ' ';
+    }
+    // Output: 6 5 4 3 2 1
+    std::cout << '\n';
+}
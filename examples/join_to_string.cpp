@@ -0,0 +1,29 @@
+#include <Lz/join_to_string.hpp>
+#include <Lz/split.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main() {
+    std::vector<std::string> words = { "hello", "big", "world" };
+
+    std::string joined = lz::join_to_string(words, ", ");
+    std::cout << joined << '\n';
+    // Output: hello, big, world
+
+    // Appending to an existing string. The exact length is calculated first, so the string is allocated at most once
+    std::string sentence = "words: ";
+    lz::join_to(words, sentence, " ");
+    std::cout << sentence << '\n';
+    // Output: words: hello big world
+
+    std::string path = "usr/local/bin";
+    std::cout << (path | lz::sv_split('/') | lz::join_to_string("\\")) << '\n';
+    // Output: usr\local\bin
+
+    // Writing to a buffer that is large enough
+    char buffer[32];
+    char* end = lz::join_to(words, buffer, "-");
+    std::cout.write(buffer, end - buffer) << '\n';
+    // Output: hello-big-world
+}
@@ -0,0 +1,29 @@
+#include <Lz/memoize_map.hpp>
+#include <Lz/pairwise.hpp>
+#include <iostream>
+#include <vector>
+
+int main() {
+    std::vector<int> vec = { 1, 2, 3, 4 };
+    int calls = 0;
+    // Pretend this function is expensive
+    auto memoized = vec | lz::memoize_map([&calls](int i) {
+                        ++calls;
+                        return i * i;
+                    });
+
+    // lz::pairwise dereferences every element (except the first and last) twice. With lz::map, the function would be called 6
+    // times, with lz::memoize_map, the function is called once per element
+    for (auto&& pair : memoized | lz::pairwise(2)) {
+        for (int i : pair) {
+            std::cout << i << ' ';
+        }
+        std::cout << '\n';
+    }
+    // Output:
+    // 1 4
+    // 4 9
+    // 9 16
+
+    std::cout << "Function calls: " << calls << '\n'; // 4
+}
@@ -0,0 +1,44 @@
+#include <Lz/algorithm/for_each.hpp>
+#include <Lz/parallel_map.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main() {
+    std::vector<std::string> lines = { "1", "22", "333", "4444" };
+
+    // Parses the lines on 2 threads, with at most 4 lines in flight. The results are in input order
+    auto parsed = lz::parallel_map(lines, [](const std::string& s) { return std::stoi(s); }, 2, 4);
+    // Or use the unordered version if the order doesn't matter. This way, a slow element doesn't hold back the others
+    auto unordered = lines | lz::unordered_parallel_map([](const std::string& s) { return std::stoi(s); });
+
+#ifdef LZ_HAS_CXX_17
+    for (int i : parsed) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    }
+    // Output: 1 22 333 4444
+
+    std::cout << '\n';
+
+    for (int i : unordered) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    }
+    // Output: 1 22 333 4444 (in any order)
+#else
+    lz::for_each(parsed, [](int i) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    });
+    // Output: 1 22 333 4444
+
+    std::cout << '\n';
+
+    lz::for_each(unordered, [](int i) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    });
+    // Output: 1 22 333 4444 (in any order)
+#endif
+}
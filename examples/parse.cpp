@@ -0,0 +1,47 @@
+#include <Lz/algorithm/for_each.hpp>
+#include <Lz/parse.hpp>
+#include <Lz/split.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+int main() {
+    std::string numbers = "12,-7,abc,300";
+
+#ifdef LZ_HAS_CXX_11
+    auto ints = numbers | lz::sv_split(',') | lz::parse<int>{};
+    auto bytes = numbers | lz::sv_split(',') | lz::parse<std::uint8_t>{};
+#else
+    auto ints = numbers | lz::sv_split(',') | lz::parse<int>;
+    auto bytes = numbers | lz::sv_split(',') | lz::parse<std::uint8_t>;
+#endif
+
+    // Invalid or out of range numbers result in an empty optional
+    lz::for_each(ints, [](const lz::optional<int> i) {
+        if (i) {
+            std::cout << *i << ' ';
+        }
+        else {
+            std::cout << "invalid ";
+        }
+    });
+    // Output: 12 -7 invalid 300
+    std::cout << '\n';
+
+    lz::for_each(bytes, [](const lz::optional<std::uint8_t> byte) {
+        std::cout << (byte ? std::to_string(*byte) : "invalid") << ' ';
+    });
+    // Output: 12 invalid invalid invalid
+    std::cout << '\n';
+
+    std::string measurements = "1.5 2.25 1e3";
+#ifdef LZ_HAS_CXX_11
+    auto doubles = measurements | lz::sv_split(' ') | lz::parse<double>{};
+#else
+    auto doubles = measurements | lz::sv_split(' ') | lz::parse<double>;
+#endif
+    double sum = 0;
+    lz::for_each(doubles, [&sum](const lz::optional<double> d) { sum += d.value_or(0); });
+    std::cout << sum << '\n';
+    // Output: 1003.75
+}
@@ -0,0 +1,32 @@
+#include <Lz/algorithm/for_each.hpp>
+#include <Lz/generate_while.hpp>
+#include <Lz/map.hpp>
+#include <Lz/prefetch_async.hpp>
+#include <iostream>
+#include <sstream>
+
+int main() {
+    std::istringstream input("1 2 3 4 5");
+    // Imagine this being a slow (I/O bound) producer, like a file or a socket
+    auto numbers = lz::generate_while([&input]() {
+        int i = 0;
+        const bool ok = static_cast<bool>(input >> i);
+        return std::make_pair(i, ok);
+    });
+
+    // The numbers are read on a background thread, while the squares are calculated on the current thread
+    auto squares = numbers | lz::prefetch_async(256) | lz::map([](int i) { return i * i; });
+
+#ifdef LZ_HAS_CXX_17
+    for (int i : squares) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    }
+#else
+    lz::for_each(squares, [](int i) {
+        std::cout << i << ' ';
+        // Or use fmt::print("{} ", i);
+    });
+#endif
+    // Output: 1 4 9 16 25
+}
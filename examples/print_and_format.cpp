@@ -1,5 +1,6 @@
 #include <Lz/stream.hpp>
 #include <Lz/basic_iterable.hpp>
+#include <cstdio>
 #include <iostream>
 #include <vector>
 
@@ -43,6 +44,15 @@ int main() {
 
     v | lz::format(std::cout, ", ", "{:02d}"); // 01, 02, 03, 04, 05
     std::cout << '\n';
+
+    // Writes to stdout at once, without going through a stream
+    v | lz::format(stdout, ", ", "{:02d}"); // 01, 02, 03, 04, 05
+    std::cout << '\n';
+
+    // Formats directly to an output iterator, such as a pointer to a buffer or std::back_inserter(fmt::memory_buffer)
+    char buffer[32];
+    char* end = lz::format_to(v, buffer, " "); // 1 2 3 4 5
+    std::cout.write(buffer, end - buffer) << '\n';
 #endif
 
     std::cout << lz::basic_iterable<decltype(v.begin())>{ v.begin(), v.end() } << '\n'; // 1, 2, 3, 4, 5
@@ -1,6 +1,8 @@
 #include <Lz/algorithm/for_each.hpp>
+#include <Lz/procs/to.hpp>
 #include <Lz/random.hpp>
 #include <iostream>
+#include <vector>
 
 int main() {
     const float min = 0;
@@ -62,4 +64,13 @@ int main() {
     });
 // Output: [random number] [random number] [random number]
 #endif
+
+    std::cout << '\n';
+    // Or use one of the fast engines (lz::xoshiro256ss, lz::pcg64 or lz::philox4x32). Converting to a container generates all
+    // values in one tight loop
+    lz::xoshiro256ss engine(42);
+    std::uniform_real_distribution<double> dist(0., 1.);
+    const auto values = lz::random(dist, engine, 1000) | lz::to<std::vector>();
+    std::cout << values.size() << '\n';
+    // Output: 1000
 }
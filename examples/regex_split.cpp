@@ -26,6 +26,16 @@ int main() {
         // Or use fmt::print("{}\n", word);
     }
     // output: Hello World!This is a test
+
+    std::cout << '\n';
+
+    // lz::dfa_regex (or any other type with a char_type and a find(first, last) member) is a lot faster than std::regex
+    lz::dfa_regex dfa(R"(\s*[,!]\s*)");
+    for (const lz::string_view word : lz::regex_split(input, dfa)) {
+        std::cout.write(word.data(), word.size());
+        std::cout << ' ';
+    }
+    // output: Hello World This is a test
 #else
     lz::for_each(result, [](const lz::string_view word) {
         // Use .write if using fmt::string_view
@@ -44,5 +54,15 @@ int main() {
         // Or use fmt::print("{}\n", word);
     });
     // output: Hello World!This is a test
+
+    std::cout << '\n';
+
+    // lz::dfa_regex (or any other type with a char_type and a find(first, last) member) is a lot faster than std::regex
+    lz::dfa_regex dfa(R"(\s*[,!]\s*)");
+    lz::for_each(lz::regex_split(input, dfa), [](const lz::string_view word) {
+        std::cout.write(word.data(), word.size());
+        std::cout << ' ';
+    });
+    // output: Hello World This is a test
 #endif
 }
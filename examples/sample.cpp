@@ -0,0 +1,22 @@
+#include <Lz/range.hpp>
+#include <Lz/sample.hpp>
+#include <iostream>
+#include <vector>
+
+int main() {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    // The same seed always gives the same sample
+    auto sample = vec | lz::sample(2, 42);
+
+    for (auto it = sample.begin(); it != sample.end(); ++it) {
+        std::cout << *it << ' ';
+        // Or use fmt::print("{} ", *it);
+    }
+    std::cout << '\n';
+    // Output: 1 5
+
+    // Elements that are not picked are skipped in O(1) for random access iterables
+    auto large = lz::range(100000000) | lz::sample(3);
+    std::cout << large.size() << '\n';
+    // Output: 3
+}
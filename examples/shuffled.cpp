@@ -0,0 +1,22 @@
+#include <Lz/range.hpp>
+#include <Lz/shuffled.hpp>
+#include <iostream>
+#include <vector>
+
+int main() {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    // The same seed always gives the same order
+    auto shuffled = vec | lz::shuffled(42);
+
+    for (auto it = shuffled.begin(); it != shuffled.end(); ++it) {
+        std::cout << *it << ' ';
+        // Or use fmt::print("{} ", *it);
+    }
+    std::cout << '\n';
+    // Output: 2 1 5 3 4
+
+    // Only uses O(1) memory, even for huge iterables
+    auto huge = lz::range(1000000000) | lz::shuffled(42);
+    std::cout << huge.begin()[123456789] << '\n';
+    // Output: a random number between [0, 1000000000)
+}
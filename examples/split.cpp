@@ -95,6 +95,18 @@ int main() {
         std::cout << ' ';
         // Or use fmt::print("{} ", substring);
     }
+    // Output: hello world
+    std::cout << '\n';
+
+    // Splitting on any of multiple characters known at compile time, in a single pass
+    std::string to_split5 = "hello world\tthis\nis";
+    for (lz::string_view substring : to_split5 | lz::split_any<' ', '\t', '\n'>) {
+        const auto substring_size = static_cast<std::streamsize>(substring.size());
+        std::cout.write(substring.data(), substring_size);
+        std::cout << ' ';
+        // Or use fmt::print("{} ", substring);
+    }
+    // Output: hello world this is
 #else
     std::string to_split = "Hello world ";
     std::string delim = " ";
@@ -183,5 +195,22 @@ int main() {
         std::cout << ' ';
         // Or use fmt::print("{} ", substring);
     });
+    // Output: hello world
+    std::cout << '\n';
+
+    // Splitting on any of multiple characters known at compile time, in a single pass
+    std::string to_split5 = "hello world\tthis\nis";
+#ifdef LZ_HAS_CXX_11
+    auto splitter_any = to_split5 | lz::split_any<' ', '\t', '\n'>{};
+#else
+    auto splitter_any = to_split5 | lz::split_any<' ', '\t', '\n'>;
+#endif
+    lz::for_each(splitter_any, [](lz::string_view substring) {
+        const auto substring_size = static_cast<std::streamsize>(substring.size());
+        std::cout.write(substring.data(), substring_size);
+        std::cout << ' ';
+        // Or use fmt::print("{} ", substring);
+    });
+    // Output: hello world this is
 #endif
 }
@@ -0,0 +1,31 @@
+#include <Lz/chunks.hpp>
+#include <Lz/map.hpp>
+#include <Lz/traits/static_size.hpp>
+#include <array>
+#include <iostream>
+
+int main() {
+    std::array<float, 8> samples = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+    auto gained = lz::map(samples, [](float f) { return f * 0.5f; });
+    // The size of gained is known at compile time
+    static_assert(lz::static_size<decltype(gained)>::value == 8, "");
+
+#ifdef LZ_HAS_CXX_11
+    auto frames = gained | lz::static_chunks<4>{};
+#else
+    auto frames = gained | lz::static_chunks<4>;
+#endif
+    static_assert(lz::static_size<decltype(frames)>::value == 2, "");
+
+    for (const std::array<float, 4>& frame : frames) {
+        float sum = 0.f;
+        // Fixed number of iterations, can be unrolled by the compiler
+        for (float f : frame) {
+            sum += f;
+        }
+        std::cout << sum << '\n';
+    }
+    // Output:
+    // 5
+    // 13
+}
@@ -0,0 +1,35 @@
+#include <Lz/algorithm/for_each.hpp>
+#include <Lz/algorithm/utf8_validate.hpp>
+#include <Lz/utf8_codepoints.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+int main() {
+    auto print = [](char32_t codepoint) {
+        std::cout << "U+" << std::hex << static_cast<std::uint32_t>(codepoint) << ' ';
+    };
+
+    // "h", "e" with an acute accent, a space and the euro sign
+    std::string str = "h\xC3\xA9 \xE2\x82\xAC";
+
+    std::cout << std::boolalpha << lz::utf8_validate(str) << '\n';
+    // Output: true
+
+    lz::for_each(lz::utf8_codepoints(str), print);
+    // Output: U+68 U+e9 U+20 U+20ac
+    std::cout << '\n';
+
+    // Ill formed sequences are decoded as U+FFFD
+    std::string ill_formed = "a\xC3(";
+    std::cout << lz::utf8_validate(ill_formed) << '\n';
+    // Output: false
+    lz::for_each(ill_formed | lz::utf8_codepoints, print);
+    // Output: U+61 U+fffd U+28
+    std::cout << '\n';
+
+    // Null terminated strings are decoded without calculating their length first
+    lz::for_each(lz::utf8_codepoints("\xE2\x82\xAC!"), print);
+    // Output: U+20ac U+21
+    std::cout << '\n';
+}
@@ -51,5 +51,6 @@
 #include <Lz/algorithm/starts_with.hpp>
 #include <Lz/algorithm/transform.hpp>
 #include <Lz/algorithm/upper_bound.hpp>
+#include <Lz/algorithm/utf8_validate.hpp>
 
 #endif
@@ -5,6 +5,7 @@
 
 #include <Lz/detail/algorithm/copy.hpp>
 #include <Lz/detail/traits/is_sentinel.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
 
 #ifndef LZ_HAS_CXX_17
 #include <Lz/detail/traits/enable_if.hpp>
@@ -12,17 +13,48 @@
 
 LZ_MODULE_EXPORT namespace lz {
 
+#ifdef LZ_HAS_CXX_17
+
 /**
- * @brief Copies elements from an iterable to the output iterator.
+ * @brief Copies elements from an iterable to the output iterator. Iterables that can write their elements in bulk (such as
+ * `lz::random`) do so.
  *
  * @param iterable The iterable to copy from.
  * @param out The output iterator to copy to.
  */
 template<class Iterable, class OutputIterator>
 void copy(Iterable&& iterable, OutputIterator out) {
+    if constexpr (detail::has_copy_to<detail::remove_cvref_t<Iterable>, OutputIterator>::value) {
+        static_cast<void>(iterable.copy_to(std::move(out)));
+    }
+    else {
+        detail::copy(detail::begin(iterable), detail::end(iterable), std::move(out));
+    }
+}
+
+#else
+
+/**
+ * @brief Copies elements from an iterable to the output iterator. Iterables that can write their elements in bulk (such as
+ * `lz::random`) do so.
+ *
+ * @param iterable The iterable to copy from.
+ * @param out The output iterator to copy to.
+ */
+template<class Iterable, class OutputIterator>
+detail::enable_if_t<!detail::has_copy_to<detail::remove_cvref_t<Iterable>, OutputIterator>::value>
+copy(Iterable&& iterable, OutputIterator out) {
     detail::copy(detail::begin(iterable), detail::end(iterable), std::move(out));
 }
 
+template<class Iterable, class OutputIterator>
+detail::enable_if_t<detail::has_copy_to<detail::remove_cvref_t<Iterable>, OutputIterator>::value>
+copy(Iterable&& iterable, OutputIterator out) {
+    static_cast<void>(iterable.copy_to(std::move(out)));
+}
+
+#endif
+
 } // namespace lz
 
 #endif
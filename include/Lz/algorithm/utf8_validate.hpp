@@ -0,0 +1,60 @@
+#pragma once
+
+#ifndef LZ_ALGORITHM_UTF8_VALIDATE_HPP
+#define LZ_ALGORITHM_UTF8_VALIDATE_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/iterables/c_string.hpp>
+#include <Lz/detail/procs/utf8.hpp>
+#include <cstring>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Checks whether a string is well formed UTF-8: no overlong encodings, surrogates, code points above U+10FFFF or
+ * truncated sequences. ASCII is checked 8 characters at a time. Example:
+ * ```cpp
+ * std::string str = "h\xC3\xA9!";
+ * bool valid = lz::utf8_validate(str); // true
+ * bool valid = lz::utf8_validate(lz::string_view("\xC0\xAF")); // false, overlong encoding of '/'
+ * ```
+ * @param str The string to check, must have a `data()` and `size()` member, such as `std::string` or `lz::string_view`.
+ * @return `true` if the string is well formed UTF-8, `false` otherwise.
+ */
+template<class String>
+LZ_NODISCARD bool utf8_validate(const String& str) noexcept {
+    return detail::find_invalid_utf8(str.data(), str.data() + str.size()) == str.data() + str.size();
+}
+
+/**
+ * @brief Checks whether a null terminated string is well formed UTF-8: no overlong encodings, surrogates, code points above
+ * U+10FFFF or truncated sequences. ASCII is checked 8 characters at a time. Example:
+ * ```cpp
+ * bool valid = lz::utf8_validate("h\xC3\xA9!"); // true
+ * ```
+ * @param str The null terminated string to check.
+ * @return `true` if the string is well formed UTF-8, `false` otherwise.
+ */
+template<class C>
+LZ_NODISCARD bool utf8_validate(C* str) noexcept {
+    const char* last = str + std::strlen(str);
+    return detail::find_invalid_utf8(str, last) == last;
+}
+
+/**
+ * @brief Checks whether a string, created by lz::c_string, is well formed UTF-8: no overlong encodings, surrogates, code points
+ * above U+10FFFF or truncated sequences. ASCII is checked 8 characters at a time. Example:
+ * ```cpp
+ * bool valid = lz::utf8_validate(lz::c_string("h\xC3\xA9!")); // true
+ * ```
+ * @param str The c_string iterable to check.
+ * @return `true` if the string is well formed UTF-8, `false` otherwise.
+ */
+template<class C>
+LZ_NODISCARD bool utf8_validate(const detail::c_string_iterable<C>& str) noexcept {
+    return lz::utf8_validate(str.begin().operator->());
+}
+
+} // namespace lz
+
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+#ifndef LZ_CACHED_BEGIN_HPP
+#define LZ_CACHED_BEGIN_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/cached_begin.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Creates an iterable that caches the iterator returned by begin() of its input iterable. Some iterables need to
+ * search for their first element in begin(), which is O(n). For instance, `lz::filter` searches for the first element
+ * that satisfies the predicate and `lz::chunk_if` searches for the end of the first chunk, every time begin() is called.
+ * Functions that call begin() multiple times (such as `lz::empty`, `lz::front` or iterables such as `lz::zip` and
+ * `lz::concatenate` that call begin() of their input iterables multiple times) will therefore do this search multiple
+ * times. `lz::cache_begin` will only call begin() of its input iterable once (the first time begin() is called) and
+ * return a copy of that iterator afterwards, like `std::ranges::filter_view` does. begin() may be called concurrently on
+ * the same (const) object. The cache is not copied, copies will call begin() of their input iterable once again.
+ *
+ * Because the iterator is cached, modifying the underlying container (so that the first element changes or iterators are
+ * invalidated) after begin() has been called results in a stale iterator. The input iterable must be forward or stronger.
+ * The size() and end() functions are forwarded to the input iterable. `lz::drop_while` does not need this, as it already
+ * searches for its first element only once, when it is constructed. Example:
+ * ```cpp
+ * std::vector<int> vec = { 1, 3, 5, 6, 7 };
+ * auto evens = vec | lz::filter([](int i) { return i % 2 == 0; }) | lz::cache_begin;
+ * auto first = evens.begin(); // searches for the first even number
+ * bool empty = lz::empty(evens); // does not search again
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::cached_begin_adaptor cache_begin{};
+
+/**
+ * @brief Helper alias for the cached_begin_iterable.
+ * Example:
+ * ```cpp
+ * std::vector<int> vec = {1, 2, 3, 4, 5};
+ * auto f = lz::filter(vec, [](int i) { return i > 2; });
+ * lz::cached_begin_iterable<decltype(f)> iterable = lz::cache_begin(f);
+ * ```
+ */
+template<class Iterable>
+using cached_begin_iterable = detail::cached_begin_iterable<Iterable>;
+
+} // namespace lz
+
+#endif
@@ -0,0 +1,201 @@
+#pragma once
+
+#ifndef LZ_CHANNEL_HPP
+#define LZ_CHANNEL_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/iterators/channel.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <Lz/util/optional.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief A bounded, thread safe multi producer/multi consumer queue that can be used to feed a pipeline from other threads.
+ * Producers push elements into the channel using `push` (blocks while the channel is full) or `try_push` (never blocks), and
+ * call `close` when they are done. The channel itself is an input iterable that ends once the channel is closed and all of its
+ * elements have been consumed, so it can be used directly in pipelines. To amortize synchronization, consumers do not pop one
+ * element at a time: every time the (local) batch of an iterator is exhausted, it takes up to `batch_size` elements from the
+ * channel with a single lock acquisition. Multiple threads may iterate over the same channel at once, every element is then
+ * received by exactly one of them. Its end() function returns a sentinel and its iterator category is input, so adaptors that
+ * need multiple passes over their input (such as `lz::chunks`) cannot be used with it. Use `pop_batch` to receive elements in
+ * batches instead. Example:
+ * ```cpp
+ * lz::channel<int> channel(1024);
+ * std::thread producer([&channel]() {
+ *     for (int i = 0; i < 100; ++i) {
+ *         channel.push(i);
+ *     }
+ *     channel.close();
+ * });
+ * for (int i : channel | lz::filter([](int i) { return i % 2 == 0; })) {
+ *     // 0, 2, 4, ..., 98
+ * }
+ * producer.join();
+ * ```
+ * @tparam T The type of the elements in the channel.
+ */
+template<class T>
+class channel {
+    mutable std::mutex _mutex{};
+    std::condition_variable _not_full{};
+    std::condition_variable _not_empty{};
+
+    std::vector<optional<T>> _slots;
+    size_t _head{};
+    size_t _count{};
+    size_t _batch_size;
+    bool _closed{ false };
+
+    template<class U>
+    void push_unlocked(U&& value) {
+        _slots[(_head + _count) % _slots.size()] = std::forward<U>(value);
+        ++_count;
+    }
+
+    template<class U>
+    bool push_impl(U&& value) {
+        {
+            std::unique_lock<std::mutex> lock{ _mutex };
+            _not_full.wait(lock, [this] { return _closed || _count != _slots.size(); });
+            if (_closed) {
+                return false;
+            }
+            push_unlocked(std::forward<U>(value));
+        }
+        _not_empty.notify_one();
+        return true;
+    }
+
+    template<class U>
+    bool try_push_impl(U&& value) {
+        {
+            std::lock_guard<std::mutex> lock{ _mutex };
+            if (_closed || _count == _slots.size()) {
+                return false;
+            }
+            push_unlocked(std::forward<U>(value));
+        }
+        _not_empty.notify_one();
+        return true;
+    }
+
+public:
+    using value_type = T;
+    using iterator = detail::channel_iterator<channel<T>>;
+
+    /**
+     * @brief Constructs a channel.
+     * @param capacity The maximum amount of elements in the channel. Producers block in `push` if the channel is full.
+     * @param batch_size The maximum amount of elements an iterator takes from the channel at once.
+     */
+    explicit channel(const size_t capacity = 1024, const size_t batch_size = 64) :
+        _slots(capacity != 0 ? capacity : 1),
+        _batch_size{ batch_size != 0 ? batch_size : 1 } {
+    }
+
+    channel(const channel&) = delete;
+    channel& operator=(const channel&) = delete;
+
+    /**
+     * @brief Pushes @p value into the channel. Blocks while the channel is full.
+     * @return `false` if the channel is closed, in which case @p value is not pushed.
+     */
+    bool push(const T& value) {
+        return push_impl(value);
+    }
+
+    /**
+     * @brief Pushes @p value into the channel. Blocks while the channel is full.
+     * @return `false` if the channel is closed, in which case @p value is not pushed.
+     */
+    bool push(T&& value) {
+        return push_impl(std::move(value));
+    }
+
+    /**
+     * @brief Pushes @p value into the channel, if it is not full.
+     * @return `false` if the channel is full or closed, in which case @p value is not pushed.
+     */
+    bool try_push(const T& value) {
+        return try_push_impl(value);
+    }
+
+    /**
+     * @brief Pushes @p value into the channel, if it is not full.
+     * @return `false` if the channel is full or closed, in which case @p value is not pushed.
+     */
+    bool try_push(T&& value) {
+        return try_push_impl(std::move(value));
+    }
+
+    /**
+     * @brief Closes the channel. Pushing into a closed channel fails. Consumers still receive the elements that are left in the
+     * channel, after which their iteration ends. Blocked producers and consumers are woken up.
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock{ _mutex };
+            _closed = true;
+        }
+        _not_full.notify_all();
+        _not_empty.notify_all();
+    }
+
+    LZ_NODISCARD bool closed() const {
+        std::lock_guard<std::mutex> lock{ _mutex };
+        return _closed;
+    }
+
+    LZ_NODISCARD size_t batch_size() const noexcept {
+        return _batch_size;
+    }
+
+    /**
+     * @brief Moves up to @p max_count elements from the channel to the back of @p out, with a single lock acquisition. Blocks
+     * until at least one element is available, or until the channel is closed.
+     * @return The amount of elements that were moved. 0 means the channel is closed and empty.
+     */
+    size_t pop_batch(std::vector<T>& out, const size_t max_count) {
+        size_t popped = 0;
+        {
+            std::unique_lock<std::mutex> lock{ _mutex };
+            _not_empty.wait(lock, [this] { return _closed || _count != 0; });
+            popped = (std::min)(_count, max_count);
+            for (size_t i = 0; i < popped; ++i) {
+                auto& slot = _slots[_head];
+                out.push_back(std::move(*slot));
+                slot.reset();
+                _head = (_head + 1) % _slots.size();
+            }
+            _count -= popped;
+        }
+        if (popped > 1) {
+            _not_full.notify_all();
+        }
+        else if (popped == 1) {
+            _not_full.notify_one();
+        }
+        return popped;
+    }
+
+    /**
+     * @brief Returns an iterator that receives elements from the channel. Blocks until the first element is available, or
+     * until the channel is closed.
+     */
+    LZ_NODISCARD iterator begin() {
+        return iterator{ *this };
+    }
+
+    LZ_NODISCARD default_sentinel_t end() const noexcept {
+        return {};
+    }
+};
+
+} // namespace lz
+
+#endif // LZ_CHANNEL_HPP
@@ -5,6 +5,7 @@
 
 #include <Lz/procs/chain.hpp>
 #include <Lz/detail/adaptors/chunks.hpp>
+#include <Lz/detail/adaptors/static_chunks.hpp>
 
 LZ_MODULE_EXPORT namespace lz {
 
@@ -52,6 +53,60 @@ LZ_INLINE_VAR constexpr detail::chunks_adaptor chunks{};
 template<class Iterable>
 using chunks_iterable = detail::chunks_iterable<Iterable>;
 
+#ifdef LZ_HAS_CXX_11
+
+/**
+ * @brief Chunks an iterable into chunks of exactly @p N elements, where @p N is known at compile time. Every chunk is returned
+ * by value as a `std::array<T, N>`, so that the chunks can be processed with loops of a fixed length (that can be unrolled by
+ * the compiler). Elements that do not fill a complete chunk are not returned. The iterator category is random access if the
+ * input iterable is random access, forward otherwise. Its end() function returns a sentinel if the input iterable is not random
+ * access or has a sentinel. If the input iterable has a .size() method, then this iterable will also have a .size() method. If
+ * the size of the input iterable is known at compile time, `lz::static_size` is also known for this iterable. Example:
+ * ```cpp
+ * std::array<int, 7> arr = { 1, 2, 3, 4, 5, 6, 7 };
+ * auto chunked = lz::static_chunks<3>{}(arr); // { std::array<int, 3>{ 1, 2, 3 }, std::array<int, 3>{ 4, 5, 6 } }
+ * // or
+ * auto chunked = arr | lz::static_chunks<3>{}; // { std::array<int, 3>{ 1, 2, 3 }, std::array<int, 3>{ 4, 5, 6 } }
+ * ```
+ * @tparam N The number of elements in every chunk.
+ */
+template<size_t N>
+using static_chunks = detail::static_chunks_adaptor<N>;
+
+#else
+
+/**
+ * @brief Chunks an iterable into chunks of exactly @p N elements, where @p N is known at compile time. Every chunk is returned
+ * by value as a `std::array<T, N>`, so that the chunks can be processed with loops of a fixed length (that can be unrolled by
+ * the compiler). Elements that do not fill a complete chunk are not returned. The iterator category is random access if the
+ * input iterable is random access, forward otherwise. Its end() function returns a sentinel if the input iterable is not random
+ * access or has a sentinel. If the input iterable has a .size() method, then this iterable will also have a .size() method. If
+ * the size of the input iterable is known at compile time, `lz::static_size` is also known for this iterable. Example:
+ * ```cpp
+ * std::array<int, 7> arr = { 1, 2, 3, 4, 5, 6, 7 };
+ * auto chunked = lz::static_chunks<3>(arr); // { std::array<int, 3>{ 1, 2, 3 }, std::array<int, 3>{ 4, 5, 6 } }
+ * // or
+ * auto chunked = arr | lz::static_chunks<3>; // { std::array<int, 3>{ 1, 2, 3 }, std::array<int, 3>{ 4, 5, 6 } }
+ * ```
+ * @tparam N The number of elements in every chunk.
+ */
+template<size_t N>
+LZ_INLINE_VAR constexpr detail::static_chunks_adaptor<N> static_chunks{};
+
+#endif
+
+/**
+ * @brief This is the type of the iterable returned by `lz::static_chunks`.
+ * @tparam Iterable The type of the input iterable.
+ * @tparam N The number of elements in every chunk.
+ * ```cpp
+ * std::array<int, 7> arr = { 1, 2, 3, 4, 5, 6, 7 };
+ * lz::static_chunks_iterable<std::array<int, 7>, 3> chunked = lz::static_chunks<3>(arr);
+ * ```
+ */
+template<class Iterable, size_t N>
+using static_chunks_iterable = detail::static_chunks_iterable<Iterable, N>;
+
 } // namespace lz
 
 #endif // LZ_CHUNKS_HPP
@@ -0,0 +1,46 @@
+#pragma once
+
+#ifndef LZ_CONCATENATE_DYNAMIC_HPP
+#define LZ_CONCATENATE_DYNAMIC_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/concatenate_dynamic.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Concatenates a runtime number of random access iterables, such as a vector of buffers, into one random access iterable.
+ * Where `lz::concat` concatenates a fixed number of iterables, this concatenates all iterables of its input. On construction,
+ * the begin iterator and size of every non empty iterable is stored once in a segment table, which is shared by all copies of
+ * this iterable. This makes .size() O(1), random access O(log n), where n is the number of iterables, and incrementing and
+ * decrementing O(1). The segments can also be processed one by one using `.segment(i)` and `.segment_count()`. The input only
+ * needs to be an input iterable, and is only traversed once. Like other iterables, the input must be an lvalue or a lazy view.
+ * Its iterables must be returned by reference (or be lazy views), and must not be resized while this iterable is in use.
+ * Example:
+ * ```cpp
+ * std::vector<std::vector<char>> buffers = { { 'a', 'b' }, {}, { 'c' } };
+ * auto stream = lz::concat_dynamic(buffers); // { 'a', 'b', 'c' }
+ * // or
+ * auto stream = buffers | lz::concat_dynamic; // { 'a', 'b', 'c' }
+ * auto second = stream.begin()[1]; // 'b', found using a binary search
+ * for (std::size_t i = 0; i < stream.segment_count(); ++i) {
+ *     auto segment = stream.segment(i); // { 'a', 'b' }, { 'c' }
+ * }
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::concatenate_dynamic_adaptor concat_dynamic{};
+
+/**
+ * @brief Helper alias for the concatenate dynamic iterable.
+ * @tparam Iterable The iterable of iterables to concatenate.
+ * ```cpp
+ * std::vector<std::vector<char>> buffers = { { 'a', 'b' }, {}, { 'c' } };
+ * lz::concatenate_dynamic_iterable<std::vector<std::vector<char>>> stream = lz::concat_dynamic(buffers);
+ * ```
+ */
+template<class Iterable>
+using concatenate_dynamic_iterable = detail::concatenate_dynamic_iterable<Iterable>;
+
+} // namespace lz
+
+#endif // LZ_CONCATENATE_DYNAMIC_HPP
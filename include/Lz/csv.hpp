@@ -0,0 +1,88 @@
+#pragma once
+
+#ifndef LZ_CSV_HPP
+#define LZ_CSV_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/csv.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Iterates over the records of a CSV (or TSV) buffer. Every record is a random access iterable of fields, whose values are
+ * string views into the buffer. Quoted fields may contain delimiters, newlines and escaped (doubled) quotes. Only the values of
+ * fields that contain escaped quotes are copied. They are unescaped once, into the iterable. The buffer is scanned once, when
+ * lz::csv is called, to find the bounds of all fields. Records are separated by `\n` or `\r\n`, and empty lines are skipped. The
+ * buffer must outlive the iterable, and the values of fields are valid as long as the buffer and the iterable exist. The result
+ * is random access, contains a .size() method and does not have a sentinel. Example:
+ * ```cpp
+ * std::string buffer = "name,quote\nAda,\"Hello, \"\"world\"\"\"\n";
+ * auto records = lz::csv(buffer); // { { "name", "quote" }, { "Ada", "Hello, \"world\"" } }
+ * auto records = buffer | lz::csv; // same as above
+ * auto tsv = buffer | lz::csv(lz::csv_options{ '\t' }); // Tab separated
+ * for (auto&& record : records) {
+ *     lz::string_view name = record[0].value();
+ *     std::string quote = record[1].str();
+ * }
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::csv_adaptor csv{};
+
+/**
+ * @brief Options for lz::csv: the delimiter (`,` by default) and quote (`"` by default) characters.
+ * ```cpp
+ * lz::basic_csv_options<wchar_t> options{ L';' };
+ * ```
+ */
+template<class CharT>
+using basic_csv_options = detail::basic_csv_options<CharT>;
+
+/**
+ * @brief Options for lz::csv: the delimiter (`,` by default) and quote (`"` by default) characters.
+ * ```cpp
+ * lz::csv_options tsv{ '\t' };
+ * lz::csv_options semicolons{ ';', '\'' };
+ * ```
+ */
+using csv_options = basic_csv_options<char>;
+
+/**
+ * @brief A field of a record of lz::csv. `value()` returns its value as a string view, which refers to the source buffer, or
+ * to the unescaped value stored in the lz::csv iterable if it contains escaped quotes (see `escaped()`). `str()` returns a copy
+ * and `raw()` returns the field as it is in the source buffer, without enclosing quotes.
+ */
+template<class CharT>
+using basic_csv_field = detail::basic_csv_field<CharT>;
+
+/**
+ * @brief A field of a record of lz::csv. `value()` returns its value as a string view, which refers to the source buffer, or
+ * to the unescaped value stored in the lz::csv iterable if it contains escaped quotes (see `escaped()`). `str()` returns a copy
+ * and `raw()` returns the field as it is in the source buffer, without enclosing quotes.
+ */
+using csv_field = basic_csv_field<char>;
+
+/**
+ * @brief A record of lz::csv, a random access iterable of lz::basic_csv_field.
+ */
+template<class CharT>
+using basic_csv_record = detail::basic_csv_record<CharT>;
+
+/**
+ * @brief A record of lz::csv, a random access iterable of lz::csv_field.
+ */
+using csv_record = basic_csv_record<char>;
+
+/**
+ * @brief Csv iterable helper alias.
+ * @tparam CharT The character type of the buffer.
+ * ```cpp
+ * std::string buffer = "a,b\nc,d";
+ * lz::csv_iterable<char> records = lz::csv(buffer);
+ * ```
+ */
+template<class CharT>
+using csv_iterable = detail::csv_iterable<CharT>;
+
+} // namespace lz
+
+#endif // LZ_CSV_HPP
@@ -0,0 +1,43 @@
+#pragma once
+
+#ifndef LZ_CACHED_BEGIN_ADAPTOR_HPP
+#define LZ_CACHED_BEGIN_ADAPTOR_HPP
+
+#include <Lz/detail/iterables/cached_begin.hpp>
+
+namespace lz {
+namespace detail {
+struct cached_begin_adaptor {
+    using adaptor = cached_begin_adaptor;
+
+    /**
+     * @brief Creates an iterable that caches the iterator returned by begin() of its input iterable. Some iterables need to
+     * search for their first element in begin(), which is O(n). For instance, `lz::filter` searches for the first element
+     * that satisfies the predicate and `lz::chunk_if` searches for the end of the first chunk, every time begin() is called.
+     * Functions that call begin() multiple times (such as `lz::empty`, `lz::front` or iterables such as `lz::zip` and
+     * `lz::concatenate` that call begin() of their input iterables multiple times) will therefore do this search multiple
+     * times. `lz::cache_begin` will only call begin() of its input iterable once (the first time begin() is called) and
+     * return a copy of that iterator afterwards, like `std::ranges::filter_view` does. begin() may be called concurrently on
+     * the same (const) object. The cache is not copied, copies will call begin() of their input iterable once again.
+     *
+     * Because the iterator is cached, modifying the underlying container (so that the first element changes or iterators are
+     * invalidated) after begin() has been called results in a stale iterator. The input iterable must be forward or stronger.
+     * The size() and end() functions are forwarded to the input iterable. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 3, 5, 6, 7 };
+     * auto evens = vec | lz::filter([](int i) { return i % 2 == 0; }) | lz::cache_begin;
+     * auto first = evens.begin(); // searches for the first even number
+     * bool empty = lz::empty(evens); // does not search again
+     * ```
+     * @param iterable The iterable to cache the begin iterator of
+     * @return A cached_begin_iterable object that can be used to iterate over the elements in the iterable with a cached begin.
+     */
+    template<class Iterable>
+    LZ_NODISCARD cached_begin_iterable<remove_ref_t<Iterable>> operator()(Iterable&& iterable) const {
+        return cached_begin_iterable<remove_ref_t<Iterable>>{ std::forward<Iterable>(iterable) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
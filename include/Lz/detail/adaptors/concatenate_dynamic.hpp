@@ -0,0 +1,38 @@
+#pragma once
+
+#ifndef LZ_CONCATENATE_DYNAMIC_ADAPTOR_HPP
+#define LZ_CONCATENATE_DYNAMIC_ADAPTOR_HPP
+
+#include <Lz/detail/iterables/concatenate_dynamic.hpp>
+
+namespace lz {
+namespace detail {
+struct concatenate_dynamic_adaptor {
+    using adaptor = concatenate_dynamic_adaptor;
+
+    /**
+     * @brief Concatenates a runtime number of random access iterables, such as a vector of buffers, into one random access
+     * iterable. Where `lz::concat` concatenates a fixed number of iterables, this function concatenates all iterables of
+     * @p iterables. On construction, the begin iterator and size of every non empty iterable is stored once in a segment table,
+     * which is shared by all copies of this iterable. This makes .size() O(1), random access O(log n), where n is the number
+     * of iterables, and incrementing and decrementing O(1). The segments can also be processed one by one using `.segment(i)`
+     * and `.segment_count()`. @p iterables only needs to be an input iterable, and is only traversed once. Like other
+     * iterables, @p iterables must be an lvalue or a lazy view. Its iterables must be returned by reference (or be lazy views),
+     * and must not be resized while this iterable is in use. Example:
+     * ```cpp
+     * std::vector<std::vector<char>> buffers = { { 'a', 'b' }, {}, { 'c' } };
+     * auto stream = lz::concat_dynamic(buffers); // { 'a', 'b', 'c' }
+     * auto second = stream.begin()[1]; // 'b', found using a binary search
+     * ```
+     * @param iterables The iterable of random access iterables to concatenate
+     * @return A random access iterable that concatenates all iterables of @p iterables
+     */
+    template<class Iterable>
+    LZ_NODISCARD concatenate_dynamic_iterable<remove_ref_t<Iterable>> operator()(Iterable&& iterables) const {
+        return concatenate_dynamic_iterable<remove_ref_t<Iterable>>{ std::forward<Iterable>(iterables) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
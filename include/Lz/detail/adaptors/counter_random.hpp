@@ -0,0 +1,110 @@
+#pragma once
+
+#ifndef LZ_COUNTER_RANDOM_ADAPTOR_HPP
+#define LZ_COUNTER_RANDOM_ADAPTOR_HPP
+
+#include <Lz/detail/iterables/counter_random.hpp>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+namespace lz {
+namespace detail {
+struct counter_random_adaptor {
+    using adaptor = counter_random_adaptor;
+
+    /**
+     * @brief Generates n amount of random numbers, where the i-th number only depends on @p seed and i. Therefore, unlike
+     * `lz::random`, the numbers are the same regardless of the order in which they are accessed, and the iterable can safely be
+     * split and processed by multiple threads (for instance using `lz::to<std::vector>(lz::par)`), giving the same result as
+     * processing it sequentially. The standard distributions are implementation defined, so the numbers are only reproducible
+     * for a given distribution and standard library. It is random access, has a .size() method and does not have a sentinel.
+     * Example:
+     * ```cpp
+     * std::normal_distribution<double> dist(0., 1.);
+     * auto random = lz::counter_random(dist, 42, 1000);
+     * auto x = random.begin()[500]; // The same for seed 42, regardless of which elements were accessed before
+     * auto vec = random | lz::to<std::vector>(lz::par); // Same result as lz::to<std::vector>()
+     * ```
+     * @param distribution The random distribution to use, for instance std::uniform_real_distribution<double>. Every number is
+     * drawn by a fresh copy of the distribution.
+     * @param seed The seed of the random numbers.
+     * @param amount The amount of random numbers to generate.
+     */
+    template<class Distribution>
+    LZ_NODISCARD constexpr counter_random_iterable<Distribution>
+    operator()(const Distribution& distribution, const std::uint64_t seed, const ptrdiff_t amount) const {
+        return { distribution, seed, amount };
+    }
+
+#ifdef LZ_HAS_CXX_17
+
+    /**
+     * @brief Generates n amount of random numbers in the range [min, max], where the i-th number only depends on @p seed and i.
+     * Uses std::uniform_int_distribution or std::uniform_real_distribution, depending on the type of @p min and @p max. See the
+     * other overload for more information. Example:
+     * ```cpp
+     * auto random = lz::counter_random(0, 10, 42, 5); // 5 random numbers in [0, 10], the same every run for seed 42
+     * ```
+     * @param min The minimum value of the random numbers (inclusive).
+     * @param max The maximum value of the random numbers (inclusive).
+     * @param seed The seed of the random numbers.
+     * @param amount The amount of random numbers to generate.
+     */
+    template<class T>
+    [[nodiscard]] auto operator()(const T min, const T max, const std::uint64_t seed, const ptrdiff_t amount) const {
+        if constexpr (std::is_integral_v<T>) {
+            return (*this)(std::uniform_int_distribution<T>{ min, max }, seed, amount);
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            return (*this)(std::uniform_real_distribution<T>{ min, max }, seed, amount);
+        }
+        else {
+            static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>,
+                          "Type must be either integral or floating point for random generation.");
+        }
+    }
+
+#else
+
+    /**
+     * @brief Generates n amount of random numbers in the range [min, max], where the i-th number only depends on @p seed and i.
+     * Uses std::uniform_int_distribution. See the other overload for more information. Example:
+     * ```cpp
+     * auto random = lz::counter_random(0, 10, 42, 5); // 5 random numbers in [0, 10], the same every run for seed 42
+     * ```
+     * @param min The minimum value of the random numbers (inclusive).
+     * @param max The maximum value of the random numbers (inclusive).
+     * @param seed The seed of the random numbers.
+     * @param amount The amount of random numbers to generate.
+     */
+    template<class Integral>
+    LZ_NODISCARD enable_if_t<std::is_integral<Integral>::value, counter_random_iterable<std::uniform_int_distribution<Integral>>>
+    operator()(const Integral min, const Integral max, const std::uint64_t seed, const ptrdiff_t amount) const {
+        return (*this)(std::uniform_int_distribution<Integral>{ min, max }, seed, amount);
+    }
+
+    /**
+     * @brief Generates n amount of random numbers in the range [min, max), where the i-th number only depends on @p seed and i.
+     * Uses std::uniform_real_distribution. See the other overload for more information. Example:
+     * ```cpp
+     * auto random = lz::counter_random(0., 1., 42, 5); // 5 random numbers in [0, 1), the same every run for seed 42
+     * ```
+     * @param min The minimum value of the random numbers (inclusive).
+     * @param max The maximum value of the random numbers (exclusive).
+     * @param seed The seed of the random numbers.
+     * @param amount The amount of random numbers to generate.
+     */
+    template<class Floating>
+    LZ_NODISCARD
+        enable_if_t<std::is_floating_point<Floating>::value, counter_random_iterable<std::uniform_real_distribution<Floating>>>
+        operator()(const Floating min, const Floating max, const std::uint64_t seed, const ptrdiff_t amount) const {
+        return (*this)(std::uniform_real_distribution<Floating>{ min, max }, seed, amount);
+    }
+
+#endif
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_COUNTER_RANDOM_ADAPTOR_HPP
@@ -0,0 +1,83 @@
+#pragma once
+
+#ifndef LZ_CSV_ADAPTOR_HPP
+#define LZ_CSV_ADAPTOR_HPP
+
+#include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/iterables/csv.hpp>
+#include <Lz/detail/traits/enable_if.hpp>
+#include <Lz/detail/traits/string_traits.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace lz {
+namespace detail {
+struct csv_adaptor {
+    using adaptor = csv_adaptor;
+
+    template<class String>
+    using char_t = typename std::remove_cv<
+        typename std::remove_pointer<decltype(std::declval<const String&>().data())>::type>::type;
+
+    /**
+     * @brief Iterates over the records of a CSV (or TSV) buffer. Every record is a random access iterable of fields, whose values
+     * are string views into the buffer. Quoted fields may contain delimiters, newlines and escaped (doubled) quotes. Only the
+     * values of fields that contain escaped quotes are copied. They are unescaped once, into the iterable. The buffer is scanned
+     * once, when this function is called, to find the bounds of all fields. Records are separated by `\n` or `\r\n`, and empty
+     * lines are skipped. The buffer must outlive the iterable. The result is random access, contains a .size() method and does
+     * not have a sentinel. Example:
+     * ```cpp
+     * std::string buffer = "name,quote\nAda,\"Hello, \"\"world\"\"\"\n";
+     * auto records = lz::csv(buffer); // { { "name", "quote" }, { "Ada", "Hello, \"world\"" } }
+     * auto tsv = lz::csv(buffer, lz::csv_options{ '\t' }); // Tab separated
+     * for (auto&& record : records) {
+     *     lz::string_view name = record[0].value();
+     *     // or use a range based for loop over the fields of the record
+     * }
+     * ```
+     * @param buffer The buffer to read, must have a `data()` and `size()` member.
+     * @param options The delimiter and quote characters.
+     * @return An iterable of records.
+     */
+    template<class String>
+    LZ_NODISCARD csv_iterable<char_t<String>>
+    operator()(const String& buffer,
+               const basic_csv_options<char_t<String>>& options = basic_csv_options<char_t<String>>{}) const {
+        return { buffer.data(), buffer.size(), options };
+    }
+
+    // Temporary buffers are destroyed before the fields are used
+    template<class String, class = enable_if_t<!is_borrowable_string<String>::value>>
+    csv_iterable<char_t<String>>
+    operator()(String&& buffer, const basic_csv_options<char_t<String>>& options = basic_csv_options<char_t<String>>{}) const {
+        static_assert(is_borrowable_string<String>::value,
+                      "Can only bind to lvalues. Check if you are passing a temporary string. Only string views, pointers and "
+                      "lazy views can be passed as temporaries.");
+        return (*this)(static_cast<const String&>(buffer), options);
+    }
+
+    /**
+     * @brief Iterates over the records of a CSV (or TSV) buffer. Every record is a random access iterable of fields, whose values
+     * are string views into the buffer. Quoted fields may contain delimiters, newlines and escaped (doubled) quotes. Only the
+     * values of fields that contain escaped quotes are copied. They are unescaped once, into the iterable. The buffer is scanned
+     * once, when this function is called, to find the bounds of all fields. Records are separated by `\n` or `\r\n`, and empty
+     * lines are skipped. The buffer must outlive the iterable. The result is random access, contains a .size() method and does
+     * not have a sentinel. Example:
+     * ```cpp
+     * std::string buffer = "name\tquote\nAda\tHello\n";
+     * auto records = buffer | lz::csv(lz::csv_options{ '\t' }); // { { "name", "quote" }, { "Ada", "Hello" } }
+     * auto records = buffer | lz::csv; // Comma separated
+     * ```
+     * @param options The delimiter and quote characters.
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class CharT>
+    LZ_NODISCARD constexpr fn_args_holder<adaptor, basic_csv_options<CharT>>
+    operator()(const basic_csv_options<CharT>& options) const {
+        return { options };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,200 @@
+#pragma once
+
+#ifndef LZ_GROUP_BY_HASHED_ADAPTOR_HPP
+#define LZ_GROUP_BY_HASHED_ADAPTOR_HPP
+
+#include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/iterables/group_by_hashed.hpp>
+#include <Lz/detail/traits/is_iterable.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+
+namespace lz {
+namespace detail {
+struct group_by_hashed_adaptor {
+    using adaptor = group_by_hashed_adaptor;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    /**
+     * @brief Groups the elements of an unsorted iterable by key, and aggregates every group into a single value, in one pass over
+     * the input. For every element, `key_fn(element)` is hashed (using `std::hash`) into an open addressing hash table and the
+     * aggregate of its group is updated with `aggregate = aggregator(std::move(aggregate), element)`. The aggregate of a key that
+     * is seen for the first time starts as @p init. The pass over the input iterable is done when calling begin(). The hash table
+     * grows as keys are inserted. If the number of distinct keys is known, it can be passed as @p expected_keys, so that no
+     * rehashing is needed while aggregating. The elements are `std::pair<key, aggregate>` in order of first appearance of the
+     * key. Its end() function returns a sentinel, its iterator category is forward and it does not contain a .size() method.
+     * Example:
+     * ```cpp
+     * struct order { int customer; double amount; };
+     * std::vector<order> orders = { { 1, 10.0 }, { 2, 5.0 }, { 1, 2.5 } };
+     * auto totals = lz::group_by_hashed(orders, [](const order& o) { return o.customer; },
+     *                                   [](double acc, const order& o) { return acc + o.amount; }, 0.0);
+     * // totals = { {1, 12.5}, {2, 5.0} }
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * // init defaults to a value initialized value_type of the input iterable
+     * auto sums = lz::group_by_hashed(vec, [](int i) { return i % 2; }, std::plus<int>{}); // { {1, 9}, {0, 6} }
+     * // Two distinct keys are expected, so the hash table is reserved once
+     * auto reserved = lz::group_by_hashed(vec, [](int i) { return i % 2; }, std::plus<int>{}, 0, 2); // { {1, 9}, {0, 6} }
+     * ```
+     * @param iterable The iterable to group. Does not need to be sorted
+     * @param key_fn The function that returns the key of an element
+     * @param aggregator The function that combines the current aggregate with an element, returning the new aggregate
+     * @param init The initial aggregate of each group
+     * @param expected_keys The expected number of distinct keys, used to reserve the hash table. Defaults to 0
+     * @return An iterable of (key, aggregate) pairs
+     */
+    template<class Iterable, class KeyFn, class Aggregator, class T = val_iterable_t<Iterable>>
+    [[nodiscard]] constexpr group_by_hashed_iterable<remove_ref_t<Iterable>, KeyFn, T, Aggregator>
+    operator()(Iterable&& iterable, KeyFn key_fn, Aggregator aggregator, T init = {}, const size_t expected_keys = 0) const
+        requires(lz::iterable<Iterable>)
+    {
+        return { std::forward<Iterable>(iterable), std::move(key_fn), std::move(aggregator), std::move(init), expected_keys };
+    }
+
+    /**
+     * @brief Groups the elements of an unsorted iterable by key, and aggregates every group into a single value, in one pass
+     * over the input. For every element, `key_fn(element)` is hashed (using `std::hash`) into an open addressing hash table
+     * and the aggregate of its group is updated with `aggregate = aggregator(std::move(aggregate), element)`. The aggregate of
+     * a key that is seen for the first time starts as a value initialized value_type of the input iterable. The pass over the
+     * input iterable is done when calling begin(). The elements are `std::pair<key, aggregate>` in order of first appearance
+     * of the key. Its end() function returns a sentinel, its iterator category is forward and it does not contain a .size()
+     * method. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto sums = vec | lz::group_by_hashed([](int i) { return i % 2; }, std::plus<int>{}); // { {1, 9}, {0, 6} }
+     * ```
+     * @param key_fn The function that returns the key of an element
+     * @param aggregator The function that combines the current aggregate with an element, returning the new aggregate
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class KeyFn, class Aggregator>
+    [[nodiscard]] constexpr fn_args_holder<adaptor, KeyFn, Aggregator> operator()(KeyFn key_fn, Aggregator aggregator) const
+        requires(!lz::iterable<KeyFn>)
+    {
+        return { std::move(key_fn), std::move(aggregator) };
+    }
+
+    /**
+     * @brief Groups the elements of an unsorted iterable by key, and aggregates every group into a single value, in one pass
+     * over the input. For every element, `key_fn(element)` is hashed (using `std::hash`) into an open addressing hash table
+     * and the aggregate of its group is updated with `aggregate = aggregator(std::move(aggregate), element)`. The aggregate of
+     * a key that is seen for the first time starts as @p init. The pass over the input iterable is done when calling begin().
+     * The hash table grows as keys are inserted. If the number of distinct keys is known, it can be passed as @p expected_keys,
+     * so that no rehashing is needed while aggregating. The elements are `std::pair<key, aggregate>` in order of first
+     * appearance of the key. Its end() function returns a sentinel, its iterator category is forward and it does not contain
+     * a .size() method. Example:
+     * ```cpp
+     * struct order { int customer; double amount; };
+     * std::vector<order> orders = { { 1, 10.0 }, { 2, 5.0 }, { 1, 2.5 } };
+     * auto totals = orders | lz::group_by_hashed([](const order& o) { return o.customer; },
+     *                                            [](double acc, const order& o) { return acc + o.amount; }, 0.0);
+     * // totals = { {1, 12.5}, {2, 5.0} }
+     * ```
+     * @param key_fn The function that returns the key of an element
+     * @param aggregator The function that combines the current aggregate with an element, returning the new aggregate
+     * @param init The initial aggregate of each group
+     * @param expected_keys The expected number of distinct keys, used to reserve the hash table. Defaults to 0
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class KeyFn, class Aggregator, class T>
+    [[nodiscard]] constexpr fn_args_holder<adaptor, KeyFn, Aggregator, remove_cvref_t<T>, size_t>
+    operator()(KeyFn key_fn, Aggregator aggregator, T&& init, const size_t expected_keys = 0) const
+        requires(!lz::iterable<KeyFn>)
+    {
+        return { std::move(key_fn), std::move(aggregator), std::forward<T>(init), expected_keys };
+    }
+
+#else
+
+    /**
+     * @brief Groups the elements of an unsorted iterable by key, and aggregates every group into a single value, in one pass over
+     * the input. For every element, `key_fn(element)` is hashed (using `std::hash`) into an open addressing hash table and the
+     * aggregate of its group is updated with `aggregate = aggregator(std::move(aggregate), element)`. The aggregate of a key that
+     * is seen for the first time starts as @p init. The pass over the input iterable is done when calling begin(). The hash table
+     * grows as keys are inserted. If the number of distinct keys is known, it can be passed as @p expected_keys, so that no
+     * rehashing is needed while aggregating. The elements are `std::pair<key, aggregate>` in order of first appearance of the
+     * key. Its end() function returns a sentinel, its iterator category is forward and it does not contain a .size() method.
+     * Example:
+     * ```cpp
+     * struct order { int customer; double amount; };
+     * std::vector<order> orders = { { 1, 10.0 }, { 2, 5.0 }, { 1, 2.5 } };
+     * auto totals = lz::group_by_hashed(orders, [](const order& o) { return o.customer; },
+     *                                   [](double acc, const order& o) { return acc + o.amount; }, 0.0);
+     * // totals = { {1, 12.5}, {2, 5.0} }
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * // init defaults to a value initialized value_type of the input iterable
+     * auto sums = lz::group_by_hashed(vec, [](int i) { return i % 2; }, std::plus<int>{}); // { {1, 9}, {0, 6} }
+     * // Two distinct keys are expected, so the hash table is reserved once
+     * auto reserved = lz::group_by_hashed(vec, [](int i) { return i % 2; }, std::plus<int>{}, 0, 2); // { {1, 9}, {0, 6} }
+     * ```
+     * @param iterable The iterable to group. Does not need to be sorted
+     * @param key_fn The function that returns the key of an element
+     * @param aggregator The function that combines the current aggregate with an element, returning the new aggregate
+     * @param init The initial aggregate of each group
+     * @param expected_keys The expected number of distinct keys, used to reserve the hash table. Defaults to 0
+     * @return An iterable of (key, aggregate) pairs
+     */
+    template<class Iterable, class KeyFn, class Aggregator, class T = val_iterable_t<Iterable>>
+    LZ_NODISCARD constexpr enable_if_t<is_iterable<Iterable>::value,
+                                       group_by_hashed_iterable<remove_ref_t<Iterable>, KeyFn, T, Aggregator>>
+    operator()(Iterable&& iterable, KeyFn key_fn, Aggregator aggregator, T init = {}, const size_t expected_keys = 0) const {
+        return { std::forward<Iterable>(iterable), std::move(key_fn), std::move(aggregator), std::move(init), expected_keys };
+    }
+
+    /**
+     * @brief Groups the elements of an unsorted iterable by key, and aggregates every group into a single value, in one pass
+     * over the input. For every element, `key_fn(element)` is hashed (using `std::hash`) into an open addressing hash table
+     * and the aggregate of its group is updated with `aggregate = aggregator(std::move(aggregate), element)`. The aggregate of
+     * a key that is seen for the first time starts as a value initialized value_type of the input iterable. The pass over the
+     * input iterable is done when calling begin(). The elements are `std::pair<key, aggregate>` in order of first appearance
+     * of the key. Its end() function returns a sentinel, its iterator category is forward and it does not contain a .size()
+     * method. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto sums = vec | lz::group_by_hashed([](int i) { return i % 2; }, std::plus<int>{}); // { {1, 9}, {0, 6} }
+     * ```
+     * @param key_fn The function that returns the key of an element
+     * @param aggregator The function that combines the current aggregate with an element, returning the new aggregate
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class KeyFn, class Aggregator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 enable_if_t<!is_iterable<KeyFn>::value, fn_args_holder<adaptor, KeyFn, Aggregator>>
+    operator()(KeyFn key_fn, Aggregator aggregator) const {
+        return { std::move(key_fn), std::move(aggregator) };
+    }
+
+    /**
+     * @brief Groups the elements of an unsorted iterable by key, and aggregates every group into a single value, in one pass
+     * over the input. For every element, `key_fn(element)` is hashed (using `std::hash`) into an open addressing hash table
+     * and the aggregate of its group is updated with `aggregate = aggregator(std::move(aggregate), element)`. The aggregate of
+     * a key that is seen for the first time starts as @p init. The pass over the input iterable is done when calling begin().
+     * The hash table grows as keys are inserted. If the number of distinct keys is known, it can be passed as @p expected_keys,
+     * so that no rehashing is needed while aggregating. The elements are `std::pair<key, aggregate>` in order of first
+     * appearance of the key. Its end() function returns a sentinel, its iterator category is forward and it does not contain
+     * a .size() method. Example:
+     * ```cpp
+     * struct order { int customer; double amount; };
+     * std::vector<order> orders = { { 1, 10.0 }, { 2, 5.0 }, { 1, 2.5 } };
+     * auto totals = orders | lz::group_by_hashed([](const order& o) { return o.customer; },
+     *                                            [](double acc, const order& o) { return acc + o.amount; }, 0.0);
+     * // totals = { {1, 12.5}, {2, 5.0} }
+     * ```
+     * @param key_fn The function that returns the key of an element
+     * @param aggregator The function that combines the current aggregate with an element, returning the new aggregate
+     * @param init The initial aggregate of each group
+     * @param expected_keys The expected number of distinct keys, used to reserve the hash table. Defaults to 0
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class KeyFn, class Aggregator, class T>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14
+        enable_if_t<!is_iterable<KeyFn>::value, fn_args_holder<adaptor, KeyFn, Aggregator, remove_cvref_t<T>, size_t>>
+        operator()(KeyFn key_fn, Aggregator aggregator, T&& init, const size_t expected_keys = 0) const {
+        return { std::move(key_fn), std::move(aggregator), std::forward<T>(init), expected_keys };
+    }
+
+#endif
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_GROUP_BY_HASHED_ADAPTOR_HPP
@@ -0,0 +1,37 @@
+#pragma once
+
+#ifndef LZ_INDEXED_FLATTEN_ADAPTOR_HPP
+#define LZ_INDEXED_FLATTEN_ADAPTOR_HPP
+
+#include <Lz/detail/iterables/indexed_flatten.hpp>
+
+namespace lz {
+namespace detail {
+struct indexed_flatten_adaptor {
+    using adaptor = indexed_flatten_adaptor;
+
+    /**
+     * @brief Flattens a random access iterable of random access iterables (such as a vector of vectors) by one dimension,
+     * like `lz::flatten`, but returns a random access iterable. On construction, the sizes of the inner iterables are stored
+     * once in an index of prefix sums, which is shared by all copies of this iterable. This makes .size() O(1) and random
+     * access (`operator+`, `operator[]`, `lz::next`) O(log n), where n is the number of inner iterables. Incrementing and
+     * decrementing remain O(1) (amortized, if there are empty inner iterables). Since it is sized and random access, it can
+     * also be converted in parallel using `lz::to(lz::par)`. The inner iterables must be returned by reference, and must not
+     * be resized while this iterable is in use. Example:
+     * ```cpp
+     * std::vector<std::vector<int>> vectors = { { 1, 2, 3 }, {}, { 4, 5 } };
+     * auto flattened = lz::indexed_flatten(vectors); // { 1, 2, 3, 4, 5 }
+     * auto fourth = flattened.begin()[3]; // 4, found using a binary search
+     * ```
+     * @param iterable The random access iterable of random access iterables to flatten
+     * @return A random access iterable that is flattened by one dimension
+     */
+    template<class Iterable>
+    LZ_NODISCARD indexed_flatten_iterable<remove_ref_t<Iterable>> operator()(Iterable&& iterable) const {
+        return indexed_flatten_iterable<remove_ref_t<Iterable>>{ std::forward<Iterable>(iterable) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
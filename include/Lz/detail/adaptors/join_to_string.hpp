@@ -0,0 +1,237 @@
+#pragma once
+
+#ifndef LZ_JOIN_TO_STRING_ADAPTOR_HPP
+#define LZ_JOIN_TO_STRING_ADAPTOR_HPP
+
+#include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/procs/begin_end.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+#include <Lz/detail/traits/string_traits.hpp>
+#include <Lz/util/string_view.hpp>
+#include <algorithm>
+#include <string>
+
+namespace lz {
+namespace detail {
+
+template<class T>
+enable_if_t<std::is_convertible<const T&, string_view>::value, string_view> to_string_piece(const T& str) noexcept {
+    return str;
+}
+
+template<class T>
+enable_if_t<!std::is_convertible<const T&, string_view>::value && has_data_and_size<T>::value, string_view>
+to_string_piece(const T& str) noexcept {
+    return { str.data(), str.size() };
+}
+
+template<class T>
+enable_if_t<!std::is_convertible<const T&, string_view>::value && !has_data_and_size<T>::value && has_string_value<T>::value,
+            string_view>
+to_string_piece(const T& field) noexcept {
+    return field.value();
+}
+
+inline string_view to_string_piece(const char& c) noexcept {
+    return { &c, 1 };
+}
+
+template<class T, class = void>
+struct is_string_piece : std::false_type {};
+
+template<class T>
+struct is_string_piece<T, void_t<decltype(to_string_piece(std::declval<const T&>()))>> : std::true_type {};
+
+// Counting the length first only pays off if the elements can be traversed twice cheaply. Otherwise, elements (for instance
+// strings that are created by lz::map) would be created twice
+template<class Iterable>
+using is_cheap_to_measure = std::integral_constant<bool, is_fwd_tag<iter_cat_iterable_t<Iterable>>::value &&
+                                                             (std::is_reference<ref_iterable_t<Iterable>>::value ||
+                                                              std::is_trivially_copyable<ref_iterable_t<Iterable>>::value)>;
+
+// The pieces are passed to these functions directly, so that pieces that refer to temporary elements stay alive
+template<class OutputIterator>
+OutputIterator copy_string_piece(const string_view piece, OutputIterator out) {
+    return std::copy(piece.data(), piece.data() + piece.size(), std::move(out));
+}
+
+inline void append_string_piece(std::string& result, const string_view piece) {
+    result.append(piece.data(), piece.size());
+}
+
+template<class Iterator, class S>
+size_t joined_size(Iterator first, S last, const size_t separator_size) {
+    if (first == last) {
+        return 0;
+    }
+    size_t size = to_string_piece(*first).size();
+    for (++first; first != last; ++first) {
+        size += separator_size + to_string_piece(*first).size();
+    }
+    return size;
+}
+
+template<class Iterator, class S>
+void append_joined(std::string& result, Iterator first, S last, const string_view separator) {
+    if (first == last) {
+        return;
+    }
+    append_string_piece(result, to_string_piece(*first));
+    for (++first; first != last; ++first) {
+        append_string_piece(result, separator);
+        append_string_piece(result, to_string_piece(*first));
+    }
+}
+
+template<class Iterator, class S, class OutputIterator>
+OutputIterator copy_joined(Iterator first, S last, OutputIterator out, const string_view separator) {
+    if (first == last) {
+        return out;
+    }
+    out = copy_string_piece(to_string_piece(*first), std::move(out));
+    for (++first; first != last; ++first) {
+        out = copy_string_piece(separator, std::move(out));
+        out = copy_string_piece(to_string_piece(*first), std::move(out));
+    }
+    return out;
+}
+
+template<class Iterable>
+enable_if_t<is_cheap_to_measure<Iterable>::value> reserve_joined(std::string& result, const Iterable& iterable,
+                                                                  const string_view separator) {
+    result.reserve(result.size() + joined_size(detail::begin(iterable), detail::end(iterable), separator.size()));
+}
+
+template<class Iterable>
+enable_if_t<!is_cheap_to_measure<Iterable>::value> reserve_joined(std::string&, const Iterable&, const string_view) {
+}
+
+struct join_to_adaptor {
+    using adaptor = join_to_adaptor;
+
+    /**
+     * @brief Appends the strings of an iterable to `output`, separated by `separator`. If the iterable is forward and its
+     * elements are references or views, the exact length is calculated first, so that `output` is allocated at most once.
+     * Elements must be convertible to `lz::string_view`, have a `data()` and `size()` member, have a `value()` member that
+     * returns a `lz::string_view` (such as lz::csv_field), or be a `char`. Example:
+     * ```cpp
+     * std::vector<std::string> vec = { "a", "b", "c" };
+     * std::string output = "letters: ";
+     * lz::join_to(vec, output, ", "); // output = "letters: a, b, c"
+     * ```
+     * @param iterable The iterable of strings to join.
+     * @param output The string to append to.
+     * @param separator The separator to use between the strings.
+     */
+    template<class Iterable>
+    void operator()(const Iterable& iterable, std::string& output, const string_view separator) const {
+        static_assert(is_string_piece<ref_iterable_t<Iterable>>::value,
+                      "The elements must be strings, string views, characters or have a value() method that returns a "
+                      "string view. Use lz::format to join other types.");
+        reserve_joined(output, iterable, separator);
+        append_joined(output, detail::begin(iterable), detail::end(iterable), separator);
+    }
+
+    /**
+     * @brief Writes the strings of an iterable to an output iterator, separated by `separator`. Writing to a pointer to a
+     * contiguous buffer copies every string at once. The buffer must be large enough. Elements must be convertible to
+     * `lz::string_view`, have a `data()` and `size()` member, have a `value()` member that returns a `lz::string_view` (such as
+     * lz::csv_field), or be a `char`. Example:
+     * ```cpp
+     * std::vector<std::string> vec = { "a", "b", "c" };
+     * char buffer[16];
+     * char* end = lz::join_to(vec, buffer, ", "); // buffer = "a, b, c", end = buffer + 7
+     * ```
+     * @param iterable The iterable of strings to join.
+     * @param output The output iterator to write to.
+     * @param separator The separator to use between the strings.
+     * @return The output iterator past the last character written.
+     */
+    template<class Iterable, class OutputIterator>
+    OutputIterator operator()(const Iterable& iterable, OutputIterator output, const string_view separator) const {
+        static_assert(is_string_piece<ref_iterable_t<Iterable>>::value,
+                      "The elements must be strings, string views, characters or have a value() method that returns a "
+                      "string view. Use lz::format to join other types.");
+        return copy_joined(detail::begin(iterable), detail::end(iterable), std::move(output), separator);
+    }
+
+    /**
+     * @brief Appends the strings of an iterable to `output`, separated by `separator`. If the iterable is forward and its
+     * elements are references or views, the exact length is calculated first, so that `output` is allocated at most once.
+     * Example:
+     * ```cpp
+     * std::vector<std::string> vec = { "a", "b", "c" };
+     * std::string output = "letters: ";
+     * vec | lz::join_to(output, ", "); // output = "letters: a, b, c"
+     * ```
+     * @param output The string to append to.
+     * @param separator The separator to use between the strings.
+     * @return An adaptor that can be used in pipe expressions
+     */
+    LZ_NODISCARD fn_args_holder<adaptor, std::string&, string_view>
+    operator()(std::string& output, const string_view separator) const {
+        return { output, separator };
+    }
+
+    /**
+     * @brief Writes the strings of an iterable to an output iterator, separated by `separator`. Writing to a pointer to a
+     * contiguous buffer copies every string at once. The buffer must be large enough. Example:
+     * ```cpp
+     * std::vector<std::string> vec = { "a", "b", "c" };
+     * char buffer[16];
+     * char* end = vec | lz::join_to(buffer, ", "); // buffer = "a, b, c", end = buffer + 7
+     * ```
+     * @param output The output iterator to write to.
+     * @param separator The separator to use between the strings.
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class OutputIterator>
+    LZ_NODISCARD fn_args_holder<adaptor, OutputIterator, string_view>
+    operator()(OutputIterator output, const string_view separator) const {
+        return { std::move(output), separator };
+    }
+};
+
+struct join_to_string_adaptor {
+    using adaptor = join_to_string_adaptor;
+
+    /**
+     * @brief Joins the strings of an iterable into a std::string, separated by `separator`. If the iterable is forward and its
+     * elements are references or views, the exact length is calculated first, so that the result is allocated once. Elements
+     * must be convertible to `lz::string_view`, have a `data()` and `size()` member, have a `value()` member that returns a
+     * `lz::string_view` (such as lz::csv_field), or be a `char`. Use lz::format to join other types. Example:
+     * ```cpp
+     * std::vector<std::string> vec = { "a", "b", "c" };
+     * std::string joined = lz::join_to_string(vec, ", "); // "a, b, c"
+     * ```
+     * @param iterable The iterable of strings to join.
+     * @param separator The separator to use between the strings.
+     * @return The joined string.
+     */
+    template<class Iterable>
+    LZ_NODISCARD std::string operator()(const Iterable& iterable, const string_view separator) const {
+        std::string result;
+        join_to_adaptor{}(iterable, result, separator);
+        return result;
+    }
+
+    /**
+     * @brief Joins the strings of an iterable into a std::string, separated by `separator`. If the iterable is forward and its
+     * elements are references or views, the exact length is calculated first, so that the result is allocated once. Example:
+     * ```cpp
+     * std::vector<std::string> vec = { "a", "b", "c" };
+     * std::string joined = vec | lz::join_to_string(", "); // "a, b, c"
+     * ```
+     * @param separator The separator to use between the strings.
+     * @return An adaptor that can be used in pipe expressions
+     */
+    LZ_NODISCARD fn_args_holder<adaptor, string_view> operator()(const string_view separator) const {
+        return { separator };
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif
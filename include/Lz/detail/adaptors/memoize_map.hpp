@@ -0,0 +1,64 @@
+#pragma once
+
+#ifndef LZ_MEMOIZE_MAP_ADAPTOR_HPP
+#define LZ_MEMOIZE_MAP_ADAPTOR_HPP
+
+#include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/iterables/memoize_map.hpp>
+
+namespace lz {
+namespace detail {
+struct memoize_map_adaptor {
+    using adaptor = memoize_map_adaptor;
+
+    /**
+     * @brief Applies a function to each element in an iterable, like `lz::map`, but stores the results, so that the function
+     * is called at most once per element, no matter how many times an element is dereferenced or how many times the iterable
+     * is traversed. Useful for expensive functions in combination with multi pass iterables, such as `lz::pairwise`,
+     * `lz::chunks` or `lz::cartesian_product`. For random access iterables, the results are stored in a buffer that is
+     * allocated once (with one slot per element), the first time an element is dereferenced. For forward iterables, the
+     * results are stored in a deque that grows with the furthest position that was dereferenced. The iterator category is
+     * random access if the input iterable is random access, forward otherwise. The input iterable must be forward or stronger.
+     * Its iterator returns a const reference to the stored result. The results are shared by all copies of this iterable and
+     * are not thread safe. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto memoized = lz::memoize_map(vec, [](int i) { return expensive(i); });
+     * auto pairs = lz::pairwise(memoized, 2); // expensive is called once per element
+     * ```
+     * @param iterable The iterable to apply the function to
+     * @param function The function to apply to each element in the iterable
+     * @return A memoize_map_iterable that applies the function to each element in the iterable at most once
+     */
+    template<class Iterable, class Function>
+    memoize_map_iterable<remove_ref_t<Iterable>, Function> operator()(Iterable&& iterable, Function function) const {
+        return { std::forward<Iterable>(iterable), std::move(function) };
+    }
+
+    /**
+     * @brief Applies a function to each element in an iterable, like `lz::map`, but stores the results, so that the function
+     * is called at most once per element, no matter how many times an element is dereferenced or how many times the iterable
+     * is traversed. Useful for expensive functions in combination with multi pass iterables, such as `lz::pairwise`,
+     * `lz::chunks` or `lz::cartesian_product`. For random access iterables, the results are stored in a buffer that is
+     * allocated once (with one slot per element), the first time an element is dereferenced. For forward iterables, the
+     * results are stored in a deque that grows with the furthest position that was dereferenced. The iterator category is
+     * random access if the input iterable is random access, forward otherwise. The input iterable must be forward or stronger.
+     * Its iterator returns a const reference to the stored result. The results are shared by all copies of this iterable and
+     * are not thread safe. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto memoized = vec | lz::memoize_map([](int i) { return expensive(i); });
+     * auto pairs = memoized | lz::pairwise(2); // expensive is called once per element
+     * ```
+     * @param function The function to apply to each element in the iterable
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class Function>
+    LZ_CONSTEXPR_CXX_14 fn_args_holder<adaptor, Function> operator()(Function&& function) const {
+        return { std::move(function) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
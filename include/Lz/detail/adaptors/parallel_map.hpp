@@ -0,0 +1,131 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_MAP_ADAPTOR_HPP
+#define LZ_PARALLEL_MAP_ADAPTOR_HPP
+
+#include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/iterables/parallel_map.hpp>
+#include <Lz/detail/traits/is_iterable.hpp>
+
+namespace lz {
+namespace detail {
+template<bool Ordered>
+struct parallel_map_adaptor {
+    using adaptor = parallel_map_adaptor<Ordered>;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    /**
+     * @brief Applies a function to each element in an iterable, like `lz::map`, but evaluates the function on @p threads worker
+     * threads, ahead of the consumer. At most @p window elements are pulled from the input iterable ahead of the element that is
+     * currently being consumed, so memory usage is bounded. Elements of the input iterable are pulled one at a time and copied
+     * before they are passed to the function, the function itself may be called concurrently and must therefore be thread safe.
+     * `lz::parallel_map` yields the results in input order, `lz::unordered_parallel_map` yields them in order of completion.
+     * The worker threads are started when calling begin() and are stopped when the last copy of the iterator is destroyed.
+     * Exceptions thrown by the function are rethrown when incrementing the iterator. Its iterator category is input, its end()
+     * function returns a sentinel and it contains a .size() method if the input iterable is sized. Example:
+     * ```cpp
+     * std::vector<std::string> lines = { "1", "2", "3" };
+     * // uses 4 threads, with at most 16 elements in flight
+     * auto parsed = lz::parallel_map(lines, [](const std::string& s) { return std::stoi(s); }, 4, 16); // { 1, 2, 3 }
+     * ```
+     * @param iterable The iterable to apply the function to
+     * @param unary_op The function to apply to each element in the iterable. Must be safe to call concurrently
+     * @param threads The amount of worker threads. 0 (the default) uses `std::thread::hardware_concurrency()`
+     * @param window The maximum amount of elements that are pulled ahead of the consumer. 0 (the default) uses 4 * threads
+     * @return An iterable that applies the function to each element in the iterable, in parallel
+     */
+    template<class Iterable, class UnaryOp>
+    [[nodiscard]] constexpr parallel_map_iterable<remove_ref_t<Iterable>, UnaryOp, Ordered>
+    operator()(Iterable&& iterable, UnaryOp unary_op, const size_t threads = 0, const size_t window = 0) const
+        requires(lz::iterable<Iterable>)
+    {
+        return { std::forward<Iterable>(iterable), std::move(unary_op), threads, window };
+    }
+
+    /**
+     * @brief Applies a function to each element in an iterable, like `lz::map`, but evaluates the function on @p threads worker
+     * threads, ahead of the consumer. At most @p window elements are pulled from the input iterable ahead of the element that is
+     * currently being consumed, so memory usage is bounded. Elements of the input iterable are pulled one at a time and copied
+     * before they are passed to the function, the function itself may be called concurrently and must therefore be thread safe.
+     * `lz::parallel_map` yields the results in input order, `lz::unordered_parallel_map` yields them in order of completion.
+     * The worker threads are started when calling begin() and are stopped when the last copy of the iterator is destroyed.
+     * Exceptions thrown by the function are rethrown when incrementing the iterator. Its iterator category is input, its end()
+     * function returns a sentinel and it contains a .size() method if the input iterable is sized. Example:
+     * ```cpp
+     * std::vector<std::string> lines = { "1", "2", "3" };
+     * // uses 4 threads, with at most 16 elements in flight
+     * auto parsed = lines | lz::parallel_map([](const std::string& s) { return std::stoi(s); }, 4, 16); // { 1, 2, 3 }
+     * ```
+     * @param unary_op The function to apply to each element in the iterable. Must be safe to call concurrently
+     * @param threads The amount of worker threads. 0 (the default) uses `std::thread::hardware_concurrency()`
+     * @param window The maximum amount of elements that are pulled ahead of the consumer. 0 (the default) uses 4 * threads
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class UnaryOp>
+    [[nodiscard]] constexpr fn_args_holder<adaptor, UnaryOp, size_t, size_t>
+    operator()(UnaryOp unary_op, const size_t threads = 0, const size_t window = 0) const
+        requires(!lz::iterable<UnaryOp>)
+    {
+        return { std::move(unary_op), threads, window };
+    }
+
+#else
+
+    /**
+     * @brief Applies a function to each element in an iterable, like `lz::map`, but evaluates the function on @p threads worker
+     * threads, ahead of the consumer. At most @p window elements are pulled from the input iterable ahead of the element that is
+     * currently being consumed, so memory usage is bounded. Elements of the input iterable are pulled one at a time and copied
+     * before they are passed to the function, the function itself may be called concurrently and must therefore be thread safe.
+     * `lz::parallel_map` yields the results in input order, `lz::unordered_parallel_map` yields them in order of completion.
+     * The worker threads are started when calling begin() and are stopped when the last copy of the iterator is destroyed.
+     * Exceptions thrown by the function are rethrown when incrementing the iterator. Its iterator category is input, its end()
+     * function returns a sentinel and it contains a .size() method if the input iterable is sized. Example:
+     * ```cpp
+     * std::vector<std::string> lines = { "1", "2", "3" };
+     * // uses 4 threads, with at most 16 elements in flight
+     * auto parsed = lz::parallel_map(lines, [](const std::string& s) { return std::stoi(s); }, 4, 16); // { 1, 2, 3 }
+     * ```
+     * @param iterable The iterable to apply the function to
+     * @param unary_op The function to apply to each element in the iterable. Must be safe to call concurrently
+     * @param threads The amount of worker threads. 0 (the default) uses `std::thread::hardware_concurrency()`
+     * @param window The maximum amount of elements that are pulled ahead of the consumer. 0 (the default) uses 4 * threads
+     * @return An iterable that applies the function to each element in the iterable, in parallel
+     */
+    template<class Iterable, class UnaryOp>
+    LZ_NODISCARD constexpr enable_if_t<is_iterable<Iterable>::value, parallel_map_iterable<remove_ref_t<Iterable>, UnaryOp, Ordered>>
+    operator()(Iterable&& iterable, UnaryOp unary_op, const size_t threads = 0, const size_t window = 0) const {
+        return { std::forward<Iterable>(iterable), std::move(unary_op), threads, window };
+    }
+
+    /**
+     * @brief Applies a function to each element in an iterable, like `lz::map`, but evaluates the function on @p threads worker
+     * threads, ahead of the consumer. At most @p window elements are pulled from the input iterable ahead of the element that is
+     * currently being consumed, so memory usage is bounded. Elements of the input iterable are pulled one at a time and copied
+     * before they are passed to the function, the function itself may be called concurrently and must therefore be thread safe.
+     * `lz::parallel_map` yields the results in input order, `lz::unordered_parallel_map` yields them in order of completion.
+     * The worker threads are started when calling begin() and are stopped when the last copy of the iterator is destroyed.
+     * Exceptions thrown by the function are rethrown when incrementing the iterator. Its iterator category is input, its end()
+     * function returns a sentinel and it contains a .size() method if the input iterable is sized. Example:
+     * ```cpp
+     * std::vector<std::string> lines = { "1", "2", "3" };
+     * // uses 4 threads, with at most 16 elements in flight
+     * auto parsed = lines | lz::parallel_map([](const std::string& s) { return std::stoi(s); }, 4, 16); // { 1, 2, 3 }
+     * ```
+     * @param unary_op The function to apply to each element in the iterable. Must be safe to call concurrently
+     * @param threads The amount of worker threads. 0 (the default) uses `std::thread::hardware_concurrency()`
+     * @param window The maximum amount of elements that are pulled ahead of the consumer. 0 (the default) uses 4 * threads
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class UnaryOp>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 enable_if_t<!is_iterable<UnaryOp>::value, fn_args_holder<adaptor, UnaryOp, size_t, size_t>>
+    operator()(UnaryOp unary_op, const size_t threads = 0, const size_t window = 0) const {
+        return { std::move(unary_op), threads, window };
+    }
+
+#endif
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PARALLEL_MAP_ADAPTOR_HPP
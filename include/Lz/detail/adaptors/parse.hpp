@@ -0,0 +1,78 @@
+#pragma once
+
+#ifndef LZ_PARSE_ADAPTOR_HPP
+#define LZ_PARSE_ADAPTOR_HPP
+
+#include <Lz/detail/iterables/map.hpp>
+#include <Lz/detail/procs/parse_number.hpp>
+#include <Lz/detail/traits/string_traits.hpp>
+#include <Lz/util/optional.hpp>
+#include <Lz/util/string_view.hpp>
+
+namespace lz {
+namespace detail {
+
+template<class T>
+struct parse_fn {
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                  "lz::parse can only parse integral (except bool) and floating point types");
+
+    LZ_NODISCARD optional<T> operator()(const string_view str) const {
+        T result{};
+        if (parse_number(str.data(), str.data() + str.size(), result)) {
+            return result;
+        }
+        return nullopt;
+    }
+
+    // For contiguous strings that are not convertible to lz::string_view, such as std::string if lz::string_view is not
+    // std::string_view
+    template<class String>
+    LZ_NODISCARD enable_if_t<has_data_and_size<String>::value && !std::is_convertible<const String&, string_view>::value,
+                             optional<T>>
+    operator()(const String& str) const {
+        return (*this)(string_view{ str.data(), str.size() });
+    }
+
+    // For types that contain a string, such as lz::csv_field
+    template<class Field>
+    LZ_NODISCARD enable_if_t<has_string_value<Field>::value && !has_data_and_size<Field>::value &&
+                                 !std::is_convertible<const Field&, string_view>::value,
+                             optional<T>>
+    operator()(const Field& field) const {
+        return (*this)(string_view{ field.value() });
+    }
+};
+
+template<class T>
+struct parse_adaptor {
+    using adaptor = parse_adaptor<T>;
+
+    template<class Iterable>
+    using parse_iterable = map_iterable<remove_ref_t<Iterable>, parse_fn<T>>;
+
+    /**
+     * @brief Parses every string of an iterable to a number of type `T`, in base 10. Its value type is an `lz::optional<T>`,
+     * which is empty if the string is not a valid number of type `T`, or if it is out of range. Parsing uses the same syntax as
+     * `std::from_chars`. Example:
+     * ```cpp
+     * std::vector<lz::string_view> strings = { "1", "-2", "x", "300" };
+     * auto parsed = lz::parse<int>(strings); // { 1, -2, nullopt, 300 }
+     * auto parsed = lz::parse<std::uint8_t>(strings); // { 1, nullopt, nullopt, nullopt }
+     * // or, in C++11
+     * auto parsed = lz::parse<int>{}(strings); // { 1, -2, nullopt, 300 }
+     * ```
+     * @param iterable The iterable of strings to parse. Its elements must be convertible to `lz::string_view`, or have a
+     * `value()` method that returns one, such as lz::csv_field.
+     * @return A map_iterable that parses every string of the iterable.
+     */
+    template<class Iterable>
+    LZ_NODISCARD constexpr parse_iterable<Iterable> operator()(Iterable&& iterable) const {
+        return { std::forward<Iterable>(iterable), parse_fn<T>{} };
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,94 @@
+#pragma once
+
+#ifndef LZ_PREFETCH_ASYNC_ADAPTOR_HPP
+#define LZ_PREFETCH_ASYNC_ADAPTOR_HPP
+
+#include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/iterables/prefetch_async.hpp>
+#include <Lz/detail/traits/is_iterable.hpp>
+
+namespace lz {
+namespace detail {
+struct prefetch_async_adaptor {
+    using adaptor = prefetch_async_adaptor;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    /**
+     * @brief Iterates over @p iterable on a background thread, and hands its elements to the consumer through a lock-free single
+     * producer/single consumer ring buffer of @p capacity elements. This way, the (I/O bound) stages before this adaptor run in
+     * parallel with the (CPU bound) stages after it. The elements of the input iterable are copied into the buffer. The consumer
+     * picks up all elements that have become available since its last check with a single synchronization. The background
+     * thread is started when calling begin() and is stopped when the last copy of the iterator is destroyed. Exceptions thrown
+     * by the input iterable are rethrown when incrementing the iterator. Its iterator category is input, its end() function
+     * returns a sentinel and it contains a .size() method if the input iterable is sized. Example:
+     * ```cpp
+     * std::ifstream file("numbers.txt");
+     * // reads the numbers from the file on a background thread, while `process` runs on the current thread
+     * auto numbers = lz::generate_while([&file]() { int i = 0; const bool ok = static_cast<bool>(file >> i); return std::make_pair(i, ok); });
+     * auto processed = lz::prefetch_async(numbers, 256) | lz::map(process);
+     * ```
+     * @param iterable The iterable to read ahead
+     * @param capacity The maximum amount of elements that are read ahead. Defaults to 1024
+     * @return An iterable that reads ahead the input iterable on a background thread
+     */
+    template<class Iterable>
+    [[nodiscard]] constexpr prefetch_async_iterable<remove_ref_t<Iterable>>
+    operator()(Iterable&& iterable, const size_t capacity = 1024) const
+        requires(lz::iterable<Iterable>)
+    {
+        return { std::forward<Iterable>(iterable), capacity };
+    }
+
+#else
+
+    /**
+     * @brief Iterates over @p iterable on a background thread, and hands its elements to the consumer through a lock-free single
+     * producer/single consumer ring buffer of @p capacity elements. This way, the (I/O bound) stages before this adaptor run in
+     * parallel with the (CPU bound) stages after it. The elements of the input iterable are copied into the buffer. The consumer
+     * picks up all elements that have become available since its last check with a single synchronization. The background
+     * thread is started when calling begin() and is stopped when the last copy of the iterator is destroyed. Exceptions thrown
+     * by the input iterable are rethrown when incrementing the iterator. Its iterator category is input, its end() function
+     * returns a sentinel and it contains a .size() method if the input iterable is sized. Example:
+     * ```cpp
+     * std::ifstream file("numbers.txt");
+     * // reads the numbers from the file on a background thread, while `process` runs on the current thread
+     * auto numbers = lz::generate_while([&file]() { int i = 0; const bool ok = static_cast<bool>(file >> i); return std::make_pair(i, ok); });
+     * auto processed = lz::prefetch_async(numbers, 256) | lz::map(process);
+     * ```
+     * @param iterable The iterable to read ahead
+     * @param capacity The maximum amount of elements that are read ahead. Defaults to 1024
+     * @return An iterable that reads ahead the input iterable on a background thread
+     */
+    template<class Iterable>
+    LZ_NODISCARD constexpr enable_if_t<is_iterable<Iterable>::value, prefetch_async_iterable<remove_ref_t<Iterable>>>
+    operator()(Iterable&& iterable, const size_t capacity = 1024) const {
+        return { std::forward<Iterable>(iterable), capacity };
+    }
+
+#endif
+
+    /**
+     * @brief Iterates over the input iterable on a background thread, and hands its elements to the consumer through a lock-free
+     * single producer/single consumer ring buffer of @p capacity elements. This way, the (I/O bound) stages before this adaptor
+     * run in parallel with the (CPU bound) stages after it. Its iterator category is input, its end() function returns a
+     * sentinel and it contains a .size() method if the input iterable is sized. Example:
+     * ```cpp
+     * std::ifstream file("numbers.txt");
+     * // reads the numbers from the file on a background thread, while `process` runs on the current thread
+     * auto numbers = lz::generate_while([&file]() { int i = 0; const bool ok = static_cast<bool>(file >> i); return std::make_pair(i, ok); });
+     * auto processed = numbers | lz::prefetch_async(256) | lz::map(process);
+     * // or, using the default capacity of 1024
+     * auto processed = numbers | lz::prefetch_async | lz::map(process);
+     * ```
+     * @param capacity The maximum amount of elements that are read ahead
+     * @return An adaptor that can be used in pipe expressions
+     */
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 fn_args_holder<adaptor, size_t> operator()(const size_t capacity) const {
+        return { capacity };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PREFETCH_ASYNC_ADAPTOR_HPP
@@ -4,11 +4,32 @@
 #define LZ_REGEX_SPLIT_ADAPTOR_HPP
 
 #include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/iterables/matcher_split.hpp>
 #include <Lz/detail/iterables/regex_split.hpp>
+#include <Lz/detail/traits/enable_if.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <Lz/detail/traits/string_traits.hpp>
 #include <regex>
+#include <type_traits>
+#include <utility>
 
 namespace lz {
 namespace detail {
+
+// A matcher has a `char_type` and a `find(const char_type* first, const char_type* last) const` member that returns the leftmost
+// non empty match in [first, last) as a pair of pointers, or {last, last} if there is none. For instance lz::dfa_regex
+template<class Matcher, class = void>
+struct is_regex_matcher : std::false_type {};
+
+template<class Matcher>
+using matcher_result = std::pair<const typename Matcher::char_type*, const typename Matcher::char_type*>;
+
+template<class Matcher>
+struct is_regex_matcher<Matcher, enable_if_t<std::is_convertible<decltype(std::declval<const Matcher&>().find(
+                                                                     std::declval<const typename Matcher::char_type*>(),
+                                                                     std::declval<const typename Matcher::char_type*>())),
+                                                                 matcher_result<Matcher>>::value>> : std::true_type {};
+
 struct regex_split_adaptor {
     using adaptor = regex_split_adaptor;
 
@@ -39,6 +60,16 @@ struct regex_split_adaptor {
         return (*this)(std::move(first), token_iter{});
     }
 
+    // Temporary strings are destroyed before the split strings are used
+    template<class String, class = enable_if_t<!is_borrowable_string<String>::value>>
+    regex_split_iterable<regex_it<String>, regex_it<String>>
+    operator()(String&& s, const std::basic_regex<typename remove_cvref_t<String>::value_type>& regex) const {
+        static_assert(is_borrowable_string<String>::value,
+                      "Can only bind to lvalues. Check if you are passing a temporary string. Only string views, pointers and "
+                      "lazy views can be passed as temporaries.");
+        return (*this)(static_cast<const String&>(s), regex);
+    }
+
     /**
      * @brief Splits a string based on a regex. The regex must be by reference. The `begin()` and `end()` types are different, but
      * `end()` of type `RegexTokenIterator`. For std::regex, this means `end() == std::regex_token_iterator<>{}` and `begin() =
@@ -73,10 +104,78 @@ struct regex_split_adaptor {
      * @return An iterable that can be used to iterate over the split strings
      */
     template<class RegexTokenIter, class RegexTokenSentinel>
-    LZ_NODISCARD regex_split_iterable<RegexTokenIter, RegexTokenSentinel>
+    LZ_NODISCARD
+    enable_if_t<!is_regex_matcher<RegexTokenSentinel>::value, regex_split_iterable<RegexTokenIter, RegexTokenSentinel>>
     operator()(RegexTokenIter first, RegexTokenSentinel last) const {
         return { std::move(first), std::move(last) };
     }
+
+    /**
+     * @brief Splits a contiguous string using a matcher, instead of std::regex. A matcher is a type with a `char_type` and a
+     * `find(const char_type* first, const char_type* last) const` member, that returns the leftmost non empty match in
+     * [first, last) as a `std::pair<const char_type*, const char_type*>`, or `{ last, last }` if there is none. `lz::dfa_regex`
+     * is a built-in matcher, which matches in a single pass per attempt without backtracking or allocating. The matcher must be
+     * by reference. Like with std::regex, empty strings at the start and end are skipped. Its `end()` function returns a
+     * sentinel, it does not contain a .size() method and its iterator category is forward. Example:
+     * ```cpp
+     * lz::dfa_regex regex(R"(\s+)");
+     * std::string s = "    Hello, world! How are you?";
+     * auto splitter = lz::regex_split(s, regex); // { "Hello,", "world!", "How", "are", "you?" }
+     * ```
+     * @param s The string to split, must have a `data()` and `size()` member
+     * @param matcher The matcher to use to split the string with
+     * @return An iterable that can be used to iterate over the split strings
+     */
+    template<class String, class Matcher>
+    LZ_NODISCARD enable_if_t<is_regex_matcher<Matcher>::value, matcher_split_iterable<Matcher>>
+    operator()(const String& s, const Matcher& matcher) const {
+        return { matcher, s.data(), s.data() + s.size() };
+    }
+
+    // Temporary strings and matchers are destroyed before the split strings are used
+    template<class String, class Matcher>
+    enable_if_t<is_regex_matcher<remove_cvref_t<Matcher>>::value &&
+                    (!is_borrowable_string<String>::value || !std::is_lvalue_reference<Matcher>::value),
+                matcher_split_iterable<remove_cvref_t<Matcher>>>
+    operator()(String&& s, Matcher&& matcher) const {
+        static_assert(is_borrowable_string<String>::value,
+                      "Can only bind to lvalues. Check if you are passing a temporary string. Only string views, pointers and "
+                      "lazy views can be passed as temporaries.");
+        static_assert(std::is_lvalue_reference<Matcher>::value,
+                      "Can only bind to lvalues. Check if you are passing a temporary matcher.");
+        return (*this)(static_cast<const remove_ref_t<String>&>(s), static_cast<const remove_ref_t<Matcher>&>(matcher));
+    }
+
+    /**
+     * @brief Splits a contiguous string using a matcher, instead of std::regex. A matcher is a type with a `char_type` and a
+     * `find(const char_type* first, const char_type* last) const` member, that returns the leftmost non empty match in
+     * [first, last) as a `std::pair<const char_type*, const char_type*>`, or `{ last, last }` if there is none. `lz::dfa_regex`
+     * is a built-in matcher, which matches in a single pass per attempt without backtracking or allocating. The matcher must be
+     * by reference. Like with std::regex, empty strings at the start and end are skipped. Its `end()` function returns a
+     * sentinel, it does not contain a .size() method and its iterator category is forward. Example:
+     * ```cpp
+     * lz::dfa_regex regex(R"(\s+)");
+     * std::string s = "    Hello, world! How are you?";
+     * auto splitter = s | lz::regex_split(regex); // { "Hello,", "world!", "How", "are", "you?" }
+     * ```
+     * @param matcher The matcher to use to split the string with
+     * @return An adaptor that can be used in pipe expressions
+     */
+    template<class Matcher>
+    LZ_NODISCARD enable_if_t<is_regex_matcher<Matcher>::value, fn_args_holder<adaptor, const Matcher&>>
+    operator()(const Matcher& matcher) const {
+        return { matcher };
+    }
+
+    // Temporary matchers are destroyed before the split strings are used
+    template<class Matcher>
+    enable_if_t<!std::is_lvalue_reference<Matcher>::value && is_regex_matcher<Matcher>::value,
+                fn_args_holder<adaptor, const Matcher&>>
+    operator()(Matcher&& matcher) const {
+        static_assert(std::is_lvalue_reference<Matcher>::value,
+                      "Can only bind to lvalues. Check if you are passing a temporary matcher.");
+        return { matcher };
+    }
 };
 } // namespace detail
 } // namespace lz
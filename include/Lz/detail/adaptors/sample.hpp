@@ -0,0 +1,94 @@
+#pragma once
+
+#ifndef LZ_SAMPLE_ADAPTOR_HPP
+#define LZ_SAMPLE_ADAPTOR_HPP
+
+#include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/iterables/sample.hpp>
+#include <Lz/detail/traits/is_iterable.hpp>
+#include <cstdint>
+#include <random>
+
+namespace lz {
+namespace detail {
+
+inline std::uint64_t random_seed() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32u) ^ device();
+}
+
+struct sample_adaptor {
+    using adaptor = sample_adaptor;
+
+    /**
+     * @brief Picks @p k random elements of the input iterable, using reservoir sampling. The input iterable is traversed once, when
+     * this function is called, and may be an input iterable of unknown size. Elements that are not picked are skipped without
+     * dereferencing them, in O(1) for random access iterables. The picked elements are copied into a vector that is shared by all
+     * copies of the result, in an unspecified order. If the input iterable has less than @p k elements, all of them are picked.
+     * The result is random access and contains a .size() method. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto sample = lz::sample(vec, 2, 42); // sample = { 1, 5 } (2 random elements, always the same for seed 42)
+     * ```
+     * @param iterable The iterable to pick the elements from.
+     * @param k The amount of elements to pick.
+     * @param seed The seed of the random numbers.
+     * @return A sample_iterable containing the picked elements.
+     */
+    template<class Iterable>
+    LZ_NODISCARD sample_iterable<remove_ref_t<Iterable>>
+    operator()(Iterable&& iterable, const size_t k, const std::uint64_t seed) const {
+        return { std::forward<Iterable>(iterable), k, seed };
+    }
+
+    /**
+     * @brief Picks @p k random elements of the input iterable, using reservoir sampling, with a seed from std::random_device. See
+     * the other overload for more information. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto sample = lz::sample(vec, 2); // sample = { 5, 2 } (2 random elements)
+     * ```
+     * @param iterable The iterable to pick the elements from.
+     * @param k The amount of elements to pick.
+     * @return A sample_iterable containing the picked elements.
+     */
+    template<class Iterable>
+    LZ_NODISCARD enable_if_t<is_iterable<Iterable>::value, sample_iterable<remove_ref_t<Iterable>>>
+    operator()(Iterable&& iterable, const size_t k) const {
+        return { std::forward<Iterable>(iterable), k, random_seed() };
+    }
+
+    /**
+     * @brief Picks @p k random elements of the input iterable, using reservoir sampling. See the other overload for more
+     * information. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto sample = vec | lz::sample(2, 42); // sample = { 1, 5 } (2 random elements, always the same for seed 42)
+     * ```
+     * @param k The amount of elements to pick.
+     * @param seed The seed of the random numbers.
+     * @return An adaptor that can be used in pipe expressions
+     */
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 fn_args_holder<adaptor, size_t, std::uint64_t>
+    operator()(const size_t k, const std::uint64_t seed) const {
+        return { k, seed };
+    }
+
+    /**
+     * @brief Picks @p k random elements of the input iterable, using reservoir sampling, with a seed from std::random_device. See
+     * the other overload for more information. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto sample = vec | lz::sample(2); // sample = { 5, 2 } (2 random elements)
+     * ```
+     * @param k The amount of elements to pick.
+     * @return An adaptor that can be used in pipe expressions
+     */
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 fn_args_holder<adaptor, size_t> operator()(const size_t k) const {
+        return { k };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+
+#ifndef LZ_SHUFFLED_ADAPTOR_HPP
+#define LZ_SHUFFLED_ADAPTOR_HPP
+
+#include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/iterables/shuffled.hpp>
+#include <cstdint>
+
+namespace lz {
+namespace detail {
+struct shuffled_adaptor {
+    using adaptor = shuffled_adaptor;
+
+    /**
+     * @brief Iterates over the input iterable in a random order, without copying or modifying it. The i-th element is the element
+     * at a position that a keyed bijection (a Feistel network) maps i to, so it uses O(1) extra memory, even for huge iterables.
+     * The same seed and size always give the same order. The input iterable must be random access and sized. The result is random
+     * access, contains a .size() method and does not have a sentinel. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto shuffled = lz::shuffled(vec, 42); // shuffled = { 2, 1, 5, 3, 4 } (a permutation of vec, always the same for 42)
+     * auto shuffled = lz::shuffled(lz::range(std::int64_t{ 1000000000 }), 42); // Only O(1) memory
+     * ```
+     * @param iterable The random access, sized iterable to shuffle.
+     * @param seed The seed of the permutation.
+     * @return A shuffled_iterable that can be used to iterate over the elements in random order.
+     */
+    template<class Iterable>
+    LZ_NODISCARD constexpr shuffled_iterable<remove_ref_t<Iterable>>
+    operator()(Iterable&& iterable, const std::uint64_t seed) const {
+        return { std::forward<Iterable>(iterable), seed };
+    }
+
+    /**
+     * @brief Iterates over the input iterable in a random order, without copying or modifying it. The i-th element is the element
+     * at a position that a keyed bijection (a Feistel network) maps i to, so it uses O(1) extra memory, even for huge iterables.
+     * The same seed and size always give the same order. The input iterable must be random access and sized. The result is random
+     * access, contains a .size() method and does not have a sentinel. Example:
+     * ```cpp
+     * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+     * auto shuffled = vec | lz::shuffled(42); // shuffled = { 2, 1, 5, 3, 4 } (a permutation of vec, always the same for 42)
+     * auto shuffled = lz::range(std::int64_t{ 1000000000 }) | lz::shuffled(42); // Only O(1) memory
+     * ```
+     * @param seed The seed of the permutation.
+     * @return An adaptor that can be used in pipe expressions
+     */
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 fn_args_holder<adaptor, std::uint64_t> operator()(const std::uint64_t seed) const {
+        return { seed };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -4,6 +4,7 @@
 #define LZ_SPLIT_ADAPTOR_HPP
 
 #include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/char_set.hpp>
 #include <Lz/detail/iterables/split.hpp>
 #include <Lz/util/string_view.hpp>
 
@@ -487,6 +488,33 @@ struct split_adaptor<void> {
     }
 };
 
+template<class CharSet>
+struct split_any_adaptor {
+    using adaptor = split_any_adaptor<CharSet>;
+
+    template<class Iterable>
+    using splitter_iterable = split_iterable<basic_string_view<val_iterable_t<Iterable>>, remove_ref_t<Iterable>, CharSet>;
+
+    /**
+     * @brief Splits a contiguous string on any of the delimiters, which are known at compile time. Characters are classified
+     * using a mask that is computed at compile time, so multiple delimiters are handled in a single pass at the same cost as
+     * one. Like lz::sv_split, consecutive delimiters result in empty strings. It returns a forward iterable of string views, its
+     * end() method returns a default_sentinel_t and the iterable does not contain a .size() method. Example:
+     * ```cpp
+     * std::string str = "a b\tc\nd";
+     * auto splitted = lz::split_any<' ', '\t', '\n'>(str); // {"a", "b", "c", "d"}
+     * // or, in C++11
+     * auto splitted = lz::split_any<' ', '\t', '\n'>{}(str); // {"a", "b", "c", "d"}
+     * ```
+     * @param iterable The contiguous string to split. Must be an actual reference.
+     * @return A split_iterable that splits the iterable on any of the delimiters.
+     */
+    template<class Iterable>
+    LZ_NODISCARD constexpr splitter_iterable<Iterable> operator()(Iterable&& iterable) const {
+        return { std::forward<Iterable>(iterable), CharSet{} };
+    }
+};
+
 } // namespace detail
 } // namespace lz
 
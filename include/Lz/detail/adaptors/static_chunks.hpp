@@ -0,0 +1,37 @@
+#pragma once
+
+#ifndef LZ_STATIC_CHUNKS_ADAPTOR_HPP
+#define LZ_STATIC_CHUNKS_ADAPTOR_HPP
+
+#include <Lz/detail/iterables/static_chunks.hpp>
+
+namespace lz {
+namespace detail {
+template<size_t N>
+struct static_chunks_adaptor {
+    using adaptor = static_chunks_adaptor<N>;
+
+    /**
+     * @brief Chunks an iterable into chunks of exactly @p N elements, where @p N is known at compile time. Every chunk is
+     * returned by value as a `std::array<T, N>`, so that the chunks can be processed with loops of a fixed length (that can be
+     * unrolled by the compiler). Elements that do not fill a complete chunk are not returned. The iterator category is random
+     * access if the input iterable is random access, forward otherwise. Its end() function returns a sentinel if the input
+     * iterable is not random access or has a sentinel. If the input iterable has a .size() method, then this iterable will
+     * also have a .size() method. If the size of the input iterable is known at compile time, `lz::static_size` is also known
+     * for this iterable. Example:
+     * ```cpp
+     * std::array<int, 7> arr = { 1, 2, 3, 4, 5, 6, 7 };
+     * auto chunked = lz::static_chunks<3>(arr); // { std::array<int, 3>{ 1, 2, 3 }, std::array<int, 3>{ 4, 5, 6 } }
+     * ```
+     * @param iterable The iterable to chunk
+     * @return An iterable of `std::array<T, N>` chunks
+     */
+    template<class Iterable>
+    LZ_NODISCARD constexpr static_chunks_iterable<remove_ref_t<Iterable>, N> operator()(Iterable&& iterable) const {
+        return static_chunks_iterable<remove_ref_t<Iterable>, N>{ std::forward<Iterable>(iterable) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
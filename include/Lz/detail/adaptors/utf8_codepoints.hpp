@@ -0,0 +1,77 @@
+#pragma once
+
+#ifndef LZ_UTF8_CODEPOINTS_ADAPTOR_HPP
+#define LZ_UTF8_CODEPOINTS_ADAPTOR_HPP
+
+#include <Lz/detail/iterables/c_string.hpp>
+#include <Lz/detail/iterables/utf8_codepoints.hpp>
+#include <Lz/detail/traits/enable_if.hpp>
+#include <Lz/detail/traits/string_traits.hpp>
+
+namespace lz {
+namespace detail {
+struct utf8_codepoints_adaptor {
+    using adaptor = utf8_codepoints_adaptor;
+
+    /**
+     * @brief Decodes a UTF-8 string to its code points (char32_t). Ill formed sequences are decoded as U+FFFD, one for every
+     * maximal ill formed subpart, as recommended by the Unicode standard. ASCII characters take a fast path. The string must
+     * outlive the iterable. The result is a forward iterable, does not contain a .size() method and does not have a sentinel.
+     * Example:
+     * ```cpp
+     * std::string str = "h\xC3\xA9!"; // "h\u00E9!"
+     * auto codepoints = lz::utf8_codepoints(str); // { U'h', U'\u00E9', U'!' }
+     * ```
+     * @param str The string to decode, must have a `data()` and `size()` member, such as `std::string` or `lz::string_view`.
+     * @return An iterable of code points.
+     */
+    template<class String>
+    LZ_NODISCARD utf8_codepoints_iterable<const char*> operator()(const String& str) const noexcept {
+        return { str.data(), str.data() + str.size() };
+    }
+
+    // Temporary strings are destroyed before the code points are decoded
+    template<class String, class = enable_if_t<!is_borrowable_string<String>::value>>
+    utf8_codepoints_iterable<const char*> operator()(String&& str) const noexcept {
+        static_assert(is_borrowable_string<String>::value,
+                      "Can only bind to lvalues. Check if you are passing a temporary string. Only string views, pointers and "
+                      "lazy views can be passed as temporaries.");
+        return (*this)(static_cast<const String&>(str));
+    }
+
+    /**
+     * @brief Decodes a null terminated UTF-8 string to its code points (char32_t), without calculating its length first. Ill
+     * formed sequences are decoded as U+FFFD, one for every maximal ill formed subpart, as recommended by the Unicode standard.
+     * ASCII characters take a fast path. The result is a forward iterable, does not contain a .size() method and its end()
+     * method returns a default_sentinel_t. Example:
+     * ```cpp
+     * auto codepoints = lz::utf8_codepoints("h\xC3\xA9!"); // { U'h', U'\u00E9', U'!' }
+     * ```
+     * @param str The null terminated string to decode.
+     * @return An iterable of code points.
+     */
+    template<class C>
+    LZ_NODISCARD constexpr utf8_codepoints_iterable<default_sentinel_t> operator()(C* str) const noexcept {
+        return { str, default_sentinel_t{} };
+    }
+
+    /**
+     * @brief Decodes a null terminated UTF-8 string, created by lz::c_string, to its code points (char32_t). Ill formed sequences
+     * are decoded as U+FFFD, one for every maximal ill formed subpart, as recommended by the Unicode standard. ASCII characters
+     * take a fast path. The result is a forward iterable, does not contain a .size() method and its end() method returns a
+     * default_sentinel_t. Example:
+     * ```cpp
+     * auto codepoints = lz::c_string("h\xC3\xA9!") | lz::utf8_codepoints; // { U'h', U'\u00E9', U'!' }
+     * ```
+     * @param str The c_string iterable to decode.
+     * @return An iterable of code points.
+     */
+    template<class C>
+    LZ_NODISCARD utf8_codepoints_iterable<default_sentinel_t> operator()(const c_string_iterable<C>& str) const noexcept {
+        return { str.begin().operator->(), default_sentinel_t{} };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -6,6 +6,8 @@
 #include <Lz/detail/procs/get_end.hpp>
 #include <Lz/detail/traits/iterator_categories.hpp>
 #include <Lz/detail/traits/std_algo_compat.hpp>
+#include <Lz/detail/traits/void.hpp>
+#include <utility>
 
 #ifndef LZ_HAS_CXX_17
 #include <Lz/detail/traits/enable_if.hpp>
@@ -14,6 +16,16 @@
 namespace lz {
 namespace detail {
 
+// Iterables that can write all of their elements faster than through their iterators (for instance lz::random, which generates
+// its values in one tight loop) have a `copy_to(OutputIterator)` member, which is used by lz::copy and lz::to
+template<class Iterable, class OutputIterator, class = void>
+struct has_copy_to : std::false_type {};
+
+template<class Iterable, class OutputIterator>
+struct has_copy_to<Iterable, OutputIterator,
+                   void_t<decltype(std::declval<const Iterable&>().copy_to(std::declval<OutputIterator>()))>>
+    : std::true_type {};
+
 #ifdef LZ_HAS_CXX_17
 
 template<class Iterator, class S, class OutputIterator>
@@ -0,0 +1,94 @@
+#pragma once
+
+#ifndef LZ_CHAR_SET_HPP
+#define LZ_CHAR_SET_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <cstdint>
+#include <type_traits>
+
+namespace lz {
+namespace detail {
+
+template<class CharT, CharT... Chars>
+struct char_set_mask;
+
+template<class CharT>
+struct char_set_mask<CharT> {
+    static constexpr std::uint64_t word(const std::uint_fast32_t) noexcept {
+        return 0;
+    }
+
+    static constexpr bool any_equal(const CharT) noexcept {
+        return false;
+    }
+};
+
+template<class CharT, CharT First, CharT... Rest>
+struct char_set_mask<CharT, First, Rest...> {
+    static constexpr std::uint_fast32_t code(const typename std::make_unsigned<CharT>::type c) noexcept {
+        return c;
+    }
+
+    // The w-th 64 bit word of the 256 bit mask of all characters below 256
+    static constexpr std::uint64_t word(const std::uint_fast32_t w) noexcept {
+        return (code(static_cast<typename std::make_unsigned<CharT>::type>(First)) / 64 == w
+                    ? std::uint64_t{ 1 } << (code(static_cast<typename std::make_unsigned<CharT>::type>(First)) % 64)
+                    : std::uint64_t{ 0 }) |
+               char_set_mask<CharT, Rest...>::word(w);
+    }
+
+    static constexpr bool any_equal(const CharT c) noexcept {
+        return c == First || char_set_mask<CharT, Rest...>::any_equal(c);
+    }
+};
+
+/**
+ * A set of characters known at compile time, used as delimiter by lz::split_any. Characters below 256 are classified using a
+ * 256 bit mask that is computed at compile time, so classifying a character costs the same for one delimiter as for many.
+ * Compares equal to every character in the set.
+ */
+template<class CharT, CharT... Chars>
+struct char_set {
+    static_assert(sizeof...(Chars) > 0, "A char_set must contain at least one character");
+
+private:
+    using mask = char_set_mask<CharT, Chars...>;
+    using unsigned_char_type = typename std::make_unsigned<CharT>::type;
+
+    template<std::uint_fast32_t W>
+    using word = std::integral_constant<std::uint64_t, mask::word(W)>;
+
+    static constexpr bool test(const std::uint_fast32_t code) noexcept {
+        return (((code < 64 ? word<0>::value : code < 128 ? word<1>::value : code < 192 ? word<2>::value : word<3>::value) >>
+                 (code % 64)) &
+                1) != 0;
+    }
+
+public:
+    LZ_NODISCARD static constexpr bool contains(const CharT c) noexcept {
+        return mask::code(static_cast<unsigned_char_type>(c)) < 256 ? test(mask::code(static_cast<unsigned_char_type>(c)))
+                                                                    : mask::any_equal(c);
+    }
+
+    LZ_NODISCARD friend constexpr bool operator==(const CharT c, char_set) noexcept {
+        return contains(c);
+    }
+
+    LZ_NODISCARD friend constexpr bool operator==(char_set, const CharT c) noexcept {
+        return contains(c);
+    }
+
+    LZ_NODISCARD friend constexpr bool operator!=(const CharT c, char_set set) noexcept {
+        return !(c == set);
+    }
+
+    LZ_NODISCARD friend constexpr bool operator!=(char_set set, const CharT c) noexcept {
+        return !(set == c);
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_CHAR_SET_HPP
@@ -0,0 +1,159 @@
+#pragma once
+
+#ifndef LZ_CHUNKED_BUFFER_HPP
+#define LZ_CHUNKED_BUFFER_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+/**
+ * Strategy for lz::to to convert unsized iterables. The elements are first appended to a chain of chunks of `chunk_size`
+ * elements each, allocated with @p Allocator (for instance an allocator that uses an arena). When the iterable is exhausted,
+ * the container is reserved once with the exact size and the elements are moved into it, chunk by chunk. Every chunk is freed
+ * as soon as it is moved, so the container never overshoots its size and no element is moved more than once.
+ */
+template<class Allocator = void>
+class chunked_buffering {
+    size_t _chunk_size;
+    Allocator _allocator;
+
+public:
+    chunked_buffering(const size_t chunk_size, Allocator allocator) :
+        _chunk_size{ chunk_size },
+        _allocator{ std::move(allocator) } {
+        LZ_ASSERT(chunk_size != 0, "Chunk size must be greater than 0");
+    }
+
+    LZ_NODISCARD size_t chunk_size() const noexcept {
+        return _chunk_size;
+    }
+
+    LZ_NODISCARD const Allocator& allocator() const noexcept {
+        return _allocator;
+    }
+};
+
+template<>
+class chunked_buffering<void> {
+    size_t _chunk_size{ 1024 };
+
+public:
+    constexpr chunked_buffering() = default;
+
+    LZ_CONSTEXPR_CXX_14 explicit chunked_buffering(const size_t chunk_size) noexcept : _chunk_size{ chunk_size } {
+        LZ_ASSERT(chunk_size != 0, "Chunk size must be greater than 0");
+    }
+
+    LZ_NODISCARD constexpr size_t chunk_size() const noexcept {
+        return _chunk_size;
+    }
+
+    LZ_NODISCARD std::allocator<unsigned char> allocator() const noexcept {
+        return {};
+    }
+};
+
+/**
+ * Strategy for lz::to to convert unsized iterables. The iterable is traversed twice: once to count its elements, so that the
+ * container can be reserved with the exact size, and once to copy them. Only useful for multipass iterables that are cheap
+ * to traverse.
+ */
+struct exact_count_t {};
+
+/**
+ * A chain of fixed size chunks that elements can be appended to without ever moving the elements that were appended before.
+ */
+template<class T, class Allocator>
+class chunked_buffer {
+    using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using traits = std::allocator_traits<allocator_type>;
+
+    static_assert(std::is_same<typename traits::pointer, T*>::value, "Allocators with fancy pointers are not supported");
+
+    allocator_type _allocator;
+    std::vector<T*> _chunks{};
+    size_t _chunk_size;
+    size_t _last_chunk_size{};
+
+    void destroy_chunk(T* chunk, const size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            traits::destroy(_allocator, chunk + i);
+        }
+        traits::deallocate(_allocator, chunk, _chunk_size);
+    }
+
+    void add_chunk() {
+        _chunks.push_back(nullptr);
+        try {
+            _chunks.back() = traits::allocate(_allocator, _chunk_size);
+        }
+        catch (...) {
+            _chunks.pop_back();
+            throw;
+        }
+        _last_chunk_size = 0;
+    }
+
+    size_t chunk_count(const size_t chunk) const noexcept {
+        return chunk + 1 == _chunks.size() ? _last_chunk_size : _chunk_size;
+    }
+
+public:
+    chunked_buffer(const size_t chunk_size, const Allocator& allocator) :
+        _allocator(allocator),
+        _chunk_size{ chunk_size } {
+    }
+
+    chunked_buffer(const chunked_buffer&) = delete;
+    chunked_buffer& operator=(const chunked_buffer&) = delete;
+
+    ~chunked_buffer() {
+        for (size_t i = 0; i < _chunks.size(); ++i) {
+            destroy_chunk(_chunks[i], chunk_count(i));
+        }
+    }
+
+    template<class U>
+    void push_back(U&& value) {
+        if (_chunks.empty() || _last_chunk_size == _chunk_size) {
+            add_chunk();
+        }
+        traits::construct(_allocator, _chunks.back() + _last_chunk_size, std::forward<U>(value));
+        ++_last_chunk_size;
+    }
+
+    LZ_NODISCARD size_t size() const noexcept {
+        return _chunks.empty() ? 0 : (_chunks.size() - 1) * _chunk_size + _last_chunk_size;
+    }
+
+    /**
+     * Calls `f(first, last)` for every chunk, in order, and frees the chunk right after.
+     */
+    template<class F>
+    void drain(F f) {
+        size_t i = 0;
+        try {
+            for (; i < _chunks.size(); ++i) {
+                T* chunk = _chunks[i];
+                f(chunk, chunk + chunk_count(i));
+                destroy_chunk(chunk, chunk_count(i));
+            }
+        }
+        catch (...) {
+            _chunks.erase(_chunks.begin(), _chunks.begin() + static_cast<std::ptrdiff_t>(i));
+            throw;
+        }
+        _chunks.clear();
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_CHUNKED_BUFFER_HPP
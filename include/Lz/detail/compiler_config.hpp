@@ -74,6 +74,15 @@
   #define LZ_NODISCARD
 #endif // LZ_HAS_ATTRIBUTE(nodiscard)
 
+// GCC supports [[no_unique_address]] in all language modes, other compilers from C++20. MSVC ignores the standard attribute
+#if defined(_MSC_VER) && LZ_HAS_ATTRIBUTE(msvc::no_unique_address)
+  #define LZ_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#elif LZ_HAS_ATTRIBUTE(no_unique_address) && (defined(LZ_HAS_CXX_20) || (defined(__GNUC__) && !defined(__clang__)))
+  #define LZ_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#else
+  #define LZ_NO_UNIQUE_ADDRESS
+#endif // LZ_HAS_ATTRIBUTE(no_unique_address)
+
 #if LZ_HAS_INCLUDE(<string_view>) && (defined(LZ_HAS_CXX_17))
   #define LZ_HAS_STRING_VIEW
 #endif // has string view
@@ -82,6 +91,10 @@
   #define LZ_HAS_CONCEPTS
 #endif // Have concepts
 
+#if LZ_HAS_INCLUDE(<coroutine>) && defined(LZ_HAS_CXX_20) && defined(__cpp_impl_coroutine)
+  #define LZ_HAS_COROUTINES
+#endif // Have coroutines
+
 #ifdef __cpp_if_constexpr
   #define LZ_CONSTEXPR_IF constexpr
 #else
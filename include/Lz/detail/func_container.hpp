@@ -13,7 +13,7 @@ namespace detail {
 
 template<class Func>
 class func_container {
-    Func _func{};
+    LZ_NO_UNIQUE_ADDRESS Func _func{};
 
 public:
 #ifdef LZ_HAS_CONCEPTS
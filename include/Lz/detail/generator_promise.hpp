@@ -0,0 +1,177 @@
+#pragma once
+
+#ifndef LZ_GENERATOR_PROMISE_HPP
+#define LZ_GENERATOR_PROMISE_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+
+#ifdef LZ_HAS_COROUTINES
+
+#include <Lz/detail/procs/addressof.hpp>
+#include <concepts>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <new>
+
+namespace lz {
+namespace detail {
+
+template<class Range>
+struct elements_of_holder {
+    Range range;
+};
+
+/**
+ * State that is shared by all (nested) generators, regardless of their allocator. Every promise points to the promise of the
+ * outermost generator (the root). The root keeps track of the innermost generator that is currently running (the leaf), so
+ * that the consumer can resume the leaf directly, and of the last yielded value. This way, advancing a generator that is
+ * nested n levels deep costs O(1) instead of O(n).
+ */
+template<class T>
+class generator_promise_base {
+public:
+    const T* _value{ nullptr };
+    generator_promise_base* _root{ this };
+    // Copies of a generator share the same coroutine, which is destroyed when the last copy is destroyed
+    size_t _references{ 1 };
+    std::coroutine_handle<> _leaf{};
+    std::coroutine_handle<> _parent{};
+    std::exception_ptr _exception{};
+
+    generator_promise_base() = default;
+    generator_promise_base(const generator_promise_base&) = delete;
+    generator_promise_base& operator=(const generator_promise_base&) = delete;
+
+    std::suspend_always initial_suspend() const noexcept {
+        return {};
+    }
+
+    std::suspend_always yield_value(const T& value) noexcept {
+        // The yielded value (even if it's a temporary) lives until the coroutine is resumed, so no copy is needed
+        _root->_value = detail::addressof(value);
+        return {};
+    }
+
+    void return_void() const noexcept {
+    }
+
+    void unhandled_exception() {
+        if (_root == this) {
+            throw;
+        }
+        // Rethrown by the parent when it is resumed
+        _exception = std::current_exception();
+    }
+
+    void await_transform() = delete;
+
+    struct final_awaiter {
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        template<class Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+            auto& promise = handle.promise();
+            if (promise._parent) {
+                // Symmetric transfer back to the generator that yielded this one
+                promise._root->_leaf = promise._parent;
+                return promise._parent;
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {
+        }
+    };
+
+    final_awaiter final_suspend() const noexcept {
+        return {};
+    }
+};
+
+/**
+ * Routes the allocation of coroutine frames through @p Allocator. If the coroutine has `std::allocator_arg_t, const Alloc&` as
+ * its first parameters (or as the parameters after the object parameter, for member functions), that allocator is used.
+ * Otherwise a default constructed allocator is used. Stateful allocators are stored at the end of the frame, so they can be
+ * used to deallocate it.
+ */
+template<class Allocator>
+class generator_frame_allocator {
+    struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) block {
+        unsigned char bytes[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+    };
+
+    using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<block>;
+    using traits = std::allocator_traits<block_allocator>;
+
+    static constexpr bool stateless =
+        traits::is_always_equal::value && std::default_initializable<block_allocator>;
+
+    static constexpr size_t allocator_offset(const size_t frame_size) noexcept {
+        return (frame_size + alignof(block_allocator) - 1) & ~(alignof(block_allocator) - 1);
+    }
+
+    static constexpr size_t block_count(const size_t frame_size) noexcept {
+        const size_t bytes = stateless ? frame_size : allocator_offset(frame_size) + sizeof(block_allocator);
+        return (bytes + sizeof(block) - 1) / sizeof(block);
+    }
+
+    static block_allocator* stored_allocator(void* frame, const size_t frame_size) noexcept {
+        void* allocator = static_cast<unsigned char*>(frame) + allocator_offset(frame_size);
+        return std::launder(static_cast<block_allocator*>(allocator));
+    }
+
+    static void* allocate(block_allocator allocator, const size_t frame_size) {
+        void* frame = std::to_address(traits::allocate(allocator, block_count(frame_size)));
+        if constexpr (!stateless) {
+            ::new (static_cast<void*>(static_cast<unsigned char*>(frame) + allocator_offset(frame_size)))
+                block_allocator(std::move(allocator));
+        }
+        return frame;
+    }
+
+public:
+    static void* operator new(const size_t frame_size)
+        requires(std::default_initializable<block_allocator>)
+    {
+        return allocate(block_allocator{}, frame_size);
+    }
+
+    // GCC may report -Wmismatched-new-delete for coroutines that use this overload. This is a false positive: coroutine frames
+    // are always freed with the usual operator delete below
+    template<class Alloc, class... Args>
+    static void* operator new(const size_t frame_size, std::allocator_arg_t, const Alloc& allocator, const Args&...)
+        requires(std::convertible_to<const Alloc&, Allocator>)
+    {
+        return allocate(block_allocator(static_cast<Allocator>(allocator)), frame_size);
+    }
+
+    template<class This, class Alloc, class... Args>
+    static void* operator new(const size_t frame_size, const This&, std::allocator_arg_t, const Alloc& allocator, const Args&...)
+        requires(std::convertible_to<const Alloc&, Allocator>)
+    {
+        return allocate(block_allocator(static_cast<Allocator>(allocator)), frame_size);
+    }
+
+    static void operator delete(void* frame, const size_t frame_size) noexcept {
+        if constexpr (stateless) {
+            block_allocator allocator{};
+            traits::deallocate(allocator, static_cast<block*>(frame), block_count(frame_size));
+        }
+        else {
+            block_allocator* stored = stored_allocator(frame, frame_size);
+            block_allocator allocator(std::move(*stored));
+            stored->~block_allocator();
+            traits::deallocate(allocator, static_cast<block*>(frame), block_count(frame_size));
+        }
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_HAS_COROUTINES
+
+#endif // LZ_GENERATOR_PROMISE_HPP
@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef LZ_HASH_AGGREGATE_TABLE_HPP
+#define LZ_HASH_AGGREGATE_TABLE_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/func_container.hpp>
+#include <utility>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+/**
+ * Insert-only open addressing (linear probing) map used to aggregate values per key. Entries are stored densely in insertion
+ * order, the probing table only stores indices into the entries (+ 1, 0 meaning empty). This keeps iterating over the result
+ * as cheap as iterating a vector, regardless of how large the probing table has been reserved.
+ */
+template<class Key, class T, class Hash, class KeyEqual>
+class hash_aggregate_table {
+public:
+    using entries_type = std::vector<std::pair<Key, T>>;
+
+private:
+    entries_type _entries{};
+    std::vector<size_t> _hashes{};
+    std::vector<size_t> _slots{};
+    size_t _mask{};
+    LZ_NO_UNIQUE_ADDRESS func_container<Hash> _hash{};
+    LZ_NO_UNIQUE_ADDRESS func_container<KeyEqual> _key_equal{};
+
+    static constexpr size_t min_slots = 8;
+
+    static size_t mix(size_t hash) noexcept {
+        // Many std::hash implementations are the identity function for integers. Spread those bits before masking
+        hash ^= hash >> (sizeof(size_t) * 4);
+        hash *= static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+        return hash ^ (hash >> (sizeof(size_t) * 4));
+    }
+
+    static size_t slot_count_for(const size_t expected) noexcept {
+        // Keep the load factor at or below 0.5
+        size_t count = min_slots;
+        while (count < expected * 2) {
+            count *= 2;
+        }
+        return count;
+    }
+
+    void place(const size_t entry_index) noexcept {
+        size_t slot = _hashes[entry_index] & _mask;
+        while (_slots[slot] != 0) {
+            slot = (slot + 1) & _mask;
+        }
+        _slots[slot] = entry_index + 1;
+    }
+
+    void rehash(const size_t slot_count) {
+        _slots.assign(slot_count, 0);
+        _mask = slot_count - 1;
+        for (size_t i = 0; i < _entries.size(); ++i) {
+            place(i);
+        }
+    }
+
+public:
+    hash_aggregate_table(const size_t expected_keys, Hash hash, KeyEqual key_equal) :
+        _hash{ std::move(hash) },
+        _key_equal{ std::move(key_equal) } {
+        _entries.reserve(expected_keys);
+        _hashes.reserve(expected_keys);
+        rehash(slot_count_for(expected_keys));
+    }
+
+    /**
+     * Returns the aggregate belonging to @p key. If @p key was not yet present, it is inserted with @p init as its aggregate.
+     */
+    template<class K>
+    T& find_or_insert(K&& key, const T& init) {
+        const size_t hash = mix(static_cast<size_t>(_hash(key)));
+        size_t slot = hash & _mask;
+
+        while (_slots[slot] != 0) {
+            const size_t index = _slots[slot] - 1;
+            if (_hashes[index] == hash && _key_equal(_entries[index].first, key)) {
+                return _entries[index].second;
+            }
+            slot = (slot + 1) & _mask;
+        }
+
+        if ((_entries.size() + 1) * 2 > _slots.size()) {
+            _entries.emplace_back(std::forward<K>(key), init);
+            _hashes.push_back(hash);
+            rehash(_slots.size() * 2);
+            return _entries.back().second;
+        }
+
+        _entries.emplace_back(std::forward<K>(key), init);
+        _hashes.push_back(hash);
+        _slots[slot] = _entries.size();
+        return _entries.back().second;
+    }
+
+    LZ_NODISCARD entries_type release() noexcept {
+        _hashes.clear();
+        _slots.clear();
+        return std::move(_entries);
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_HASH_AGGREGATE_TABLE_HPP
@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef LZ_CACHED_BEGIN_ITERABLE_HPP
+#define LZ_CACHED_BEGIN_ITERABLE_HPP
+
+#include <Lz/detail/maybe_owned.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+#include <Lz/util/optional.hpp>
+#include <atomic>
+#include <mutex>
+
+namespace lz {
+namespace detail {
+template<class Iterable>
+class cached_begin_iterable : public lazy_view {
+    maybe_owned<Iterable> _iterable{};
+    // The cache is not copied, since the cached iterator may refer to the iterable it was created from
+    mutable optional<iter_t<Iterable>> _begin{};
+    mutable std::atomic<bool> _cached{ false };
+    mutable std::mutex _mutex{};
+
+public:
+    using iterator = iter_t<Iterable>;
+    using const_iterator = iterator;
+    using sentinel = sentinel_t<Iterable>;
+    using value_type = val_iterable_t<Iterable>;
+
+    static_assert(is_fwd<iterator>::value, "cache_begin requires a forward iterable, input iterables cannot be iterated twice");
+
+#ifdef LZ_HAS_CONCEPTS
+
+    cached_begin_iterable()
+        requires(std::default_initializable<maybe_owned<Iterable>>)
+    = default;
+
+#else
+
+    template<class I = decltype(_iterable), class = enable_if_t<std::is_default_constructible<I>::value>>
+    cached_begin_iterable() noexcept(std::is_nothrow_default_constructible<I>::value) {
+    }
+
+#endif
+
+    template<class I>
+    explicit cached_begin_iterable(I&& iterable) : _iterable{ std::forward<I>(iterable) } {
+    }
+
+    cached_begin_iterable(const cached_begin_iterable& other) : _iterable{ other._iterable } {
+    }
+
+    cached_begin_iterable(cached_begin_iterable&& other) noexcept(
+        std::is_nothrow_move_constructible<maybe_owned<Iterable>>::value) :
+        _iterable{ std::move(other._iterable) } {
+    }
+
+    cached_begin_iterable& operator=(const cached_begin_iterable& other) {
+        if (this != &other) {
+            _iterable = other._iterable;
+            _begin.reset();
+            _cached.store(false, std::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+    cached_begin_iterable& operator=(cached_begin_iterable&& other) {
+        if (this != &other) {
+            _iterable = std::move(other._iterable);
+            _begin.reset();
+            _cached.store(false, std::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+#ifdef LZ_HAS_CONCEPTS
+
+    [[nodiscard]] constexpr size_t size() const
+        requires(sized<Iterable>)
+    {
+        return static_cast<size_t>(_iterable.size());
+    }
+
+#else
+
+    template<class I = Iterable>
+    LZ_NODISCARD constexpr enable_if_t<is_sized<I>::value, size_t> size() const {
+        return static_cast<size_t>(_iterable.size());
+    }
+
+#endif
+
+    /**
+     * Calls begin() of the underlying iterable on the first call only. Subsequent calls return a copy of the cached iterator.
+     * Can be called concurrently from multiple threads.
+     */
+    LZ_NODISCARD iterator begin() const {
+        if (!_cached.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock{ _mutex };
+            if (!_cached.load(std::memory_order_relaxed)) {
+                _begin = _iterable.begin();
+                _cached.store(true, std::memory_order_release);
+            }
+        }
+        return *_begin;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 sentinel end() const {
+        return _iterable.end();
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
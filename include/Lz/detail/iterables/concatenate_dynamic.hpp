@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef LZ_CONCATENATE_DYNAMIC_ITERABLE_HPP
+#define LZ_CONCATENATE_DYNAMIC_ITERABLE_HPP
+
+#include <Lz/basic_iterable.hpp>
+#include <Lz/detail/iterators/concatenate_dynamic.hpp>
+#include <Lz/detail/maybe_owned.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/detail/traits/is_sized.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <Lz/procs/eager_size.hpp>
+#include <memory>
+#include <type_traits>
+
+namespace lz {
+namespace detail {
+template<class Iterable>
+class concatenate_dynamic_iterable : public lazy_view {
+    using range_ref = ref_t<iter_t<Iterable>>;
+    using range_iter = iter_t<range_ref>;
+    using segment_table = concatenate_dynamic_segments<range_iter>;
+
+    static_assert(std::is_lvalue_reference<range_ref>::value || std::is_base_of<lazy_view, remove_cvref_t<range_ref>>::value,
+                  "concat_dynamic requires an iterable that returns its iterables by reference, or lazy views by value");
+    static_assert(is_ra<range_iter>::value, "concat_dynamic requires random access iterables to concatenate");
+
+    // The segments refer to the iterables of _iterable, so it must outlive the segment table
+    maybe_owned<Iterable> _iterable{};
+    // Shared by all copies of this iterable, so that copying this iterable doesn't copy the segment table
+    std::shared_ptr<const segment_table> _segments{};
+
+    template<class I>
+    static enable_if_t<is_sized<I>::value> reserve(segment_table& table, const I& iterable) {
+        table.begins.reserve(static_cast<size_t>(lz::size(iterable)));
+        table.offsets.reserve(static_cast<size_t>(lz::size(iterable)) + 1);
+    }
+
+    template<class I>
+    static enable_if_t<!is_sized<I>::value> reserve(segment_table&, const I&) noexcept {
+    }
+
+    template<class I>
+    static std::shared_ptr<const segment_table> make_segments(const I& iterable) {
+        auto table = std::make_shared<segment_table>();
+        reserve(*table, iterable);
+        for (auto&& range : iterable) {
+            const auto size = static_cast<size_t>(lz::eager_size(range));
+            // Empty ranges are skipped, so that every increment moves at most one segment forward
+            if (size == 0) {
+                continue;
+            }
+            table->begins.push_back(detail::begin(range));
+            table->offsets.push_back(table->offsets.back() + size);
+        }
+        return table;
+    }
+
+    const segment_table& segments() const {
+        // Default constructed iterables are empty
+        static const segment_table empty{};
+        return _segments ? *_segments : empty;
+    }
+
+public:
+    using iterator = concatenate_dynamic_iterator<range_iter>;
+    using sentinel = iterator;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    constexpr concatenate_dynamic_iterable() = default;
+
+    template<class I>
+    explicit concatenate_dynamic_iterable(I&& iterable) :
+        _iterable{ std::forward<I>(iterable) },
+        _segments{ make_segments(_iterable) } {
+    }
+
+    LZ_NODISCARD size_t size() const {
+        return segments().offsets.back();
+    }
+
+    /**
+     * @return The number of (non empty) iterables that are concatenated.
+     */
+    LZ_NODISCARD size_t segment_count() const {
+        return segments().begins.size();
+    }
+
+    /**
+     * @brief Returns the @p index -th (non empty) iterable that is concatenated. Can be used to process the iterables one by one,
+     * for instance with algorithms that are faster on contiguous ranges.
+     * @param index The index of the segment, must be smaller than segment_count().
+     * @return A basic_iterable over the segment.
+     */
+    LZ_NODISCARD basic_iterable<range_iter> segment(const size_t index) const {
+        LZ_ASSERT(index < segment_count(), "Segment index out of bounds");
+        const auto& table = segments();
+        const auto& first = table.begins[index];
+        return { first, first + static_cast<diff_type<range_iter>>(table.offsets[index + 1] - table.offsets[index]) };
+    }
+
+    LZ_NODISCARD iterator begin() const {
+        return { &segments(), 0 };
+    }
+
+    LZ_NODISCARD iterator end() const {
+        return { &segments(), size() };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+
+#ifndef LZ_COUNTER_RANDOM_ITERABLE_HPP
+#define LZ_COUNTER_RANDOM_ITERABLE_HPP
+
+#include <Lz/detail/iterators/counter_random.hpp>
+#include <Lz/traits/lazy_view.hpp>
+#include <cstdint>
+
+namespace lz {
+namespace detail {
+template<class Distribution>
+class counter_random_iterable : public lazy_view {
+    Distribution _distribution{};
+    std::uint64_t _seed{};
+    ptrdiff_t _amount{};
+
+public:
+    using iterator = counter_random_iterator<Distribution>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    constexpr counter_random_iterable(const counter_random_iterable&) = default;
+    LZ_CONSTEXPR_CXX_14 counter_random_iterable& operator=(const counter_random_iterable&) = default;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr counter_random_iterable()
+        requires(std::default_initializable<Distribution>)
+    = default;
+
+#else
+
+    template<class D = Distribution, class = enable_if_t<std::is_default_constructible<D>::value>>
+    constexpr counter_random_iterable() noexcept(std::is_nothrow_default_constructible<D>::value) {
+    }
+
+#endif
+
+    constexpr counter_random_iterable(const Distribution& distribution, const std::uint64_t seed, const ptrdiff_t amount) :
+        _distribution{ distribution },
+        _seed{ seed },
+        _amount{ amount } {
+    }
+
+    LZ_NODISCARD constexpr size_t size() const noexcept {
+        return static_cast<size_t>(_amount);
+    }
+
+    LZ_NODISCARD constexpr std::uint64_t seed() const noexcept {
+        return _seed;
+    }
+
+    /**
+     * Writes all random numbers to @p out. Used by lz::copy and lz::to.
+     * @return The output iterator past the last written value.
+     */
+    template<class OutputIterator>
+    OutputIterator copy_to(OutputIterator out) const {
+        for (ptrdiff_t i = 0; i < _amount; ++i, ++out) {
+            *out = counter_random_at(_distribution, _seed, i);
+        }
+        return out;
+    }
+
+    LZ_NODISCARD constexpr iterator begin() const {
+        return { _distribution, _seed, 0 };
+    }
+
+    LZ_NODISCARD constexpr iterator end() const {
+        return { _distribution, _seed, _amount };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_COUNTER_RANDOM_ITERABLE_HPP
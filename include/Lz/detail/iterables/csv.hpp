@@ -0,0 +1,194 @@
+#pragma once
+
+#ifndef LZ_CSV_ITERABLE_HPP
+#define LZ_CSV_ITERABLE_HPP
+
+#include <Lz/detail/iterators/csv.hpp>
+#include <memory>
+#include <string>
+
+namespace lz {
+namespace detail {
+
+/**
+ * Options for lz::csv. By default, fields are separated by `,` and quoted using `"`. Use `lz::csv_options{ '\t' }` for TSV.
+ */
+template<class CharT>
+struct basic_csv_options {
+    CharT delimiter;
+    CharT quote;
+
+    constexpr basic_csv_options(const CharT delim = static_cast<CharT>(','),
+                                const CharT quote_char = static_cast<CharT>('"')) noexcept :
+        delimiter{ delim },
+        quote{ quote_char } {
+    }
+};
+
+// Scans the buffer once, and stores the bounds of every field. Quoted sections are skipped using char_traits::find (memchr
+// for char), because only a quote can end them. Fields that contain escaped quotes are unescaped into the index
+template<class CharT>
+class csv_scanner {
+    using traits = std::char_traits<CharT>;
+
+    const CharT* _buffer;
+    size_t _size;
+    basic_csv_options<CharT> _options;
+    size_t _pos{};
+
+    static constexpr CharT newline() noexcept {
+        return static_cast<CharT>('\n');
+    }
+
+    static constexpr CharT carriage_return() noexcept {
+        return static_cast<CharT>('\r');
+    }
+
+    bool at_field_end() const noexcept {
+        return _pos == _size || _buffer[_pos] == _options.delimiter || _buffer[_pos] == newline();
+    }
+
+    void skip_to_field_end() noexcept {
+        while (!at_field_end()) {
+            ++_pos;
+        }
+    }
+
+    // Appends the contents of [first, last) to the unescaped values, with every doubled quote replaced by a single quote
+    void unescape(std::basic_string<CharT>& unescaped, csv_field_bounds& bounds) const {
+        bounds.escaped = true;
+        bounds.unescaped_first = unescaped.size();
+        for (size_t i = bounds.first; i < bounds.last; ++i) {
+            unescaped.push_back(_buffer[i]);
+            if (_buffer[i] == _options.quote) {
+                ++i;
+            }
+        }
+        bounds.unescaped_last = unescaped.size();
+    }
+
+    csv_field_bounds quoted_field(std::basic_string<CharT>& unescaped) {
+        const auto first = ++_pos;
+        bool escaped = false;
+        csv_field_bounds bounds{ first, _size, 0, 0, false };
+        while (true) {
+            const auto* quote = traits::find(_buffer + _pos, _size - _pos, _options.quote);
+            if (quote == nullptr) {
+                // Unterminated quote, the field continues until the end of the buffer
+                _pos = _size;
+                break;
+            }
+            const auto quote_pos = static_cast<size_t>(quote - _buffer);
+            if (quote_pos + 1 < _size && _buffer[quote_pos + 1] == _options.quote) {
+                escaped = true;
+                _pos = quote_pos + 2;
+                continue;
+            }
+            // Anything between the closing quote and the end of the field is ignored
+            _pos = quote_pos + 1;
+            skip_to_field_end();
+            bounds.last = quote_pos;
+            break;
+        }
+        if (escaped) {
+            unescape(unescaped, bounds);
+        }
+        return bounds;
+    }
+
+    csv_field_bounds unquoted_field() noexcept {
+        const auto first = _pos;
+        skip_to_field_end();
+        auto last = _pos;
+        if (last != first && _buffer[last - 1] == carriage_return() && (_pos == _size || _buffer[_pos] == newline())) {
+            --last;
+        }
+        return { first, last, 0, 0, false };
+    }
+
+    bool skip_empty_line() noexcept {
+        if (_buffer[_pos] == newline()) {
+            ++_pos;
+            return true;
+        }
+        if (_buffer[_pos] == carriage_return() && (_pos + 1 == _size || _buffer[_pos + 1] == newline())) {
+            _pos += _pos + 1 == _size ? 1 : 2;
+            return true;
+        }
+        return false;
+    }
+
+public:
+    csv_scanner(const CharT* buffer, const size_t size, const basic_csv_options<CharT>& options) noexcept :
+        _buffer{ buffer },
+        _size{ size },
+        _options{ options } {
+    }
+
+    csv_index<CharT> scan() {
+        csv_index<CharT> index;
+        while (_pos != _size) {
+            if (skip_empty_line()) {
+                continue;
+            }
+            while (true) {
+                const bool quoted = _pos != _size && _buffer[_pos] == _options.quote;
+                index.fields.push_back(quoted ? quoted_field(index.unescaped) : unquoted_field());
+                if (_pos == _size) {
+                    break;
+                }
+                if (_buffer[_pos++] == newline()) {
+                    break;
+                }
+            }
+            index.records.push_back(index.fields.size());
+        }
+        return index;
+    }
+};
+
+template<class CharT>
+class csv_iterable : public lazy_view {
+    const CharT* _buffer{};
+    // Shared by all copies of this iterable, so that copying this iterable doesn't copy the index. The unescaped values of
+    // fields are stored in the index, so they stay valid as long as any copy of this iterable exists
+    std::shared_ptr<const csv_index<CharT>> _index{};
+
+    const csv_index<CharT>* index() const {
+        // Default constructed iterables are empty
+        static const csv_index<CharT> empty{};
+        return _index ? _index.get() : &empty;
+    }
+
+public:
+    using iterator = csv_iterator<CharT>;
+    using sentinel = iterator;
+    using const_iterator = iterator;
+    using value_type = basic_csv_record<CharT>;
+
+    constexpr csv_iterable() = default;
+    csv_iterable(const csv_iterable&) = default;
+    csv_iterable& operator=(const csv_iterable&) = default;
+
+    csv_iterable(const CharT* buffer, const size_t size, const basic_csv_options<CharT>& options) :
+        _buffer{ buffer },
+        _index{ std::make_shared<const csv_index<CharT>>(csv_scanner<CharT>{ buffer, size, options }.scan()) } {
+    }
+
+    LZ_NODISCARD size_t size() const {
+        return index()->records.size() - 1;
+    }
+
+    LZ_NODISCARD iterator begin() const {
+        return { _buffer, index(), 0 };
+    }
+
+    LZ_NODISCARD iterator end() const {
+        return { _buffer, index(), size() };
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -22,7 +22,7 @@ public:
 
 private:
     maybe_owned<Iterable> _iterable{};
-    func_container<BinaryPredicate> _compare{};
+    LZ_NO_UNIQUE_ADDRESS func_container<BinaryPredicate> _compare{};
 
     static constexpr bool return_sentinel = !is_bidi_tag<iter_cat_t<iterator>>::value || has_sentinel<Iterable>::value;
 
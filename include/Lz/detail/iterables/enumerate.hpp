@@ -6,6 +6,7 @@
 #include <Lz/detail/iterators/enumerate.hpp>
 #include <Lz/detail/maybe_owned.hpp>
 #include <Lz/detail/traits/is_sentinel.hpp>
+#include <Lz/detail/traits/static_size.hpp>
 
 namespace lz {
 namespace detail {
@@ -114,6 +115,9 @@ public:
 
 #endif
 };
+
+template<class Iterable, class IntType>
+struct static_size_impl<enumerate_iterable<Iterable, IntType>> : static_size<Iterable> {};
 } // namespace detail
 } // namespace lz
 #endif
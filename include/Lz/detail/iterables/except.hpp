@@ -18,7 +18,7 @@ class except_iterable : public lazy_view {
 
     maybe_owned<Iterable1> _iterable1{};
     iterable2_type _iterable2{};
-    func_container<BinaryPredicate> _binary_predicate{};
+    LZ_NO_UNIQUE_ADDRESS func_container<BinaryPredicate> _binary_predicate{};
 
 public:
     using iterator = except_iterator<maybe_owned<Iterable1>, iterable2_type, func_container<BinaryPredicate>>;
@@ -14,7 +14,7 @@ template<class Iterable, class T, class BinaryOp>
 class exclusive_scan_iterable : public lazy_view {
     maybe_owned<Iterable> _iterable{};
     T _init{};
-    func_container<BinaryOp> _binary_op{};
+    LZ_NO_UNIQUE_ADDRESS func_container<BinaryOp> _binary_op{};
 
 public:
     using iterator = exclusive_scan_iterator<iter_t<Iterable>, sentinel_t<Iterable>, T, func_container<BinaryOp>>;
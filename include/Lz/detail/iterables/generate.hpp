@@ -14,7 +14,7 @@ class generate_iterable;
 
 template<class GeneratorFunc>
 class generate_iterable<GeneratorFunc, false> : public lazy_view {
-    func_container<GeneratorFunc> _func{};
+    LZ_NO_UNIQUE_ADDRESS func_container<GeneratorFunc> _func{};
     ptrdiff_t _amount{};
 
 public:
@@ -54,7 +54,7 @@ public:
 
 template<class GeneratorFunc>
 class generate_iterable<GeneratorFunc, true> : public lazy_view {
-    func_container<GeneratorFunc> _func;
+    LZ_NO_UNIQUE_ADDRESS func_container<GeneratorFunc> _func;
 
 public:
     using iterator = generate_iterator<func_container<GeneratorFunc>, true>;
@@ -15,7 +15,7 @@ class generate_while_iterable : public lazy_view {
     using T = typename std::tuple_element<1, fn_return_type>::type;
 
     fn_return_type _init{ T{}, true };
-    func_container<GeneratorFunc> _func{};
+    LZ_NO_UNIQUE_ADDRESS func_container<GeneratorFunc> _func{};
 
 public:
     using iterator = generate_while_iterator<func_container<GeneratorFunc>>;
@@ -0,0 +1,88 @@
+#pragma once
+
+#ifndef LZ_GROUP_BY_HASHED_ITERABLE_HPP
+#define LZ_GROUP_BY_HASHED_ITERABLE_HPP
+
+#include <Lz/detail/func_container.hpp>
+#include <Lz/detail/hash_aggregate_table.hpp>
+#include <Lz/detail/iterators/group_by_hashed.hpp>
+#include <Lz/detail/maybe_owned.hpp>
+#include <Lz/detail/procs/operators.hpp>
+#include <Lz/detail/traits/func_ret_type.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <functional>
+
+namespace lz {
+namespace detail {
+
+template<class Iterable, class KeyFn, class T, class Aggregator>
+class group_by_hashed_iterable : public lazy_view {
+    maybe_owned<Iterable> _iterable{};
+    LZ_NO_UNIQUE_ADDRESS func_container<KeyFn> _key_fn{};
+    T _init{};
+    LZ_NO_UNIQUE_ADDRESS func_container<Aggregator> _aggregator{};
+    size_t _expected_keys{};
+
+    using key_type = remove_cvref_t<func_ret_type_iter<func_container<KeyFn>, iter_t<Iterable>>>;
+    using table = hash_aggregate_table<key_type, T, std::hash<key_type>, LZ_BIN_OP(equal_to, key_type)>;
+
+public:
+    using iterator = group_by_hashed_iterator<key_type, T>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr group_by_hashed_iterable()
+        requires(std::default_initializable<maybe_owned<Iterable>> && std::default_initializable<KeyFn> &&
+                 std::default_initializable<T> && std::default_initializable<Aggregator>)
+    = default;
+
+#else
+
+    template<class I = decltype(_iterable),
+             class = enable_if_t<std::is_default_constructible<I>::value && std::is_default_constructible<KeyFn>::value &&
+                                 std::is_default_constructible<T>::value && std::is_default_constructible<Aggregator>::value>>
+    constexpr group_by_hashed_iterable() noexcept(std::is_nothrow_default_constructible<I>::value &&
+                                                  std::is_nothrow_default_constructible<KeyFn>::value &&
+                                                  std::is_nothrow_default_constructible<T>::value &&
+                                                  std::is_nothrow_default_constructible<Aggregator>::value) {
+    }
+
+#endif
+
+    template<class I>
+    constexpr group_by_hashed_iterable(I&& iterable, KeyFn key_fn, Aggregator aggregator, T init, const size_t expected_keys) :
+        _iterable{ std::forward<I>(iterable) },
+        _key_fn{ std::move(key_fn) },
+        _init{ std::move(init) },
+        _aggregator{ std::move(aggregator) },
+        _expected_keys{ expected_keys } {
+    }
+
+    /**
+     * Performs the (single) pass over the input iterable. The hash table is reserved up front for the expected number of keys
+     * and grows as more keys are inserted.
+     */
+    LZ_NODISCARD iterator begin() const {
+        table groups{ _expected_keys, {}, {} };
+
+        auto end = _iterable.end();
+        for (auto it = _iterable.begin(); it != end; ++it) {
+            auto&& element = *it;
+            T& aggregate = groups.find_or_insert(_key_fn(element), _init);
+            aggregate = _aggregator(std::move(aggregate), element);
+        }
+
+        return iterator{ std::make_shared<const typename table::entries_type>(groups.release()) };
+    }
+
+    LZ_NODISCARD constexpr default_sentinel_t end() const noexcept {
+        return {};
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_GROUP_BY_HASHED_ITERABLE_HPP
@@ -6,6 +6,7 @@
 #include <Lz/detail/func_container.hpp>
 #include <Lz/detail/iterators/inclusive_scan.hpp>
 #include <Lz/detail/maybe_owned.hpp>
+#include <Lz/detail/traits/static_size.hpp>
 
 namespace lz {
 namespace detail {
@@ -14,7 +15,7 @@ template<class Iterable, class T, class BinaryOp>
 class inclusive_scan_iterable : public lazy_view {
     maybe_owned<Iterable> _iterable{};
     T _init{};
-    func_container<BinaryOp> _binary_op{};
+    LZ_NO_UNIQUE_ADDRESS func_container<BinaryOp> _binary_op{};
 
 public:
     using iterator = inclusive_scan_iterator<iter_t<Iterable>, sentinel_t<Iterable>, T, func_container<BinaryOp>>;
@@ -80,6 +81,9 @@ public:
     }
 };
 
+template<class Iterable, class T, class BinaryOp>
+struct static_size_impl<inclusive_scan_iterable<Iterable, T, BinaryOp>> : static_size<Iterable> {};
+
 } // namespace detail
 } // namespace lz
 
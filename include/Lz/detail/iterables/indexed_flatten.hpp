@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef LZ_INDEXED_FLATTEN_ITERABLE_HPP
+#define LZ_INDEXED_FLATTEN_ITERABLE_HPP
+
+#include <Lz/detail/iterators/indexed_flatten.hpp>
+#include <Lz/detail/maybe_owned.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/procs/eager_size.hpp>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace lz {
+namespace detail {
+template<class Iterable>
+class indexed_flatten_iterable : public lazy_view {
+    using outer_iter = iter_t<Iterable>;
+    using inner_ref = ref_t<outer_iter>;
+
+    static_assert(is_ra<outer_iter>::value, "indexed_flatten requires a random access iterable");
+    static_assert(std::is_lvalue_reference<inner_ref>::value,
+                  "indexed_flatten requires an iterable that returns its inner iterables by reference");
+    static_assert(is_ra<iter_t<inner_ref>>::value, "indexed_flatten requires random access inner iterables");
+
+    maybe_owned<Iterable> _iterable{};
+    // Shared by all copies of this iterable, so that copying this iterable doesn't copy the index
+    std::shared_ptr<const std::vector<size_t>> _offsets{};
+
+    static std::shared_ptr<const std::vector<size_t>> make_offsets(const maybe_owned<Iterable>& iterable) {
+        auto offsets = std::make_shared<std::vector<size_t>>();
+        offsets->reserve(static_cast<size_t>(lz::eager_size(iterable)) + 1);
+        offsets->push_back(0);
+        for (auto&& inner : iterable) {
+            offsets->push_back(offsets->back() + static_cast<size_t>(lz::eager_size(inner)));
+        }
+        return offsets;
+    }
+
+    const std::vector<size_t>* offsets() const {
+        // Default constructed iterables are empty
+        static const std::vector<size_t> empty(1, 0);
+        return _offsets ? _offsets.get() : &empty;
+    }
+
+public:
+    using iterator = indexed_flatten_iterator<outer_iter>;
+    using sentinel = iterator;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr indexed_flatten_iterable()
+        requires(std::default_initializable<maybe_owned<Iterable>>)
+    = default;
+
+#else
+
+    template<class I = decltype(_iterable), class = enable_if_t<std::is_default_constructible<I>::value>>
+    constexpr indexed_flatten_iterable() noexcept(std::is_nothrow_default_constructible<maybe_owned<Iterable>>::value) {
+    }
+
+#endif
+
+    template<class I>
+    explicit indexed_flatten_iterable(I&& iterable) :
+        _iterable{ std::forward<I>(iterable) },
+        _offsets{ make_offsets(_iterable) } {
+    }
+
+    LZ_NODISCARD size_t size() const {
+        return offsets()->back();
+    }
+
+    LZ_NODISCARD iterator begin() const {
+        return { _iterable.begin(), offsets(), 0 };
+    }
+
+    LZ_NODISCARD iterator end() const {
+        return { _iterable.begin(), offsets(), size() };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
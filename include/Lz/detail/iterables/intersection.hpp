@@ -13,7 +13,7 @@ template<class Iterable, class Iterable2, class BinaryPredicate>
 class intersection_iterable : public lazy_view {
     maybe_owned<Iterable> _iterable{};
     maybe_owned<Iterable2> _iterable2{};
-    func_container<BinaryPredicate> _compare{};
+    LZ_NO_UNIQUE_ADDRESS func_container<BinaryPredicate> _compare{};
 
 public:
     using iterator = intersection_iterator<maybe_owned<Iterable>, maybe_owned<Iterable2>, func_container<BinaryPredicate>>;
@@ -7,13 +7,14 @@
 #include <Lz/detail/iterators/map.hpp>
 #include <Lz/detail/maybe_owned.hpp>
 #include <Lz/detail/traits/is_sentinel.hpp>
+#include <Lz/detail/traits/static_size.hpp>
 
 namespace lz {
 namespace detail {
 template<class Iterable, class UnaryOp>
 class map_iterable : public lazy_view {
     maybe_owned<Iterable> _iterable{};
-    func_container<UnaryOp> _unary_op{};
+    LZ_NO_UNIQUE_ADDRESS func_container<UnaryOp> _unary_op{};
 
     using iter = iter_t<Iterable>;
     using sent = sentinel_t<Iterable>;
@@ -98,6 +99,9 @@ public:
 
 #endif
 };
+
+template<class Iterable, class UnaryOp>
+struct static_size_impl<map_iterable<Iterable, UnaryOp>> : static_size<Iterable> {};
 } // namespace detail
 } // namespace lz
 #endif
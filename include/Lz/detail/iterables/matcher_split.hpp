@@ -0,0 +1,46 @@
+#pragma once
+
+#ifndef LZ_MATCHER_SPLIT_ITERABLE_HPP
+#define LZ_MATCHER_SPLIT_ITERABLE_HPP
+
+#include <Lz/detail/iterators/matcher_split.hpp>
+#include <Lz/traits/lazy_view.hpp>
+
+namespace lz {
+namespace detail {
+
+template<class Matcher>
+class matcher_split_iterable : public lazy_view {
+    using char_type = typename Matcher::char_type;
+
+    const Matcher* _matcher{ nullptr };
+    const char_type* _first{ nullptr };
+    const char_type* _last{ nullptr };
+
+public:
+    using iterator = matcher_split_iterator<Matcher>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+    using sentinel = default_sentinel_t;
+
+    constexpr matcher_split_iterable() = default;
+
+    constexpr matcher_split_iterable(const Matcher& matcher, const char_type* first, const char_type* last) noexcept :
+        _matcher{ &matcher },
+        _first{ first },
+        _last{ last } {
+    }
+
+    LZ_NODISCARD iterator begin() const {
+        // Default constructed iterables are empty
+        return _matcher == nullptr ? iterator{} : iterator{ *_matcher, _first, _last };
+    }
+
+    LZ_NODISCARD constexpr sentinel end() const noexcept {
+        return {};
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,119 @@
+#pragma once
+
+#ifndef LZ_MEMOIZE_MAP_ITERABLE_HPP
+#define LZ_MEMOIZE_MAP_ITERABLE_HPP
+
+#include <Lz/detail/func_container.hpp>
+#include <Lz/detail/iterators/memoize_map.hpp>
+#include <Lz/detail/maybe_owned.hpp>
+#include <Lz/detail/traits/is_sentinel.hpp>
+#include <Lz/detail/traits/static_size.hpp>
+#include <Lz/procs/eager_size.hpp>
+#include <memory>
+
+namespace lz {
+namespace detail {
+template<class Iterable, class UnaryOp>
+class memoize_map_iterable : public lazy_view {
+    using iter = iter_t<Iterable>;
+    using sent = sentinel_t<Iterable>;
+    using cache = memoize_cache_for<iter, func_container<UnaryOp>>;
+
+    maybe_owned<Iterable> _iterable{};
+    // Shared by all copies of this iterable, so that copies (for instance, held by other iterables) reuse the results
+    std::shared_ptr<cache> _cache{};
+
+    static_assert(is_fwd<iter>::value, "memoize_map requires a forward iterable");
+
+    template<class I = iter>
+    static enable_if_t<is_ra<I>::value, size_t> cache_size(const maybe_owned<Iterable>& iterable) {
+        return static_cast<size_t>(lz::eager_size(iterable));
+    }
+
+    template<class I = iter>
+    static constexpr enable_if_t<!is_ra<I>::value, size_t> cache_size(const maybe_owned<Iterable>&) noexcept {
+        return 0;
+    }
+
+public:
+    using iterator = memoize_map_iterator<iter, sent, func_container<UnaryOp>>;
+    using sentinel = sent;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    static constexpr bool return_sentinel = !is_ra<iter>::value || is_sentinel<iter, sent>::value;
+
+public:
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr memoize_map_iterable()
+        requires(std::default_initializable<maybe_owned<Iterable>>)
+    = default;
+
+#else
+
+    template<class I = decltype(_iterable), class = enable_if_t<std::is_default_constructible<I>::value>>
+    constexpr memoize_map_iterable() noexcept(std::is_nothrow_default_constructible<maybe_owned<Iterable>>::value) {
+    }
+
+#endif
+
+    template<class I>
+    memoize_map_iterable(I&& iterable, UnaryOp unary_op) :
+        _iterable{ std::forward<I>(iterable) },
+        _cache{ std::make_shared<cache>(func_container<UnaryOp>{ std::move(unary_op) }, cache_size(_iterable)) } {
+    }
+
+#ifdef LZ_HAS_CONCEPTS
+
+    [[nodiscard]] constexpr size_t size() const
+        requires(sized<Iterable>)
+    {
+        return static_cast<size_t>(lz::size(_iterable));
+    }
+
+#else
+
+    template<class I = Iterable>
+    LZ_NODISCARD constexpr enable_if_t<is_sized<I>::value, size_t> size() const noexcept {
+        return static_cast<size_t>(lz::size(_iterable));
+    }
+
+#endif
+
+    LZ_NODISCARD iterator begin() const {
+        return { _iterable.begin(), _cache.get(), 0 };
+    }
+
+#ifdef LZ_HAS_CXX_17
+
+    [[nodiscard]] auto end() const {
+        if constexpr (!return_sentinel) {
+            return iterator{ _iterable.end(), _cache.get(), static_cast<size_t>(lz::eager_size(_iterable)) };
+        }
+        else {
+            return _iterable.end();
+        }
+    }
+
+#else
+
+    template<bool R = return_sentinel>
+    LZ_NODISCARD enable_if_t<!R, iterator> end() const {
+        return { _iterable.end(), _cache.get(), static_cast<size_t>(lz::eager_size(_iterable)) };
+    }
+
+    template<bool R = return_sentinel>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 enable_if_t<R, sentinel> end() const {
+        return _iterable.end();
+    }
+
+#endif
+};
+
+template<class Iterable, class UnaryOp>
+struct static_size_impl<memoize_map_iterable<Iterable, UnaryOp>> : static_size<Iterable> {};
+} // namespace detail
+} // namespace lz
+#endif
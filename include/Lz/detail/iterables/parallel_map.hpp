@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_MAP_ITERABLE_HPP
+#define LZ_PARALLEL_MAP_ITERABLE_HPP
+
+#include <Lz/detail/func_container.hpp>
+#include <Lz/detail/iterators/parallel_map.hpp>
+#include <Lz/detail/maybe_owned.hpp>
+#include <Lz/traits/lazy_view.hpp>
+
+namespace lz {
+namespace detail {
+
+template<class Iterable, class UnaryOp, bool Ordered>
+class parallel_map_iterable : public lazy_view {
+    maybe_owned<Iterable> _iterable{};
+    LZ_NO_UNIQUE_ADDRESS func_container<UnaryOp> _unary_op{};
+    size_t _threads{};
+    size_t _window{};
+
+    using state = parallel_map_state<iter_t<Iterable>, sentinel_t<Iterable>, func_container<UnaryOp>, Ordered>;
+
+public:
+    using iterator = parallel_map_iterator<iter_t<Iterable>, sentinel_t<Iterable>, func_container<UnaryOp>, Ordered>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr parallel_map_iterable()
+        requires(std::default_initializable<maybe_owned<Iterable>> && std::default_initializable<UnaryOp>)
+    = default;
+
+#else
+
+    template<class I = decltype(_iterable),
+             class = enable_if_t<std::is_default_constructible<I>::value && std::is_default_constructible<UnaryOp>::value>>
+    constexpr parallel_map_iterable() noexcept(std::is_nothrow_default_constructible<I>::value &&
+                                               std::is_nothrow_default_constructible<UnaryOp>::value) {
+    }
+
+#endif
+
+    template<class I>
+    constexpr parallel_map_iterable(I&& iterable, UnaryOp unary_op, const size_t threads, const size_t window) :
+        _iterable{ std::forward<I>(iterable) },
+        _unary_op{ std::move(unary_op) },
+        _threads{ threads },
+        _window{ window } {
+    }
+
+#ifdef LZ_HAS_CONCEPTS
+
+    [[nodiscard]] constexpr size_t size() const
+        requires(sized<Iterable>)
+    {
+        return static_cast<size_t>(lz::size(_iterable));
+    }
+
+#else
+
+    template<class I = Iterable>
+    LZ_NODISCARD constexpr enable_if_t<is_sized<I>::value, size_t> size() const noexcept {
+        return static_cast<size_t>(lz::size(_iterable));
+    }
+
+#endif
+
+    /**
+     * Starts the worker threads and blocks until the first result is available. Every call to begin() starts a new pass over
+     * the input iterable, with its own worker threads.
+     */
+    LZ_NODISCARD iterator begin() const {
+        auto s = std::make_shared<state>(_iterable.begin(), _iterable.end(), _unary_op, _threads, _window);
+        s->advance();
+        return iterator{ std::move(s) };
+    }
+
+    LZ_NODISCARD constexpr default_sentinel_t end() const noexcept {
+        return {};
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PARALLEL_MAP_ITERABLE_HPP
@@ -0,0 +1,80 @@
+#pragma once
+
+#ifndef LZ_PREFETCH_ASYNC_ITERABLE_HPP
+#define LZ_PREFETCH_ASYNC_ITERABLE_HPP
+
+#include <Lz/detail/iterators/prefetch_async.hpp>
+#include <Lz/detail/maybe_owned.hpp>
+#include <Lz/traits/lazy_view.hpp>
+
+namespace lz {
+namespace detail {
+
+template<class Iterable>
+class prefetch_async_iterable : public lazy_view {
+    maybe_owned<Iterable> _iterable{};
+    size_t _capacity{};
+
+    using state = prefetch_async_state<iter_t<Iterable>, sentinel_t<Iterable>>;
+
+public:
+    using iterator = prefetch_async_iterator<iter_t<Iterable>, sentinel_t<Iterable>>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr prefetch_async_iterable()
+        requires(std::default_initializable<maybe_owned<Iterable>>)
+    = default;
+
+#else
+
+    template<class I = decltype(_iterable), class = enable_if_t<std::is_default_constructible<I>::value>>
+    constexpr prefetch_async_iterable() noexcept(std::is_nothrow_default_constructible<I>::value) {
+    }
+
+#endif
+
+    template<class I>
+    constexpr prefetch_async_iterable(I&& iterable, const size_t capacity) :
+        _iterable{ std::forward<I>(iterable) },
+        _capacity{ capacity } {
+    }
+
+#ifdef LZ_HAS_CONCEPTS
+
+    [[nodiscard]] constexpr size_t size() const
+        requires(sized<Iterable>)
+    {
+        return static_cast<size_t>(lz::size(_iterable));
+    }
+
+#else
+
+    template<class I = Iterable>
+    LZ_NODISCARD constexpr enable_if_t<is_sized<I>::value, size_t> size() const noexcept {
+        return static_cast<size_t>(lz::size(_iterable));
+    }
+
+#endif
+
+    /**
+     * Starts the producer thread and blocks until the first element is available. Every call to begin() starts a new pass over
+     * the input iterable, with its own producer thread.
+     */
+    LZ_NODISCARD iterator begin() const {
+        auto s = std::make_shared<state>(_iterable.begin(), _iterable.end(), _capacity);
+        s->advance();
+        return iterator{ std::move(s) };
+    }
+
+    LZ_NODISCARD constexpr default_sentinel_t end() const noexcept {
+        return {};
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PREFETCH_ASYNC_ITERABLE_HPP
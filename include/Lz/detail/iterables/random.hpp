@@ -4,6 +4,7 @@
 #define LZ_RANDOM_ITERABLE_HPP
 
 #include <Lz/detail/iterators/random.hpp>
+#include <Lz/detail/procs/assert.hpp>
 #include <Lz/traits/lazy_view.hpp>
 
 namespace lz {
@@ -22,6 +23,9 @@ public:
     using const_iterator = iterator;
     using value_type = typename iterator::value_type;
 
+    // All iterators advance the same generator, so lz::to(lz::par) must not iterate over slices concurrently
+    static constexpr bool thread_splittable = false;
+
 #ifdef LZ_HAS_CONCEPTS
 
     constexpr random_iterable()
@@ -46,6 +50,21 @@ public:
         return static_cast<size_t>(_current);
     }
 
+    /**
+     * Writes all random numbers to @p out. Used by lz::copy and lz::to. Unlike iterating, the distribution is copied only once and
+     * the values are generated in one tight loop, without any iterator bookkeeping per value.
+     * @return The output iterator past the last written value.
+     */
+    template<class OutputIterator>
+    OutputIterator copy_to(OutputIterator out) const {
+        LZ_ASSERT(_generator != nullptr || _current == 0, "Generator is not initialized");
+        auto distribution = _distribution;
+        for (ptrdiff_t i = 0; i < _current; ++i, ++out) {
+            *out = distribution(*_generator);
+        }
+        return out;
+    }
+
     LZ_NODISCARD constexpr iterator begin() const {
         return { _distribution, *_generator, _current };
     }
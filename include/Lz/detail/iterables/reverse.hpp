@@ -9,6 +9,7 @@
 #include <Lz/detail/traits/conditional.hpp>
 #include <Lz/detail/traits/is_sentinel.hpp>
 #include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/detail/traits/static_size.hpp>
 
 namespace lz {
 namespace detail {
@@ -133,6 +134,9 @@ public:
 
 #endif
 };
+
+template<class Iterable, bool Cached>
+struct static_size_impl<reverse_iterable<Iterable, Cached>> : static_size<Iterable> {};
 } // namespace detail
 } // namespace lz
 
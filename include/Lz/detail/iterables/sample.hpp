@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef LZ_SAMPLE_ITERABLE_HPP
+#define LZ_SAMPLE_ITERABLE_HPP
+
+#include <Lz/detail/procs/begin_end.hpp>
+#include <Lz/detail/traits/enable_if.hpp>
+#include <Lz/detail/traits/is_sentinel.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+#include <Lz/traits/lazy_view.hpp>
+#include <Lz/util/random_engines.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+// Advances it by n, or to end if there are less than n elements left
+template<class I, class S>
+enable_if_t<is_ra<I>::value && !is_sentinel<I, S>::value> skip_at_most(I& it, const S& end, const std::uint64_t n) {
+    const auto left = static_cast<std::uint64_t>(end - it);
+    it = n >= left ? end : it + static_cast<diff_type<I>>(n);
+}
+
+template<class I, class S>
+enable_if_t<!is_ra<I>::value || is_sentinel<I, S>::value> skip_at_most(I& it, const S& end, std::uint64_t n) {
+    for (; n != 0 && it != end; --n, ++it) {
+    }
+}
+
+// A random double in (0, 1]
+inline double random_unit_interval(xoshiro256ss& engine) noexcept {
+    return static_cast<double>((engine() >> 11u) + 1) * (1. / 9007199254740992.);
+}
+
+/**
+ * Reservoir sampling (Li's algorithm L): keeps a reservoir of the first `k` elements and computes how many elements can be
+ * skipped before the next element that replaces a random element of the reservoir. This way, only O(k (1 + log(n / k))) random
+ * numbers are needed, and the skipped elements are not even dereferenced (and skipped in O(1) for random access iterators).
+ */
+template<class I, class S>
+std::vector<val_t<I>> reservoir_sample(I first, const S last, const size_t k, const std::uint64_t seed) {
+    std::vector<val_t<I>> reservoir;
+    if (k == 0) {
+        return reservoir;
+    }
+    reservoir.reserve(k);
+    for (; first != last && reservoir.size() < k; ++first) {
+        reservoir.push_back(*first);
+    }
+
+    xoshiro256ss engine{ seed };
+    const auto k_double = static_cast<double>(k);
+    double w = std::exp(std::log(random_unit_interval(engine)) / k_double);
+    while (first != last) {
+        const double skip = std::floor(std::log(random_unit_interval(engine)) / std::log1p(-w));
+        constexpr auto max_skip = static_cast<double>((std::numeric_limits<std::uint64_t>::max)() / 2);
+        skip_at_most(first, last, skip < max_skip ? static_cast<std::uint64_t>(skip) : static_cast<std::uint64_t>(max_skip));
+        if (first == last) {
+            break;
+        }
+        const std::uint64_t replaced = mul_hi64(engine(), k);
+        *(reservoir.begin() + static_cast<std::ptrdiff_t>(replaced)) = *first;
+        ++first;
+        w *= std::exp(std::log(random_unit_interval(engine)) / k_double);
+    }
+    return reservoir;
+}
+
+template<class Iterable>
+class sample_iterable : public lazy_view {
+    using sample_type = std::vector<val_iterable_t<Iterable>>;
+
+    // Shared by all copies of this iterable, so that copying this iterable doesn't copy the sample
+    std::shared_ptr<const sample_type> _sample{};
+
+    const sample_type& sample() const {
+        // Default constructed iterables are empty
+        static const sample_type empty{};
+        return _sample ? *_sample : empty;
+    }
+
+public:
+    using iterator = typename sample_type::const_iterator;
+    using const_iterator = iterator;
+    using value_type = typename sample_type::value_type;
+
+    constexpr sample_iterable() = default;
+
+    template<class I>
+    sample_iterable(I&& iterable, const size_t k, const std::uint64_t seed) :
+        _sample{ std::make_shared<const sample_type>(reservoir_sample(detail::begin(iterable), detail::end(iterable), k, seed)) } {
+    }
+
+    LZ_NODISCARD size_t size() const noexcept {
+        return sample().size();
+    }
+
+    LZ_NODISCARD iterator begin() const noexcept {
+        return sample().begin();
+    }
+
+    LZ_NODISCARD iterator end() const noexcept {
+        return sample().end();
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,69 @@
+#pragma once
+
+#ifndef LZ_SHUFFLED_ITERABLE_HPP
+#define LZ_SHUFFLED_ITERABLE_HPP
+
+#include <Lz/detail/iterators/shuffled.hpp>
+#include <Lz/detail/maybe_owned.hpp>
+#include <Lz/detail/traits/is_sized.hpp>
+#include <Lz/procs/size.hpp>
+#include <cstdint>
+
+namespace lz {
+namespace detail {
+template<class Iterable>
+class shuffled_iterable : public lazy_view {
+    using inner_iter = iter_t<Iterable>;
+
+    static_assert(is_ra<inner_iter>::value, "shuffled requires a random access iterable");
+    static_assert(is_sized<Iterable>::value, "shuffled requires a sized iterable");
+
+    maybe_owned<Iterable> _iterable{};
+    std::uint64_t _seed{};
+
+    LZ_NODISCARD index_permutation permutation() const {
+        return { _seed, static_cast<std::uint64_t>(size()) };
+    }
+
+public:
+    using iterator = shuffled_iterator<inner_iter>;
+    using sentinel = iterator;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr shuffled_iterable()
+        requires(std::default_initializable<maybe_owned<Iterable>>)
+    = default;
+
+#else
+
+    template<class I = decltype(_iterable), class = enable_if_t<std::is_default_constructible<I>::value>>
+    constexpr shuffled_iterable() noexcept(std::is_nothrow_default_constructible<maybe_owned<Iterable>>::value) {
+    }
+
+#endif
+
+    template<class I>
+    constexpr shuffled_iterable(I&& iterable, const std::uint64_t seed) :
+        _iterable{ std::forward<I>(iterable) },
+        _seed{ seed } {
+    }
+
+    LZ_NODISCARD constexpr size_t size() const {
+        return static_cast<size_t>(lz::size(_iterable));
+    }
+
+    LZ_NODISCARD iterator begin() const {
+        return { _iterable.begin(), permutation(), 0 };
+    }
+
+    LZ_NODISCARD iterator end() const {
+        return { _iterable.begin(), permutation(), static_cast<diff_type<inner_iter>>(size()) };
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
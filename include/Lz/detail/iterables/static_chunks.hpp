@@ -0,0 +1,109 @@
+#pragma once
+
+#ifndef LZ_STATIC_CHUNKS_ITERABLE_HPP
+#define LZ_STATIC_CHUNKS_ITERABLE_HPP
+
+#include <Lz/detail/iterators/static_chunks.hpp>
+#include <Lz/detail/maybe_owned.hpp>
+#include <Lz/detail/traits/is_sentinel.hpp>
+#include <Lz/detail/traits/static_size.hpp>
+#include <Lz/procs/eager_size.hpp>
+
+namespace lz {
+namespace detail {
+template<class Iterable, size_t N>
+class static_chunks_iterable : public lazy_view {
+    static_assert(N != 0, "Chunk size must be greater than 0");
+    static_assert(is_fwd<iter_t<Iterable>>::value, "static_chunks requires a forward iterable");
+
+    maybe_owned<Iterable> _iterable{};
+
+    using iter = iter_t<Iterable>;
+    using diff = diff_type<iter>;
+
+public:
+    using iterator = static_chunks_iterator<iter, N>;
+    using sentinel = default_sentinel_t;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    static constexpr bool return_sentinel = !is_ra<iter>::value || is_sentinel<iter, sentinel_t<Iterable>>::value;
+
+    LZ_NODISCARD diff chunk_count() const {
+        return static_cast<diff>(lz::eager_size(_iterable)) / static_cast<diff>(N);
+    }
+
+public:
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr static_chunks_iterable()
+        requires(std::default_initializable<maybe_owned<Iterable>>)
+    = default;
+
+#else
+
+    template<class I = decltype(_iterable), class = enable_if_t<std::is_default_constructible<I>::value>>
+    constexpr static_chunks_iterable() noexcept(std::is_nothrow_default_constructible<maybe_owned<Iterable>>::value) {
+    }
+
+#endif
+
+    template<class I>
+    constexpr explicit static_chunks_iterable(I&& iterable) : _iterable{ std::forward<I>(iterable) } {
+    }
+
+#ifdef LZ_HAS_CONCEPTS
+
+    [[nodiscard]] constexpr size_t size() const
+        requires(sized<Iterable>)
+    {
+        return static_cast<size_t>(lz::size(_iterable)) / N;
+    }
+
+#else
+
+    template<class I = Iterable>
+    LZ_NODISCARD constexpr enable_if_t<is_sized<I>::value, size_t> size() const {
+        return static_cast<size_t>(lz::size(_iterable)) / N;
+    }
+
+#endif
+
+    LZ_NODISCARD iterator begin() const {
+        return { _iterable.begin(), chunk_count() };
+    }
+
+#ifdef LZ_HAS_CXX_17
+
+    [[nodiscard]] auto end() const {
+        if constexpr (!return_sentinel) {
+            return iterator{ _iterable.begin() + chunk_count() * static_cast<diff>(N), 0 };
+        }
+        else {
+            return lz::default_sentinel;
+        }
+    }
+
+#else
+
+    template<bool R = return_sentinel>
+    LZ_NODISCARD enable_if_t<!R, iterator> end() const {
+        return { _iterable.begin() + chunk_count() * static_cast<diff>(N), 0 };
+    }
+
+    template<bool R = return_sentinel>
+    LZ_NODISCARD constexpr enable_if_t<R, sentinel> end() const {
+        return lz::default_sentinel;
+    }
+
+#endif
+};
+
+template<class Iterable, size_t N>
+struct static_size_impl<static_chunks_iterable<Iterable, N>, enable_if_t<has_static_size<Iterable>::value>>
+    : std::integral_constant<size_t, static_size<Iterable>::value / N> {};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -13,7 +13,7 @@ namespace detail {
 template<class Iterable, class UnaryPredicate>
 class take_while_iterable : public lazy_view {
     maybe_owned<Iterable> _iterable{};
-    func_container<UnaryPredicate> _unary_predicate{};
+    LZ_NO_UNIQUE_ADDRESS func_container<UnaryPredicate> _unary_predicate{};
 
     using it = iter_t<Iterable>;
     using sent = sentinel_t<Iterable>;
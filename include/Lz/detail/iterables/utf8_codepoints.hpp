@@ -0,0 +1,65 @@
+#pragma once
+
+#ifndef LZ_UTF8_CODEPOINTS_ITERABLE_HPP
+#define LZ_UTF8_CODEPOINTS_ITERABLE_HPP
+
+#include <Lz/detail/iterators/utf8_codepoints.hpp>
+#include <Lz/traits/lazy_view.hpp>
+
+namespace lz {
+namespace detail {
+
+template<class End>
+class utf8_codepoints_iterable : public lazy_view {
+    const char* _begin{};
+    End _end{};
+
+    static constexpr bool is_null_terminated = std::is_same<End, default_sentinel_t>::value;
+
+public:
+    using iterator = utf8_codepoints_iterator<End>;
+    using sentinel = typename iterator::sentinel;
+    using const_iterator = iterator;
+    using value_type = char32_t;
+
+    constexpr utf8_codepoints_iterable() = default;
+    utf8_codepoints_iterable(const utf8_codepoints_iterable&) = default;
+    utf8_codepoints_iterable& operator=(const utf8_codepoints_iterable&) = default;
+
+    constexpr utf8_codepoints_iterable(const char* begin, const End end) noexcept : _begin{ begin }, _end{ end } {
+    }
+
+    LZ_NODISCARD iterator begin() const noexcept {
+        return { _begin, _end };
+    }
+
+#ifdef LZ_HAS_CXX_17
+
+    [[nodiscard]] auto end() const noexcept {
+        if constexpr (!is_null_terminated) {
+            return iterator{ _end, _end };
+        }
+        else {
+            return lz::default_sentinel;
+        }
+    }
+
+#else
+
+    template<bool B = is_null_terminated>
+    LZ_NODISCARD enable_if_t<!B, iterator> end() const noexcept {
+        return { _end, _end };
+    }
+
+    template<bool B = is_null_terminated>
+    LZ_NODISCARD constexpr enable_if_t<B, default_sentinel_t> end() const noexcept {
+        return {};
+    }
+
+#endif
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_UTF8_CODEPOINTS_ITERABLE_HPP
@@ -6,6 +6,7 @@
 #include <Lz/detail/iterators/zip.hpp>
 #include <Lz/detail/maybe_owned.hpp>
 #include <Lz/detail/traits/is_sentinel.hpp>
+#include <Lz/detail/traits/static_size.hpp>
 #include <Lz/detail/tuple_helpers.hpp>
 #include <Lz/traits/lazy_view.hpp>
 
@@ -120,6 +121,9 @@ public:
         return concat_iterables(std::forward<Iterable>(iterable), std::move(zipper), seq{});
     }
 };
+
+template<class... Iterables>
+struct static_size_impl<zip_iterable<Iterables...>> : min_static_size<Iterables...> {};
 } // namespace detail
 } // namespace lz
 
@@ -0,0 +1,86 @@
+#pragma once
+
+#ifndef LZ_CHANNEL_ITERATOR_HPP
+#define LZ_CHANNEL_ITERATOR_HPP
+
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/addressof.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <memory>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+template<class Channel>
+class channel_iterator : public iterator<channel_iterator<Channel>, typename Channel::value_type&, typename Channel::value_type*,
+                                         std::ptrdiff_t, std::input_iterator_tag, default_sentinel_t> {
+    using T = typename Channel::value_type;
+
+    struct batch {
+        std::vector<T> items{};
+        size_t index{};
+        // Kept in the shared batch, so that every copy of this iterator sees the end of the channel
+        bool done{ false };
+    };
+
+    Channel* _channel{ nullptr };
+    // Shared, so that copies of this iterator are cheap and advance together, as is expected from an input iterator
+    std::shared_ptr<batch> _batch{};
+
+    void refill() {
+        _batch->items.clear();
+        _batch->index = 0;
+        _batch->done = _channel->pop_batch(_batch->items, _channel->batch_size()) == 0;
+    }
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using pointer = T*;
+    using difference_type = std::ptrdiff_t;
+
+    channel_iterator() = default;
+    channel_iterator(const channel_iterator&) = default;
+    channel_iterator& operator=(const channel_iterator&) = default;
+
+    explicit channel_iterator(Channel& channel) : _channel{ detail::addressof(channel) }, _batch{ std::make_shared<batch>() } {
+        _batch->items.reserve(channel.batch_size());
+        refill();
+    }
+
+    channel_iterator& operator=(default_sentinel_t) noexcept {
+        _batch = nullptr;
+        return *this;
+    }
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(!eq(lz::default_sentinel));
+        return _batch->items[_batch->index];
+    }
+
+    pointer arrow() const {
+        return detail::addressof(dereference());
+    }
+
+    void increment() {
+        LZ_ASSERT_INCREMENTABLE(!eq(lz::default_sentinel));
+        if (++_batch->index == _batch->items.size()) {
+            refill();
+        }
+    }
+
+    bool eq(const channel_iterator& other) const noexcept {
+        const bool is_end = eq(lz::default_sentinel);
+        return is_end == other.eq(lz::default_sentinel) && (is_end || _batch == other._batch);
+    }
+
+    bool eq(default_sentinel_t) const noexcept {
+        return _batch == nullptr || _batch->done;
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_CHANNEL_ITERATOR_HPP
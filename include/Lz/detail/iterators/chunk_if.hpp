@@ -32,7 +32,7 @@ private:
     Iterator _sub_range_end{};
     bool _ends_with_trailing{ true };
     S _end{};
-    mutable UnaryPredicate _predicate{};
+    LZ_NO_UNIQUE_ADDRESS mutable UnaryPredicate _predicate{};
 
     LZ_CONSTEXPR_CXX_14 void find_next() {
         _sub_range_end = detail::find_if(_sub_range_end, _end, _predicate);
@@ -0,0 +1,121 @@
+#pragma once
+
+#ifndef LZ_CONCATENATE_DYNAMIC_ITERATOR_HPP
+#define LZ_CONCATENATE_DYNAMIC_ITERATOR_HPP
+
+#include <Lz/detail/fake_ptr_proxy.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+/**
+ * The segment table of a concatenate_dynamic_iterable: the begin iterator of every (non empty) segment and the flat index of its
+ * first element. The last offset is the total size, so there is one more offset than there are segments.
+ */
+template<class Iterator>
+struct concatenate_dynamic_segments {
+    std::vector<Iterator> begins{};
+    std::vector<size_t> offsets{ 0 };
+};
+
+template<class Iterator>
+class concatenate_dynamic_iterator
+    : public iterator<concatenate_dynamic_iterator<Iterator>, ref_t<Iterator>, fake_ptr_proxy<ref_t<Iterator>>,
+                      diff_type<Iterator>, std::random_access_iterator_tag, default_sentinel_t> {
+
+    using segment_table = concatenate_dynamic_segments<Iterator>;
+    using traits = std::iterator_traits<Iterator>;
+
+    const segment_table* _segments{ nullptr };
+    // Index of the segment that contains the current element
+    size_t _segment{};
+    size_t _index{};
+
+    LZ_NODISCARD size_t locate(const size_t index) const {
+        const auto& offsets = _segments->offsets;
+        return static_cast<size_t>(std::upper_bound(offsets.begin(), offsets.end(), index) - offsets.begin()) - 1;
+    }
+
+    LZ_NODISCARD size_t total() const noexcept {
+        return _segments->offsets.back();
+    }
+
+public:
+    using value_type = typename traits::value_type;
+    using reference = typename traits::reference;
+    using pointer = fake_ptr_proxy<reference>;
+    using difference_type = typename traits::difference_type;
+
+    constexpr concatenate_dynamic_iterator() = default;
+
+    concatenate_dynamic_iterator(const segment_table* segments, const size_t index) : _segments{ segments }, _index{ index } {
+        _segment = locate(_index);
+    }
+
+    concatenate_dynamic_iterator& operator=(default_sentinel_t) {
+        _index = total();
+        _segment = _segments->begins.size();
+        return *this;
+    }
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(_index < total());
+        return *(_segments->begins[_segment] + static_cast<difference_type>(_index - _segments->offsets[_segment]));
+    }
+
+    pointer arrow() const {
+        return fake_ptr_proxy<decltype(**this)>(**this);
+    }
+
+    void increment() {
+        LZ_ASSERT_INCREMENTABLE(_index < total());
+        ++_index;
+        // Segments are never empty, so the next element is either in the current or in the next segment
+        if (_segments->offsets[_segment + 1] == _index) {
+            ++_segment;
+        }
+    }
+
+    void decrement() {
+        LZ_ASSERT_DECREMENTABLE(_index != 0);
+        --_index;
+        if (_segments->offsets[_segment] > _index) {
+            --_segment;
+        }
+    }
+
+    void plus_is(const difference_type offset) {
+        LZ_ASSERT_SUB_ADDABLE(offset < 0 ? static_cast<size_t>(-offset) <= _index
+                                         : static_cast<size_t>(offset) <= total() - _index);
+        _index = static_cast<size_t>(static_cast<difference_type>(_index) + offset);
+        _segment = locate(_index);
+    }
+
+    difference_type difference(const concatenate_dynamic_iterator& other) const {
+        LZ_ASSERT_COMPATIBLE(_segments == other._segments);
+        return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index);
+    }
+
+    difference_type difference(default_sentinel_t) const {
+        return static_cast<difference_type>(_index) - static_cast<difference_type>(total());
+    }
+
+    bool eq(const concatenate_dynamic_iterator& other) const {
+        LZ_ASSERT_COMPATIBLE(_segments == other._segments);
+        return _index == other._index;
+    }
+
+    bool eq(default_sentinel_t) const {
+        return _index == total();
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,99 @@
+#pragma once
+
+#ifndef LZ_COUNTER_RANDOM_ITERATOR_HPP
+#define LZ_COUNTER_RANDOM_ITERATOR_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/fake_ptr_proxy.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/util/random_engines.hpp>
+#include <cstdint>
+
+namespace lz {
+namespace detail {
+
+// Element i of seed s is drawn by a fresh copy of the distribution from the Philox stream with key s and counter (i, 0), so every
+// element is a pure function of (seed, i)
+template<class Distribution>
+LZ_NODISCARD typename Distribution::result_type
+counter_random_at(const Distribution& distribution, const std::uint64_t seed, const ptrdiff_t index) {
+    auto copy = distribution;
+    philox4x32 engine{ seed, 0, static_cast<std::uint64_t>(index) };
+    return copy(engine);
+}
+
+template<class Distribution>
+class counter_random_iterator
+    : public iterator<counter_random_iterator<Distribution>, typename Distribution::result_type,
+                      fake_ptr_proxy<typename Distribution::result_type>, ptrdiff_t, std::random_access_iterator_tag,
+                      counter_random_iterator<Distribution>> {
+    Distribution _distribution{};
+    std::uint64_t _seed{};
+    ptrdiff_t _index{};
+
+public:
+    using value_type = typename Distribution::result_type;
+    using difference_type = ptrdiff_t;
+    using pointer = fake_ptr_proxy<value_type>;
+    using reference = value_type;
+
+    constexpr counter_random_iterator(const counter_random_iterator&) = default;
+    LZ_CONSTEXPR_CXX_14 counter_random_iterator& operator=(const counter_random_iterator&) = default;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr counter_random_iterator()
+        requires(std::default_initializable<Distribution>)
+    = default;
+
+#else
+
+    template<class D = Distribution, class = enable_if_t<std::is_default_constructible<D>::value>>
+    constexpr counter_random_iterator() noexcept(std::is_nothrow_default_constructible<D>::value) {
+    }
+
+#endif
+
+    constexpr counter_random_iterator(const Distribution& distribution, const std::uint64_t seed, const ptrdiff_t index) :
+        _distribution{ distribution },
+        _seed{ seed },
+        _index{ index } {
+    }
+
+    value_type dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(_index >= 0);
+        return counter_random_at(_distribution, _seed, _index);
+    }
+
+    pointer arrow() const {
+        return fake_ptr_proxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_14 void increment() noexcept {
+        ++_index;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void decrement() noexcept {
+        --_index;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void plus_is(const difference_type n) noexcept {
+        _index += n;
+    }
+
+    LZ_CONSTEXPR_CXX_14 difference_type difference(const counter_random_iterator& other) const noexcept {
+        LZ_ASSERT_COMPATIBLE(_seed == other._seed);
+        return _index - other._index;
+    }
+
+    LZ_CONSTEXPR_CXX_14 bool eq(const counter_random_iterator& other) const noexcept {
+        LZ_ASSERT_COMPATIBLE(_seed == other._seed);
+        return _index == other._index;
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,277 @@
+#pragma once
+
+#ifndef LZ_CSV_ITERATOR_HPP
+#define LZ_CSV_ITERATOR_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/fake_ptr_proxy.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/traits/lazy_view.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <Lz/util/string_view.hpp>
+#include <string>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+// Offsets of the contents of a field in the source buffer, without enclosing quotes
+struct csv_field_bounds {
+    size_t first;
+    size_t last;
+    // If the field contains escaped (doubled) quotes, the offsets of its unescaped value in csv_index::unescaped
+    size_t unescaped_first;
+    size_t unescaped_last;
+    bool escaped;
+};
+
+// Result of the scan of a buffer: the fields of record i are fields[records[i]] until fields[records[i + 1]]. The values of
+// fields that contain escaped quotes are unescaped once, during the scan, and stored after each other in `unescaped`
+template<class CharT>
+struct csv_index {
+    std::vector<csv_field_bounds> fields{};
+    std::vector<size_t> records{ 0 };
+    std::basic_string<CharT> unescaped{};
+};
+
+/**
+ * A field of a CSV record. Its value refers to the source buffer, unless the field contains escaped quotes. In that case, the
+ * value refers to the unescaped value that is stored in the lz::csv iterable. In both cases, the value stays valid as long as
+ * the buffer and the lz::csv iterable (or a copy of it) exist.
+ */
+template<class CharT>
+class basic_csv_field {
+    basic_string_view<CharT> _raw{};
+    basic_string_view<CharT> _value{};
+    bool _escaped{};
+
+public:
+    constexpr basic_csv_field() = default;
+
+    constexpr basic_csv_field(const basic_string_view<CharT> raw, const basic_string_view<CharT> value,
+                              const bool escaped) noexcept :
+        _raw{ raw },
+        _value{ value },
+        _escaped{ escaped } {
+    }
+
+    /**
+     * @return The field as it is in the source buffer, without enclosing quotes. Escaped quotes are not unescaped.
+     */
+    LZ_NODISCARD constexpr basic_string_view<CharT> raw() const noexcept {
+        return _raw;
+    }
+
+    /**
+     * @return Whether the field contains escaped quotes, which means that value() refers to the unescaped value stored in the
+     * lz::csv iterable instead of the source buffer.
+     */
+    LZ_NODISCARD constexpr bool escaped() const noexcept {
+        return _escaped;
+    }
+
+    /**
+     * @return The value of the field. Refers to the source buffer, or to the lz::csv iterable if escaped() is true.
+     */
+    LZ_NODISCARD constexpr basic_string_view<CharT> value() const noexcept {
+        return _value;
+    }
+
+    /**
+     * @return A copy of the value of the field.
+     */
+    LZ_NODISCARD std::basic_string<CharT> str() const {
+        return { _value.data(), _value.size() };
+    }
+
+    LZ_NODISCARD friend bool operator==(const basic_csv_field& lhs, const basic_string_view<CharT> rhs) noexcept {
+        return lhs.value() == rhs;
+    }
+
+    LZ_NODISCARD friend bool operator==(const basic_string_view<CharT> lhs, const basic_csv_field& rhs) noexcept {
+        return rhs == lhs;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const basic_csv_field& lhs, const basic_string_view<CharT> rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    LZ_NODISCARD friend bool operator!=(const basic_string_view<CharT> lhs, const basic_csv_field& rhs) noexcept {
+        return !(rhs == lhs);
+    }
+};
+
+template<class CharT>
+class csv_field_iterator
+    : public iterator<csv_field_iterator<CharT>, basic_csv_field<CharT>, fake_ptr_proxy<basic_csv_field<CharT>>, std::ptrdiff_t,
+                      std::random_access_iterator_tag> {
+    const CharT* _buffer{};
+    const CharT* _unescaped{};
+    const csv_field_bounds* _bounds{};
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = basic_csv_field<CharT>;
+    using reference = value_type;
+    using pointer = fake_ptr_proxy<reference>;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr csv_field_iterator() = default;
+
+    constexpr csv_field_iterator(const CharT* buffer, const CharT* unescaped, const csv_field_bounds* bounds) noexcept :
+        _buffer{ buffer },
+        _unescaped{ unescaped },
+        _bounds{ bounds } {
+    }
+
+    csv_field_iterator& operator=(default_sentinel_t) = delete;
+
+    LZ_CONSTEXPR_CXX_14 reference dereference() const noexcept {
+        const basic_string_view<CharT> raw{ _buffer + _bounds->first, _bounds->last - _bounds->first };
+        if (!_bounds->escaped) {
+            return { raw, raw, false };
+        }
+        return { raw, { _unescaped + _bounds->unescaped_first, _bounds->unescaped_last - _bounds->unescaped_first }, true };
+    }
+
+    LZ_CONSTEXPR_CXX_14 pointer arrow() const noexcept {
+        return fake_ptr_proxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_14 void increment() noexcept {
+        ++_bounds;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void decrement() noexcept {
+        --_bounds;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void plus_is(const difference_type offset) noexcept {
+        _bounds += offset;
+    }
+
+    difference_type difference(default_sentinel_t) const = delete;
+
+    LZ_CONSTEXPR_CXX_14 difference_type difference(const csv_field_iterator& other) const noexcept {
+        LZ_ASSERT_COMPATIBLE(_buffer == other._buffer);
+        return _bounds - other._bounds;
+    }
+
+    LZ_CONSTEXPR_CXX_14 bool eq(const csv_field_iterator& other) const noexcept {
+        LZ_ASSERT_COMPATIBLE(_buffer == other._buffer);
+        return _bounds == other._bounds;
+    }
+};
+
+/**
+ * A record of a CSV buffer, which is a random access iterable of its fields. Refers to the source buffer and the lz::csv
+ * iterable that it came from.
+ */
+template<class CharT>
+class basic_csv_record : public lazy_view {
+    const CharT* _buffer{};
+    const CharT* _unescaped{};
+    const csv_field_bounds* _first{};
+    const csv_field_bounds* _last{};
+
+public:
+    using iterator = csv_field_iterator<CharT>;
+    using const_iterator = iterator;
+    using value_type = basic_csv_field<CharT>;
+
+    constexpr basic_csv_record() = default;
+
+    constexpr basic_csv_record(const CharT* buffer, const CharT* unescaped, const csv_field_bounds* first,
+                               const csv_field_bounds* last) noexcept :
+        _buffer{ buffer },
+        _unescaped{ unescaped },
+        _first{ first },
+        _last{ last } {
+    }
+
+    LZ_NODISCARD constexpr size_t size() const noexcept {
+        return static_cast<size_t>(_last - _first);
+    }
+
+    LZ_NODISCARD value_type operator[](const size_t index) const {
+        LZ_ASSERT(index < size(), "Index out of bounds");
+        return *(begin() + static_cast<std::ptrdiff_t>(index));
+    }
+
+    LZ_NODISCARD constexpr iterator begin() const noexcept {
+        return { _buffer, _unescaped, _first };
+    }
+
+    LZ_NODISCARD constexpr iterator end() const noexcept {
+        return { _buffer, _unescaped, _last };
+    }
+};
+
+template<class CharT>
+class csv_iterator : public iterator<csv_iterator<CharT>, basic_csv_record<CharT>, fake_ptr_proxy<basic_csv_record<CharT>>,
+                                     std::ptrdiff_t, std::random_access_iterator_tag> {
+    const CharT* _buffer{};
+    const csv_index<CharT>* _index{};
+    size_t _record{};
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = basic_csv_record<CharT>;
+    using reference = value_type;
+    using pointer = fake_ptr_proxy<reference>;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr csv_iterator() = default;
+
+    constexpr csv_iterator(const CharT* buffer, const csv_index<CharT>* index, const size_t record) noexcept :
+        _buffer{ buffer },
+        _index{ index },
+        _record{ record } {
+    }
+
+    csv_iterator& operator=(default_sentinel_t) = delete;
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(_record + 1 < _index->records.size());
+        const auto* fields = _index->fields.data();
+        return { _buffer, _index->unescaped.data(), fields + _index->records[_record], fields + _index->records[_record + 1] };
+    }
+
+    pointer arrow() const {
+        return fake_ptr_proxy<decltype(**this)>(**this);
+    }
+
+    void increment() {
+        LZ_ASSERT_INCREMENTABLE(_record + 1 < _index->records.size());
+        ++_record;
+    }
+
+    void decrement() {
+        LZ_ASSERT_DECREMENTABLE(_record != 0);
+        --_record;
+    }
+
+    void plus_is(const difference_type offset) {
+        LZ_ASSERT_SUB_ADDABLE(offset < 0 ? static_cast<size_t>(-offset) <= _record
+                                         : static_cast<size_t>(offset) < _index->records.size() - _record);
+        _record = static_cast<size_t>(static_cast<difference_type>(_record) + offset);
+    }
+
+    difference_type difference(default_sentinel_t) const = delete;
+
+    difference_type difference(const csv_iterator& other) const {
+        LZ_ASSERT_COMPATIBLE(_index == other._index);
+        return static_cast<difference_type>(_record) - static_cast<difference_type>(other._record);
+    }
+
+    bool eq(const csv_iterator& other) const {
+        LZ_ASSERT_COMPATIBLE(_index == other._index);
+        return _record == other._record;
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -6,6 +6,7 @@
 #include <Lz/algorithm/find_if.hpp>
 #include <Lz/detail/fake_ptr_proxy.hpp>
 #include <Lz/detail/iterator.hpp>
+#include <Lz/detail/stored_end.hpp>
 #include <Lz/detail/traits/iterator_categories.hpp>
 #include <Lz/detail/traits/strict_iterator_traits.hpp>
 #include <Lz/util/default_sentinel.hpp>
@@ -24,6 +25,7 @@ class duplicates_iterator<Iterable, BinaryPredicate, enable_if_t<is_ra<iter_t<It
 
     using it = iter_t<Iterable>;
     using traits = std::iterator_traits<it>;
+    using stored_iterable = compact_iterable_t<Iterable, is_bidi<it>::value>;
 
 public:
     using value_type = std::pair<typename traits::value_type, size_t>;
@@ -34,8 +36,8 @@ public:
 private:
     it _last{};
     it _first{};
-    Iterable _iterable{};
-    mutable BinaryPredicate _compare{};
+    stored_iterable _iterable{};
+    LZ_NO_UNIQUE_ADDRESS mutable BinaryPredicate _compare{};
 
     LZ_CONSTEXPR_CXX_14 void next() {
         _last =
@@ -49,17 +51,17 @@ public:
 #ifdef LZ_HAS_CONCEPTS
 
     constexpr duplicates_iterator()
-        requires(std::default_initializable<it> && std::default_initializable<Iterable> &&
+        requires(std::default_initializable<it> && std::default_initializable<stored_iterable> &&
                  std::default_initializable<BinaryPredicate>)
     = default;
 
 #else
 
-    template<class I = it,
-             class = enable_if_t<std::is_default_constructible<I>::value && std::is_default_constructible<Iterable>::value &&
-                                 std::is_default_constructible<BinaryPredicate>::value>>
+    template<class I = it, class = enable_if_t<std::is_default_constructible<I>::value &&
+                                               std::is_default_constructible<stored_iterable>::value &&
+                                               std::is_default_constructible<BinaryPredicate>::value>>
     constexpr duplicates_iterator() noexcept(std::is_nothrow_default_constructible<it>::value &&
-                                             std::is_nothrow_default_constructible<Iterable>::value &&
+                                             std::is_nothrow_default_constructible<stored_iterable>::value &&
                                              std::is_nothrow_default_constructible<BinaryPredicate>::value) {
     }
 
@@ -106,7 +108,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 bool eq(const duplicates_iterator& other) const {
-        LZ_ASSERT_COMPATIBLE(_iterable.begin() == other._iterable.begin() && _iterable.end() == other._iterable.end());
+        LZ_ASSERT_COMPATIBLE(_iterable.end() == other._iterable.end());
         return _first == other._first;
     }
 
@@ -123,6 +125,7 @@ class duplicates_iterator<Iterable, BinaryPredicate, enable_if_t<!is_ra<iter_t<I
 
     using it = iter_t<Iterable>;
     using traits = std::iterator_traits<iter_t<Iterable>>;
+    using stored_iterable = compact_iterable_t<Iterable, is_bidi<it>::value>;
 
 public:
     using value_type = std::pair<typename traits::value_type, size_t>;
@@ -133,9 +136,9 @@ public:
 private:
     it _last{};
     it _first{};
-    Iterable _iterable{};
+    stored_iterable _iterable{};
     difference_type _last_distance{};
-    mutable BinaryPredicate _compare{};
+    LZ_NO_UNIQUE_ADDRESS mutable BinaryPredicate _compare{};
 
     LZ_CONSTEXPR_CXX_14 void next() {
         _last_distance = 0;
@@ -155,17 +158,17 @@ public:
 #ifdef LZ_HAS_CONCEPTS
 
     constexpr duplicates_iterator()
-        requires(std::default_initializable<it> && std::default_initializable<Iterable> &&
+        requires(std::default_initializable<it> && std::default_initializable<stored_iterable> &&
                  std::default_initializable<BinaryPredicate>)
     = default;
 
 #else
 
-    template<class I = it,
-             class = enable_if_t<std::is_default_constructible<I>::value && std::is_default_constructible<Iterable>::value &&
-                                 std::is_default_constructible<BinaryPredicate>::value>>
+    template<class I = it, class = enable_if_t<std::is_default_constructible<I>::value &&
+                                               std::is_default_constructible<stored_iterable>::value &&
+                                               std::is_default_constructible<BinaryPredicate>::value>>
     constexpr duplicates_iterator() noexcept(std::is_nothrow_default_constructible<I>::value &&
-                                             std::is_nothrow_default_constructible<Iterable>::value &&
+                                             std::is_nothrow_default_constructible<stored_iterable>::value &&
                                              std::is_nothrow_default_constructible<BinaryPredicate>::value) {
     }
 
@@ -214,7 +217,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 bool eq(const duplicates_iterator& other) const {
-        LZ_ASSERT_COMPATIBLE(_iterable.begin() == other._iterable.begin() && _iterable.end() == other._iterable.end());
+        LZ_ASSERT_COMPATIBLE(_iterable.end() == other._iterable.end());
         return _first == other._first;
     }
 
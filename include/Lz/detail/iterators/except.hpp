@@ -4,6 +4,7 @@
 #define LZ_EXCEPT_ITERATOR_HPP
 
 #include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/stored_end.hpp>
 #include <Lz/algorithm/find_if.hpp>
 #include <Lz/detail/algorithm/lower_bound.hpp>
 #include <Lz/detail/fake_ptr_proxy.hpp>
@@ -23,6 +24,7 @@ class except_iterator : public iterator<except_iterator<Iterable, Iterable2, Bin
 
     using iter = iter_t<Iterable>;
     using iter_traits = std::iterator_traits<iter>;
+    using stored_iterable = compact_iterable_t<Iterable, is_bidi<iter>::value>;
 
 public:
     using value_type = typename iter_traits::value_type;
@@ -34,10 +36,10 @@ public:
     LZ_CONSTEXPR_CXX_14 except_iterator& operator=(const except_iterator&) = default;
 
 private:
-    Iterable _iterable{};
+    stored_iterable _iterable{};
     Iterable2 _to_except{};
     iter _iterator{};
-    mutable BinaryPredicate _predicate{};
+    LZ_NO_UNIQUE_ADDRESS mutable BinaryPredicate _predicate{};
 
     LZ_CONSTEXPR_CXX_14 void find_next() {
         _iterator = detail::find_if(std::move(_iterator), _iterable.end(), [this](reference value) {
@@ -51,20 +53,21 @@ public:
 #ifdef LZ_HAS_CONCEPTS
 
     constexpr except_iterator()
-        requires(std::default_initializable<Iterable> && std::default_initializable<Iterable2> &&
+        requires(std::default_initializable<stored_iterable> && std::default_initializable<Iterable2> &&
                  std::default_initializable<BinaryPredicate> && std::default_initializable<iter>)
     = default;
 
 #else
 
-    template<
-        class I = Iterable,
-        class = enable_if_t<std::is_default_constructible<I>::value && std::is_default_constructible<Iterable2>::value &&
-                            std::is_default_constructible<BinaryPredicate>::value && std::is_default_constructible<iter>::value>>
-    constexpr except_iterator() noexcept(std::is_nothrow_default_constructible<Iterable2>::value &&
-                                         std::is_nothrow_default_constructible<I>::value &&
-                                         std::is_nothrow_default_constructible<BinaryPredicate>::value &&
-                                         std::is_nothrow_default_constructible<iter>::value) {
+    template<class I = iter,
+             class = enable_if_t<std::is_default_constructible<I>::value &&
+                                 std::is_default_constructible<stored_iterable>::value &&
+                                 std::is_default_constructible<Iterable2>::value &&
+                                 std::is_default_constructible<BinaryPredicate>::value>>
+    constexpr except_iterator() noexcept(std::is_nothrow_default_constructible<I>::value &&
+                                         std::is_nothrow_default_constructible<stored_iterable>::value &&
+                                         std::is_nothrow_default_constructible<Iterable2>::value &&
+                                         std::is_nothrow_default_constructible<BinaryPredicate>::value) {
     }
 
 #endif
@@ -114,7 +117,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 bool eq(const except_iterator& other) const {
-        LZ_ASSERT_COMPATIBLE(_iterable.end() == other._iterable.end() && _iterable.begin() == other._iterable.begin() &&
+        LZ_ASSERT_COMPATIBLE(_iterable.end() == other._iterable.end() &&
                              _to_except.begin() == other._to_except.begin() && _to_except.end() == other._to_except.end());
         return _iterator == other._iterator;
     }
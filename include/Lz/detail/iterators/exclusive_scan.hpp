@@ -20,7 +20,7 @@ class exclusive_scan_iterator : public iterator<exclusive_scan_iterator<Iterator
     mutable T _reducer{};
     S _end{};
     bool _reached_end{ true };
-    mutable BinaryOp _binary_op{};
+    LZ_NO_UNIQUE_ADDRESS mutable BinaryOp _binary_op{};
 
     using traits = std::iterator_traits<Iterator>;
 
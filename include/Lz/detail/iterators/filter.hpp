@@ -7,6 +7,7 @@
 #include <Lz/detail/fake_ptr_proxy.hpp>
 #include <Lz/detail/iterator.hpp>
 #include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/stored_end.hpp>
 #include <Lz/detail/traits/iterator_categories.hpp>
 #include <Lz/detail/traits/strict_iterator_traits.hpp>
 #include <Lz/util/default_sentinel.hpp>
@@ -22,6 +23,7 @@ class filter_iterator
 
     using it = iter_t<Iterable>;
     using traits = std::iterator_traits<it>;
+    using stored_iterable = compact_iterable_t<Iterable, is_bidi<it>::value>;
 
 public:
     using value_type = typename traits::value_type;
@@ -38,24 +40,24 @@ public:
 
 private:
     it _iterator{};
-    Iterable _iterable{};
-    mutable UnaryPredicate _predicate{};
+    stored_iterable _iterable{};
+    LZ_NO_UNIQUE_ADDRESS mutable UnaryPredicate _predicate{};
 
 public:
 #ifdef LZ_HAS_CONCEPTS
 
     constexpr filter_iterator()
-        requires(std::default_initializable<Iterable> && std::default_initializable<it> &&
+        requires(std::default_initializable<stored_iterable> && std::default_initializable<it> &&
                  std::default_initializable<UnaryPredicate>)
     = default;
 
 #else
 
-    template<class I = it,
-             class = enable_if_t<std::is_default_constructible<I>::value && std::is_default_constructible<Iterable>::value &&
-                                 std::is_default_constructible<UnaryPredicate>::value>>
+    template<class I = it, class = enable_if_t<std::is_default_constructible<I>::value &&
+                                               std::is_default_constructible<stored_iterable>::value &&
+                                               std::is_default_constructible<UnaryPredicate>::value>>
     constexpr filter_iterator() noexcept(std::is_nothrow_default_constructible<I>::value &&
-                                         std::is_nothrow_default_constructible<Iterable>::value &&
+                                         std::is_nothrow_default_constructible<stored_iterable>::value &&
                                          std::is_nothrow_default_constructible<UnaryPredicate>::value) {
     }
 
@@ -97,7 +99,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 bool eq(const filter_iterator& other) const {
-        LZ_ASSERT_COMPATIBLE(_iterable.end() == other._iterable.end() && _iterable.begin() == other._iterable.begin());
+        LZ_ASSERT_COMPATIBLE(_iterable.end() == other._iterable.end());
         return _iterator == other._iterator;
     }
 
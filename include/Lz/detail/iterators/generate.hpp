@@ -20,7 +20,7 @@ class generate_iterator<GeneratorFunc, false>
     : public iterator<generate_iterator<GeneratorFunc, false>, func_ret_type<GeneratorFunc>,
                       fake_ptr_proxy<func_ret_type<GeneratorFunc>>, ptrdiff_t, std::forward_iterator_tag, default_sentinel_t> {
 
-    mutable GeneratorFunc _func{};
+    LZ_NO_UNIQUE_ADDRESS mutable GeneratorFunc _func{};
     ptrdiff_t _current{};
 
 public:
@@ -82,7 +82,7 @@ class generate_iterator<GeneratorFunc, true>
                       fake_ptr_proxy<func_ret_type<GeneratorFunc>>, std::ptrdiff_t, std::forward_iterator_tag,
                       default_sentinel_t> {
 
-    mutable GeneratorFunc _func{};
+    LZ_NO_UNIQUE_ADDRESS mutable GeneratorFunc _func{};
 
 public:
     using reference = func_ret_type<GeneratorFunc>;
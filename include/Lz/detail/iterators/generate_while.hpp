@@ -25,7 +25,7 @@ class generate_while_iterator
     using boolean_type = typename std::tuple_element<1, fn_return_type>::type;
 
     fn_return_type _last_returned{ type{}, static_cast<boolean_type>(true) };
-    mutable GeneratorFunc _func{};
+    LZ_NO_UNIQUE_ADDRESS mutable GeneratorFunc _func{};
 
 public:
 #ifdef LZ_HAS_CONCEPTS
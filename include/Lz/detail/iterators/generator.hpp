@@ -0,0 +1,75 @@
+#pragma once
+
+#ifndef LZ_GENERATOR_ITERATOR_HPP
+#define LZ_GENERATOR_ITERATOR_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+
+#ifdef LZ_HAS_COROUTINES
+
+#include <Lz/detail/generator_promise.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <coroutine>
+
+namespace lz {
+namespace detail {
+
+template<class T>
+class generator_iterator
+    : public iterator<generator_iterator<T>, const T&, const T*, std::ptrdiff_t, std::input_iterator_tag, default_sentinel_t> {
+
+    std::coroutine_handle<> _coroutine{};
+    generator_promise_base<T>* _root{ nullptr };
+
+public:
+    using value_type = T;
+    using reference = const T&;
+    using pointer = const T*;
+    using difference_type = std::ptrdiff_t;
+
+    generator_iterator() = default;
+    generator_iterator(const generator_iterator&) = default;
+    generator_iterator& operator=(const generator_iterator&) = default;
+
+    generator_iterator(std::coroutine_handle<> coroutine, generator_promise_base<T>& root) noexcept :
+        _coroutine{ coroutine },
+        _root{ detail::addressof(root) } {
+    }
+
+    generator_iterator& operator=(default_sentinel_t) noexcept {
+        _coroutine = nullptr;
+        _root = nullptr;
+        return *this;
+    }
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(!eq(lz::default_sentinel));
+        return *_root->_value;
+    }
+
+    pointer arrow() const {
+        return detail::addressof(dereference());
+    }
+
+    void increment() {
+        LZ_ASSERT_INCREMENTABLE(!eq(lz::default_sentinel));
+        // Resume the innermost generator directly, instead of going through all the generators that yielded it
+        _root->_leaf.resume();
+    }
+
+    bool eq(const generator_iterator& other) const noexcept {
+        return _coroutine == other._coroutine || (eq(lz::default_sentinel) && other.eq(lz::default_sentinel));
+    }
+
+    bool eq(default_sentinel_t) const noexcept {
+        return !_coroutine || _coroutine.done();
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_HAS_COROUTINES
+
+#endif // LZ_GENERATOR_ITERATOR_HPP
@@ -25,7 +25,7 @@ class group_by_iterator : public iterator<group_by_iterator<Iterable, BinaryPred
     it _sub_range_end{};
     it _sub_range_begin{};
     Iterable _iterable{};
-    mutable BinaryPredicate _comparer{};
+    LZ_NO_UNIQUE_ADDRESS mutable BinaryPredicate _comparer{};
 
     using ref_type = ref_t<it>;
 
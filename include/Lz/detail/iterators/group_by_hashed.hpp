@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef LZ_GROUP_BY_HASHED_ITERATOR_HPP
+#define LZ_GROUP_BY_HASHED_ITERATOR_HPP
+
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+template<class Key, class T>
+class group_by_hashed_iterator
+    : public iterator<group_by_hashed_iterator<Key, T>, const std::pair<Key, T>&, const std::pair<Key, T>*, std::ptrdiff_t,
+                      std::forward_iterator_tag, default_sentinel_t> {
+
+    using entries = std::vector<std::pair<Key, T>>;
+
+    // Shared, because the groups are only built once per begin() call, after which copies of the iterator must be cheap
+    std::shared_ptr<const entries> _entries{};
+    size_t _index{};
+
+    LZ_NODISCARD size_t entry_count() const noexcept {
+        return _entries ? _entries->size() : 0;
+    }
+
+public:
+    using value_type = std::pair<Key, T>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using difference_type = std::ptrdiff_t;
+
+    group_by_hashed_iterator() = default;
+
+    explicit group_by_hashed_iterator(std::shared_ptr<const entries> groups) noexcept : _entries{ std::move(groups) } {
+    }
+
+    group_by_hashed_iterator& operator=(default_sentinel_t) noexcept {
+        _index = entry_count();
+        return *this;
+    }
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(!eq(lz::default_sentinel));
+        return (*_entries)[_index];
+    }
+
+    pointer arrow() const {
+        return &dereference();
+    }
+
+    void increment() {
+        LZ_ASSERT_INCREMENTABLE(!eq(lz::default_sentinel));
+        ++_index;
+    }
+
+    bool eq(const group_by_hashed_iterator& other) const noexcept {
+        LZ_ASSERT_COMPATIBLE(_entries == other._entries);
+        return _index == other._index;
+    }
+
+    bool eq(default_sentinel_t) const noexcept {
+        return _index == entry_count();
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_GROUP_BY_HASHED_ITERATOR_HPP
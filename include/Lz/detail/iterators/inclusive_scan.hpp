@@ -18,7 +18,7 @@ class inclusive_scan_iterator : public iterator<inclusive_scan_iterator<Iterator
     Iterator _iterator{};
     mutable T _reducer{};
     S _end{};
-    mutable BinaryOp _binary_op{};
+    LZ_NO_UNIQUE_ADDRESS mutable BinaryOp _binary_op{};
 
     using traits = std::iterator_traits<Iterator>;
 
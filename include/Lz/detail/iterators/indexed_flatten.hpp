@@ -0,0 +1,132 @@
+#pragma once
+
+#ifndef LZ_INDEXED_FLATTEN_ITERATOR_HPP
+#define LZ_INDEXED_FLATTEN_ITERATOR_HPP
+
+#include <Lz/detail/fake_ptr_proxy.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/procs/begin_end.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+template<class Iterator>
+class indexed_flatten_iterator
+    : public iterator<indexed_flatten_iterator<Iterator>, ref_t<iter_t<ref_t<Iterator>>>,
+                      fake_ptr_proxy<ref_t<iter_t<ref_t<Iterator>>>>, diff_type<iter_t<ref_t<Iterator>>>,
+                      std::random_access_iterator_tag, default_sentinel_t> {
+
+    using inner_iter = iter_t<ref_t<Iterator>>;
+    using traits = std::iterator_traits<inner_iter>;
+
+    Iterator _outer{};
+    // _offsets[i] is the flat index of the first element of the i-th inner iterable, the last offset is the total size
+    const std::vector<size_t>* _offsets{ nullptr };
+    // Index of the inner iterable that contains the current element, skipping empty inner iterables
+    size_t _inner{};
+    size_t _index{};
+
+    LZ_NODISCARD size_t locate(const size_t index) const {
+        return static_cast<size_t>(std::upper_bound(_offsets->begin(), _offsets->end(), index) - _offsets->begin()) - 1;
+    }
+
+    LZ_NODISCARD size_t total() const noexcept {
+        return _offsets->back();
+    }
+
+public:
+    using value_type = typename traits::value_type;
+    using reference = typename traits::reference;
+    using pointer = fake_ptr_proxy<reference>;
+    using difference_type = typename traits::difference_type;
+
+    constexpr indexed_flatten_iterator(const indexed_flatten_iterator&) = default;
+    LZ_CONSTEXPR_CXX_14 indexed_flatten_iterator& operator=(const indexed_flatten_iterator&) = default;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr indexed_flatten_iterator()
+        requires(std::default_initializable<Iterator>)
+    = default;
+
+#else
+
+    template<class I = Iterator, class = enable_if_t<std::is_default_constructible<I>::value>>
+    constexpr indexed_flatten_iterator() noexcept(std::is_nothrow_default_constructible<Iterator>::value) {
+    }
+
+#endif
+
+    indexed_flatten_iterator(Iterator outer, const std::vector<size_t>* offsets, const size_t index) :
+        _outer{ std::move(outer) },
+        _offsets{ offsets },
+        _index{ index } {
+        _inner = locate(_index);
+    }
+
+    indexed_flatten_iterator& operator=(default_sentinel_t) {
+        _index = total();
+        _inner = _offsets->size() - 1;
+        return *this;
+    }
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(_index < total());
+        auto&& inner = *(_outer + static_cast<diff_type<Iterator>>(_inner));
+        return *(detail::begin(inner) + static_cast<difference_type>(_index - (*_offsets)[_inner]));
+    }
+
+    pointer arrow() const {
+        return fake_ptr_proxy<decltype(**this)>(**this);
+    }
+
+    void increment() {
+        LZ_ASSERT_INCREMENTABLE(_index < total());
+        ++_index;
+        while (_inner + 1 < _offsets->size() && (*_offsets)[_inner + 1] <= _index) {
+            ++_inner;
+        }
+    }
+
+    void decrement() {
+        LZ_ASSERT_DECREMENTABLE(_index != 0);
+        --_index;
+        while ((*_offsets)[_inner] > _index) {
+            --_inner;
+        }
+    }
+
+    void plus_is(const difference_type offset) {
+        LZ_ASSERT_SUB_ADDABLE(offset < 0 ? static_cast<size_t>(-offset) <= _index
+                                         : static_cast<size_t>(offset) <= total() - _index);
+        _index = static_cast<size_t>(static_cast<difference_type>(_index) + offset);
+        _inner = locate(_index);
+    }
+
+    difference_type difference(const indexed_flatten_iterator& other) const {
+        LZ_ASSERT_COMPATIBLE(_offsets == other._offsets);
+        return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index);
+    }
+
+    difference_type difference(default_sentinel_t) const {
+        return static_cast<difference_type>(_index) - static_cast<difference_type>(total());
+    }
+
+    bool eq(const indexed_flatten_iterator& other) const {
+        LZ_ASSERT_COMPATIBLE(_offsets == other._offsets);
+        return _index == other._index;
+    }
+
+    bool eq(default_sentinel_t) const {
+        return _index == total();
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
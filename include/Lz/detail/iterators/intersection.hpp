@@ -29,7 +29,7 @@ class intersection_iterator
     it2 _iterator2{};
     Iterable1 _iterable1{};
     Iterable2 _iterable2{};
-    mutable BinaryPredicate _compare{};
+    LZ_NO_UNIQUE_ADDRESS mutable BinaryPredicate _compare{};
 
     using iter_traits = std::iterator_traits<it1>;
 
@@ -9,6 +9,7 @@
 #include <Lz/detail/compiler_config.hpp>
 #include <Lz/detail/fake_ptr_proxy.hpp>
 #include <Lz/detail/iterator.hpp>
+#include <Lz/detail/stored_end.hpp>
 #include <Lz/detail/traits/func_ret_type.hpp>
 #include <Lz/detail/traits/iterator_categories.hpp>
 #include <Lz/detail/traits/remove_ref.hpp>
@@ -25,6 +26,7 @@ class join_where_iterator
                       bidi_strongest_cat<iter_cat_t<iter_t<IterableA>>>, default_sentinel_t> {
 private:
     using iter_a = iter_t<IterableA>;
+    using stored_iterable_a = compact_iterable_t<IterableA, false>;
     using traits_a = std::iterator_traits<iter_a>;
     using traits_b = std::iterator_traits<IterB>;
     using value_type_a = typename traits_a::value_type;
@@ -36,11 +38,11 @@ private:
     basic_iterable<IterB, SB> _iterable_b{};
     iter_a _iter_a{};
     IterB _begin_b{};
-    IterableA _iterable_a{};
+    stored_iterable_a _iterable_a{};
 
-    mutable SelectorA _selector_a{};
-    mutable SelectorB _selector_b{};
-    mutable ResultSelector _result_selector{};
+    LZ_NO_UNIQUE_ADDRESS mutable SelectorA _selector_a{};
+    LZ_NO_UNIQUE_ADDRESS mutable SelectorB _selector_b{};
+    LZ_NO_UNIQUE_ADDRESS mutable ResultSelector _result_selector{};
 
     LZ_CONSTEXPR_CXX_17 void find_next() {
         _iter_a = detail::find_if(std::move(_iter_a), _iterable_a.end(), [this](ref_t<iter_a> a) {
@@ -70,7 +72,7 @@ public:
 #ifdef LZ_HAS_CONCEPTS
 
     constexpr join_where_iterator()
-        requires(std::default_initializable<IterableA> && std::default_initializable<iter_a> &&
+        requires(std::default_initializable<stored_iterable_a> && std::default_initializable<iter_a> &&
                  std::default_initializable<IterB> && std::default_initializable<SB> && std::default_initializable<SelectorA> &&
                  std::default_initializable<SelectorB> && std::default_initializable<ResultSelector>)
     = default;
@@ -79,12 +81,12 @@ public:
 
     template<
         class I = iter_a,
-        class = enable_if_t<std::is_default_constructible<I>::value && std::is_default_constructible<IterableA>::value &&
+        class = enable_if_t<std::is_default_constructible<I>::value && std::is_default_constructible<stored_iterable_a>::value &&
                             std::is_default_constructible<IterB>::value && std::is_default_constructible<SB>::value &&
                             std::is_default_constructible<SelectorA>::value && std::is_default_constructible<SelectorB>::value &&
                             std::is_default_constructible<ResultSelector>::value>>
     constexpr join_where_iterator() noexcept(std::is_nothrow_default_constructible<I>::value &&
-                                             std::is_nothrow_default_constructible<IterableA>::value &&
+                                             std::is_nothrow_default_constructible<stored_iterable_a>::value &&
                                              std::is_nothrow_default_constructible<IterB>::value &&
                                              std::is_nothrow_default_constructible<SB>::value &&
                                              std::is_nothrow_default_constructible<SelectorA>::value &&
@@ -18,7 +18,7 @@ class map_iterator
     : public iterator<map_iterator<Iterator, S, UnaryOp>, func_ret_type_iter<UnaryOp, Iterator>,
                       fake_ptr_proxy<func_ret_type_iter<UnaryOp, Iterator>>, diff_type<Iterator>, iter_cat_t<Iterator>, S> {
     Iterator _iterator{};
-    mutable UnaryOp _unary_op{};
+    LZ_NO_UNIQUE_ADDRESS mutable UnaryOp _unary_op{};
 
     using traits = std::iterator_traits<Iterator>;
 
@@ -0,0 +1,98 @@
+#pragma once
+
+#ifndef LZ_MATCHER_SPLIT_ITERATOR_HPP
+#define LZ_MATCHER_SPLIT_ITERATOR_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/fake_ptr_proxy.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <Lz/util/string_view.hpp>
+#include <utility>
+
+namespace lz {
+namespace detail {
+
+template<class Matcher>
+class matcher_split_iterator
+    : public iterator<matcher_split_iterator<Matcher>, basic_string_view<typename Matcher::char_type>,
+                      fake_ptr_proxy<basic_string_view<typename Matcher::char_type>>, std::ptrdiff_t, std::forward_iterator_tag,
+                      default_sentinel_t> {
+    using char_type = typename Matcher::char_type;
+    using match = std::pair<const char_type*, const char_type*>;
+
+    const Matcher* _matcher{ nullptr };
+    // The current token is [_token, _match.first), _match is the match after the current token, or {_end, _end} if there is none
+    const char_type* _token{ nullptr };
+    match _match{ nullptr, nullptr };
+    const char_type* _end{ nullptr };
+
+    void find_next() {
+        _match = _matcher->find(_token, _end);
+    }
+
+    // Like std::regex_token_iterator, an empty token at the end is skipped
+    bool is_end() const noexcept {
+        return _token == _end && _match.first == _end;
+    }
+
+public:
+    using value_type = basic_string_view<char_type>;
+    using reference = value_type;
+    using pointer = fake_ptr_proxy<value_type>;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr matcher_split_iterator() = default;
+
+    matcher_split_iterator(const Matcher& matcher, const char_type* first, const char_type* last) :
+        _matcher{ &matcher },
+        _token{ first },
+        _end{ last } {
+        find_next();
+        // Like std::regex_token_iterator, empty tokens at the start are skipped
+        while (!is_end() && _token == _match.first) {
+            increment();
+        }
+    }
+
+    LZ_CONSTEXPR_CXX_14 matcher_split_iterator& operator=(default_sentinel_t) noexcept {
+        _token = _end;
+        _match = { _end, _end };
+        return *this;
+    }
+
+    void increment() {
+        LZ_ASSERT_INCREMENTABLE(!is_end());
+        if (_match.first == _end) {
+            _token = _end;
+            return;
+        }
+        _token = _match.second;
+        find_next();
+    }
+
+    value_type dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(!is_end());
+        return value_type(_token, static_cast<size_t>(_match.first - _token));
+    }
+
+    pointer arrow() const {
+        return fake_ptr_proxy<decltype(**this)>(**this);
+    }
+
+    bool eq(const matcher_split_iterator& other) const noexcept {
+        LZ_ASSERT_COMPATIBLE(_end == other._end);
+        return _token == other._token && _match.first == other._match.first;
+    }
+
+    bool eq(default_sentinel_t) const noexcept {
+        return is_end();
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,146 @@
+#pragma once
+
+#ifndef LZ_MEMOIZE_MAP_ITERATOR_HPP
+#define LZ_MEMOIZE_MAP_ITERATOR_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/memoize_cache.hpp>
+#include <Lz/detail/procs/addressof.hpp>
+#include <Lz/detail/traits/conditional.hpp>
+#include <Lz/detail/traits/func_ret_type.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+
+namespace lz {
+namespace detail {
+
+template<class Iterator, class UnaryOp>
+using memoize_cache_for =
+    memoize_cache<remove_cvref_t<func_ret_type_iter<UnaryOp&, Iterator>>, UnaryOp, is_ra<Iterator>::value>;
+
+template<class Iterator, class S, class UnaryOp>
+class memoize_map_iterator
+    : public iterator<memoize_map_iterator<Iterator, S, UnaryOp>,
+                      const remove_cvref_t<func_ret_type_iter<UnaryOp&, Iterator>>&,
+                      const remove_cvref_t<func_ret_type_iter<UnaryOp&, Iterator>>*, diff_type<Iterator>,
+                      conditional_t<is_ra<Iterator>::value, std::random_access_iterator_tag, std::forward_iterator_tag>, S> {
+
+    using cache = memoize_cache_for<Iterator, UnaryOp>;
+
+    Iterator _iterator{};
+    cache* _cache{ nullptr };
+    size_t _index{};
+
+    using traits = std::iterator_traits<Iterator>;
+
+public:
+    using value_type = remove_cvref_t<func_ret_type_iter<UnaryOp&, Iterator>>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using iterator_category =
+        conditional_t<is_ra<Iterator>::value, std::random_access_iterator_tag, std::forward_iterator_tag>;
+    using difference_type = typename traits::difference_type;
+
+    constexpr memoize_map_iterator(const memoize_map_iterator&) = default;
+    LZ_CONSTEXPR_CXX_14 memoize_map_iterator& operator=(const memoize_map_iterator&) = default;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr memoize_map_iterator()
+        requires(std::default_initializable<Iterator>)
+    = default;
+
+#else
+
+    template<class I = Iterator, class = enable_if_t<std::is_default_constructible<I>::value>>
+    constexpr memoize_map_iterator() noexcept(std::is_nothrow_default_constructible<Iterator>::value) {
+    }
+
+#endif
+
+    constexpr memoize_map_iterator(Iterator it, cache* c, const size_t index) :
+        _iterator{ std::move(it) },
+        _cache{ c },
+        _index{ index } {
+    }
+
+#ifdef LZ_HAS_CONCEPTS
+
+    LZ_CONSTEXPR_CXX_14 memoize_map_iterator& operator=(const S& s)
+        requires(is_ra<Iterator>::value)
+    {
+        _index = static_cast<size_t>(static_cast<difference_type>(_index) - (_iterator - s));
+        _iterator = s;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_14 memoize_map_iterator& operator=(const S& s)
+        requires(!is_ra<Iterator>::value)
+    {
+        _iterator = s;
+        return *this;
+    }
+
+#else
+
+    template<class I = Iterator>
+    LZ_CONSTEXPR_CXX_14 enable_if_t<is_ra<I>::value, memoize_map_iterator&> operator=(const S& s) {
+        _index = static_cast<size_t>(static_cast<difference_type>(_index) - (_iterator - s));
+        _iterator = s;
+        return *this;
+    }
+
+    template<class I = Iterator>
+    LZ_CONSTEXPR_CXX_14 enable_if_t<!is_ra<I>::value, memoize_map_iterator&> operator=(const S& s) {
+        _iterator = s;
+        return *this;
+    }
+
+#endif
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(_cache != nullptr);
+        return _cache->get(_index, _iterator);
+    }
+
+    pointer arrow() const {
+        return detail::addressof(dereference());
+    }
+
+    LZ_CONSTEXPR_CXX_14 void increment() {
+        ++_iterator;
+        ++_index;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void decrement() {
+        --_iterator;
+        --_index;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void plus_is(const difference_type offset) {
+        _iterator += offset;
+        _index = static_cast<size_t>(static_cast<difference_type>(_index) + offset);
+    }
+
+    constexpr difference_type difference(const memoize_map_iterator& other) const {
+        return _iterator - other._iterator;
+    }
+
+    constexpr difference_type difference(const S& other) const {
+        return _iterator - other;
+    }
+
+    constexpr bool eq(const memoize_map_iterator& other) const {
+        return _iterator == other._iterator;
+    }
+
+    constexpr bool eq(const S& s) const {
+        return _iterator == s;
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
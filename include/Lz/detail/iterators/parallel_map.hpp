@@ -0,0 +1,69 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_MAP_ITERATOR_HPP
+#define LZ_PARALLEL_MAP_ITERATOR_HPP
+
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/parallel_map_state.hpp>
+#include <Lz/detail/procs/addressof.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <memory>
+
+namespace lz {
+namespace detail {
+
+template<class Iterator, class S, class UnaryOp, bool Ordered>
+class parallel_map_iterator
+    : public iterator<parallel_map_iterator<Iterator, S, UnaryOp, Ordered>,
+                      typename parallel_map_state<Iterator, S, UnaryOp, Ordered>::value_type&,
+                      typename parallel_map_state<Iterator, S, UnaryOp, Ordered>::value_type*, std::ptrdiff_t,
+                      std::input_iterator_tag, default_sentinel_t> {
+
+    using state = parallel_map_state<Iterator, S, UnaryOp, Ordered>;
+
+    // Shared, because the worker threads are owned by the state and must outlive every copy of this iterator
+    std::shared_ptr<state> _state{};
+
+public:
+    using value_type = typename state::value_type;
+    using reference = value_type&;
+    using pointer = value_type*;
+    using difference_type = std::ptrdiff_t;
+
+    parallel_map_iterator() = default;
+
+    explicit parallel_map_iterator(std::shared_ptr<state> s) noexcept : _state{ std::move(s) } {
+    }
+
+    parallel_map_iterator& operator=(default_sentinel_t) noexcept {
+        _state = nullptr;
+        return *this;
+    }
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(!eq(lz::default_sentinel));
+        return _state->current();
+    }
+
+    pointer arrow() const {
+        return detail::addressof(dereference());
+    }
+
+    void increment() {
+        LZ_ASSERT_INCREMENTABLE(!eq(lz::default_sentinel));
+        _state->advance();
+    }
+
+    bool eq(const parallel_map_iterator& other) const noexcept {
+        return _state == other._state || (eq(lz::default_sentinel) && other.eq(lz::default_sentinel));
+    }
+
+    bool eq(default_sentinel_t) const noexcept {
+        return _state == nullptr || _state->at_end();
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PARALLEL_MAP_ITERATOR_HPP
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef LZ_PREFETCH_ASYNC_ITERATOR_HPP
+#define LZ_PREFETCH_ASYNC_ITERATOR_HPP
+
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/prefetch_async_state.hpp>
+#include <Lz/detail/procs/addressof.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <memory>
+
+namespace lz {
+namespace detail {
+
+template<class Iterator, class S>
+class prefetch_async_iterator
+    : public iterator<prefetch_async_iterator<Iterator, S>, typename prefetch_async_state<Iterator, S>::value_type&,
+                      typename prefetch_async_state<Iterator, S>::value_type*, std::ptrdiff_t, std::input_iterator_tag,
+                      default_sentinel_t> {
+
+    using state = prefetch_async_state<Iterator, S>;
+
+    // Shared, because the producer thread is owned by the state and must outlive every copy of this iterator
+    std::shared_ptr<state> _state{};
+
+public:
+    using value_type = typename state::value_type;
+    using reference = value_type&;
+    using pointer = value_type*;
+    using difference_type = std::ptrdiff_t;
+
+    prefetch_async_iterator() = default;
+
+    explicit prefetch_async_iterator(std::shared_ptr<state> s) noexcept : _state{ std::move(s) } {
+    }
+
+    prefetch_async_iterator& operator=(default_sentinel_t) noexcept {
+        _state = nullptr;
+        return *this;
+    }
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(!eq(lz::default_sentinel));
+        return _state->current();
+    }
+
+    pointer arrow() const {
+        return detail::addressof(dereference());
+    }
+
+    void increment() {
+        LZ_ASSERT_INCREMENTABLE(!eq(lz::default_sentinel));
+        _state->advance();
+    }
+
+    bool eq(const prefetch_async_iterator& other) const noexcept {
+        return _state == other._state || (eq(lz::default_sentinel) && other.eq(lz::default_sentinel));
+    }
+
+    bool eq(default_sentinel_t) const noexcept {
+        return _state == nullptr || _state->at_end();
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PREFETCH_ASYNC_ITERATOR_HPP
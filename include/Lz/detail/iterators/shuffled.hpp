@@ -0,0 +1,150 @@
+#pragma once
+
+#ifndef LZ_SHUFFLED_ITERATOR_HPP
+#define LZ_SHUFFLED_ITERATOR_HPP
+
+#include <Lz/detail/fake_ptr_proxy.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+#include <Lz/util/random_engines.hpp>
+#include <cstdint>
+
+namespace lz {
+namespace detail {
+
+/**
+ * A keyed bijection over [0, size). It's a balanced Feistel network over the smallest power of four that is at least `size`.
+ * Indices that are mapped outside of [0, size) are mapped again until they are inside (cycle walking). Since the domain is less
+ * than four times `size`, this takes less than four walks on average. Uses O(1) memory, regardless of `size`.
+ */
+class index_permutation {
+    static constexpr unsigned rounds = 6;
+
+    std::uint64_t _seed{};
+    std::uint64_t _size{};
+    unsigned _half_bits{ 1 };
+
+    LZ_NODISCARD std::uint64_t mask() const noexcept {
+        return (std::uint64_t{ 1 } << _half_bits) - 1;
+    }
+
+    LZ_NODISCARD std::uint64_t round_function(const std::uint64_t half, const unsigned round) const noexcept {
+        std::uint64_t state = _seed ^ (half * 0xD6E8FEB86659FD93ull) ^ (std::uint64_t{ round } << 56u);
+        return splitmix64(state) & mask();
+    }
+
+    LZ_NODISCARD std::uint64_t encrypt(const std::uint64_t index) const noexcept {
+        std::uint64_t left = index >> _half_bits;
+        std::uint64_t right = index & mask();
+        for (unsigned round = 0; round < rounds; ++round) {
+            const std::uint64_t next = left ^ round_function(right, round);
+            left = right;
+            right = next;
+        }
+        return (left << _half_bits) | right;
+    }
+
+public:
+    constexpr index_permutation() = default;
+
+    index_permutation(const std::uint64_t seed, const std::uint64_t size) noexcept : _seed{ seed }, _size{ size } {
+        unsigned bits = 0;
+        for (std::uint64_t n = size > 1 ? size - 1 : 1; n != 0; n >>= 1u) {
+            ++bits;
+        }
+        _half_bits = (bits + 1) / 2;
+    }
+
+    /**
+     * @return The position in [0, size) that @p index is mapped to. Every position is returned for exactly one index.
+     */
+    LZ_NODISCARD std::uint64_t operator()(std::uint64_t index) const noexcept {
+        LZ_ASSERT(index < _size, "Index out of range");
+        do {
+            index = encrypt(index);
+        } while (index >= _size);
+        return index;
+    }
+
+    LZ_NODISCARD bool operator==(const index_permutation& other) const noexcept {
+        return _seed == other._seed && _size == other._size;
+    }
+};
+
+template<class Iterator>
+class shuffled_iterator
+    : public iterator<shuffled_iterator<Iterator>, ref_t<Iterator>, fake_ptr_proxy<ref_t<Iterator>>, diff_type<Iterator>,
+                      std::random_access_iterator_tag, shuffled_iterator<Iterator>> {
+    using traits = std::iterator_traits<Iterator>;
+
+    Iterator _iterator{};
+    index_permutation _permutation{};
+    typename traits::difference_type _index{};
+
+public:
+    using value_type = typename traits::value_type;
+    using reference = typename traits::reference;
+    using pointer = fake_ptr_proxy<reference>;
+    using difference_type = typename traits::difference_type;
+
+    constexpr shuffled_iterator(const shuffled_iterator&) = default;
+    LZ_CONSTEXPR_CXX_14 shuffled_iterator& operator=(const shuffled_iterator&) = default;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr shuffled_iterator()
+        requires(std::default_initializable<Iterator>)
+    = default;
+
+#else
+
+    template<class I = Iterator, class = enable_if_t<std::is_default_constructible<I>::value>>
+    constexpr shuffled_iterator() noexcept(std::is_nothrow_default_constructible<I>::value) {
+    }
+
+#endif
+
+    shuffled_iterator(Iterator it, const index_permutation& permutation, const difference_type index) :
+        _iterator{ std::move(it) },
+        _permutation{ permutation },
+        _index{ index } {
+    }
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(_index >= 0);
+        return *(_iterator + static_cast<difference_type>(_permutation(static_cast<std::uint64_t>(_index))));
+    }
+
+    pointer arrow() const {
+        return fake_ptr_proxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_14 void increment() noexcept {
+        ++_index;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void decrement() noexcept {
+        LZ_ASSERT_DECREMENTABLE(_index > 0);
+        --_index;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void plus_is(const difference_type n) noexcept {
+        _index += n;
+    }
+
+    difference_type difference(const shuffled_iterator& other) const noexcept {
+        LZ_ASSERT_COMPATIBLE(_permutation == other._permutation);
+        return _index - other._index;
+    }
+
+    bool eq(const shuffled_iterator& other) const noexcept {
+        LZ_ASSERT_COMPATIBLE(_permutation == other._permutation);
+        return _index == other._index;
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,117 @@
+#pragma once
+
+#ifndef LZ_STATIC_CHUNKS_ITERATOR_HPP
+#define LZ_STATIC_CHUNKS_ITERATOR_HPP
+
+#include <Lz/detail/fake_ptr_proxy.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/traits/conditional.hpp>
+#include <Lz/detail/traits/index_sequence.hpp>
+#include <Lz/detail/traits/iterator_categories.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <array>
+
+namespace lz {
+namespace detail {
+
+template<class Iterator, size_t N>
+class static_chunks_iterator
+    : public iterator<static_chunks_iterator<Iterator, N>, std::array<val_t<Iterator>, N>,
+                      fake_ptr_proxy<std::array<val_t<Iterator>, N>>, diff_type<Iterator>,
+                      conditional_t<is_ra<Iterator>::value, std::random_access_iterator_tag, std::forward_iterator_tag>,
+                      default_sentinel_t> {
+
+    Iterator _iterator{};
+    // The number of complete chunks that are left, including the current one
+    diff_type<Iterator> _chunks_left{};
+
+    template<size_t... I>
+    static std::array<val_t<Iterator>, N> make_chunk(Iterator it, index_sequence<I...>) {
+        // The elements of a braced init list are evaluated in order
+        return { { (static_cast<void>(I), *it++)... } };
+    }
+
+public:
+    using value_type = std::array<val_t<Iterator>, N>;
+    using reference = value_type;
+    using pointer = fake_ptr_proxy<reference>;
+    using difference_type = diff_type<Iterator>;
+    using iterator_category =
+        conditional_t<is_ra<Iterator>::value, std::random_access_iterator_tag, std::forward_iterator_tag>;
+
+    constexpr static_chunks_iterator(const static_chunks_iterator&) = default;
+    LZ_CONSTEXPR_CXX_14 static_chunks_iterator& operator=(const static_chunks_iterator&) = default;
+
+#ifdef LZ_HAS_CONCEPTS
+
+    constexpr static_chunks_iterator()
+        requires(std::default_initializable<Iterator>)
+    = default;
+
+#else
+
+    template<class I = Iterator, class = enable_if_t<std::is_default_constructible<I>::value>>
+    constexpr static_chunks_iterator() noexcept(std::is_nothrow_default_constructible<Iterator>::value) {
+    }
+
+#endif
+
+    constexpr static_chunks_iterator(Iterator it, const difference_type chunks_left) :
+        _iterator{ std::move(it) },
+        _chunks_left{ chunks_left } {
+    }
+
+    LZ_CONSTEXPR_CXX_14 static_chunks_iterator& operator=(default_sentinel_t) {
+        _iterator = std::next(_iterator, _chunks_left * static_cast<difference_type>(N));
+        _chunks_left = 0;
+        return *this;
+    }
+
+    reference dereference() const {
+        LZ_ASSERT_DEREFERENCABLE(_chunks_left > 0);
+        return make_chunk(_iterator, make_index_sequence<N>{});
+    }
+
+    pointer arrow() const {
+        return fake_ptr_proxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_14 void increment() {
+        LZ_ASSERT_INCREMENTABLE(_chunks_left > 0);
+        std::advance(_iterator, static_cast<difference_type>(N));
+        --_chunks_left;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void decrement() {
+        _iterator -= static_cast<difference_type>(N);
+        ++_chunks_left;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void plus_is(const difference_type offset) {
+        LZ_ASSERT_SUB_ADDABLE(offset <= _chunks_left);
+        _iterator += offset * static_cast<difference_type>(N);
+        _chunks_left -= offset;
+    }
+
+    constexpr difference_type difference(const static_chunks_iterator& other) const {
+        return other._chunks_left - _chunks_left;
+    }
+
+    constexpr difference_type difference(default_sentinel_t) const {
+        return -_chunks_left;
+    }
+
+    constexpr bool eq(const static_chunks_iterator& other) const {
+        return _chunks_left == other._chunks_left;
+    }
+
+    constexpr bool eq(default_sentinel_t) const {
+        return _chunks_left == 0;
+    }
+};
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -23,7 +23,7 @@ class take_while_iterator : public iterator<take_while_iterator<Iterable, UnaryP
 
     iter _iterator{};
     Iterable _iterable{};
-    mutable UnaryPredicate _unary_predicate{};
+    LZ_NO_UNIQUE_ADDRESS mutable UnaryPredicate _unary_predicate{};
 
     using traits = std::iterator_traits<iter>;
 
@@ -26,7 +26,7 @@ class unique_iterator : public iterator<unique_iterator<Iterable, BinaryPredicat
 
     iter _iterator{};
     Iterable _iterable{};
-    mutable BinaryPredicate _predicate{};
+    LZ_NO_UNIQUE_ADDRESS mutable BinaryPredicate _predicate{};
 
 public:
     using value_type = typename traits::value_type;
@@ -0,0 +1,94 @@
+#pragma once
+
+#ifndef LZ_UTF8_CODEPOINTS_ITERATOR_HPP
+#define LZ_UTF8_CODEPOINTS_ITERATOR_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/fake_ptr_proxy.hpp>
+#include <Lz/detail/iterator.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/procs/utf8.hpp>
+#include <Lz/detail/traits/conditional.hpp>
+#include <Lz/detail/traits/enable_if.hpp>
+#include <Lz/util/default_sentinel.hpp>
+
+namespace lz {
+namespace detail {
+
+// End is const char* for strings with a size, or default_sentinel_t for null terminated strings
+template<class End>
+class utf8_codepoints_iterator
+    : public iterator<utf8_codepoints_iterator<End>, char32_t, fake_ptr_proxy<char32_t>, std::ptrdiff_t,
+                      std::forward_iterator_tag,
+                      conditional_t<std::is_same<End, default_sentinel_t>::value, default_sentinel_t,
+                                    utf8_codepoints_iterator<End>>> {
+
+    const char* _it{};
+    End _end{};
+    char32_t _codepoint{};
+    std::size_t _length{};
+
+    static constexpr bool is_null_terminated = std::is_same<End, default_sentinel_t>::value;
+
+    LZ_CONSTEXPR_CXX_14 bool at_end() const noexcept {
+        return _it == nullptr || utf8_at_end(_it, _end);
+    }
+
+    void decode() noexcept {
+        if (at_end()) {
+            return;
+        }
+        _length = decode_utf8(_it, _end, _codepoint);
+        if (_codepoint == utf8_invalid) {
+            _codepoint = utf8_replacement_character;
+        }
+    }
+
+public:
+    using value_type = char32_t;
+    using reference = char32_t;
+    using pointer = fake_ptr_proxy<char32_t>;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr utf8_codepoints_iterator() = default;
+    utf8_codepoints_iterator(const utf8_codepoints_iterator&) = default;
+    utf8_codepoints_iterator& operator=(const utf8_codepoints_iterator&) = default;
+
+    utf8_codepoints_iterator(const char* it, const End end) noexcept : _it{ it }, _end{ end } {
+        decode();
+    }
+
+    template<bool B = is_null_terminated>
+    LZ_CONSTEXPR_CXX_14 enable_if_t<B, utf8_codepoints_iterator&> operator=(default_sentinel_t) noexcept {
+        _it = nullptr;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_14 reference dereference() const noexcept {
+        LZ_ASSERT_DEREFERENCABLE(!at_end());
+        return _codepoint;
+    }
+
+    LZ_CONSTEXPR_CXX_14 pointer arrow() const noexcept {
+        return fake_ptr_proxy<decltype(**this)>(**this);
+    }
+
+    void increment() noexcept {
+        LZ_ASSERT_INCREMENTABLE(!at_end());
+        _it += _length;
+        decode();
+    }
+
+    LZ_CONSTEXPR_CXX_14 bool eq(const utf8_codepoints_iterator& other) const noexcept {
+        return is_null_terminated && (other._it == nullptr || _it == nullptr) ? at_end() && other.at_end() : _it == other._it;
+    }
+
+    LZ_CONSTEXPR_CXX_14 bool eq(default_sentinel_t) const noexcept {
+        return at_end();
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_UTF8_CODEPOINTS_ITERATOR_HPP
@@ -0,0 +1,68 @@
+#pragma once
+
+#ifndef LZ_MEMOIZE_CACHE_HPP
+#define LZ_MEMOIZE_CACHE_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/traits/conditional.hpp>
+#include <Lz/util/optional.hpp>
+#include <deque>
+#include <type_traits>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+/**
+ * Stores the results of a memoize_map_iterable, indexed by position. For random access inputs, all @p size slots are allocated
+ * at once, the first time a result is requested. For other inputs, slots are appended to a deque as the results of further
+ * positions are requested. Neither invalidates references to results that were stored before.
+ */
+template<class Value, class UnaryOp, bool RandomAccess>
+class memoize_cache {
+    using slots = conditional_t<RandomAccess, std::vector<optional<Value>>, std::deque<optional<Value>>>;
+
+    UnaryOp _unary_op;
+    slots _slots{};
+    size_t _size{};
+
+    void make_slot(const size_t, std::true_type /* random access */) {
+        if (_slots.empty()) {
+            _slots.resize(_size);
+        }
+    }
+
+    void make_slot(const size_t index, std::false_type /* random access */) {
+        if (index >= _slots.size()) {
+            _slots.resize(index + 1);
+        }
+    }
+
+public:
+    memoize_cache(UnaryOp unary_op, const size_t size) : _unary_op{ std::move(unary_op) }, _size{ size } {
+    }
+
+    memoize_cache(const memoize_cache&) = delete;
+    memoize_cache& operator=(const memoize_cache&) = delete;
+
+    /**
+     * Returns the result of the function applied to `*iterator`, which is at position @p index of the input. The function is only
+     * called if this position was not requested before.
+     */
+    template<class Iterator>
+    const Value& get(const size_t index, const Iterator& iterator) {
+        make_slot(index, std::integral_constant<bool, RandomAccess>{});
+        LZ_ASSERT(index < _slots.size(), "Cannot dereference end memoize_map iterator");
+        auto& slot = _slots[index];
+        if (!slot.has_value()) {
+            slot = Value(_unary_op(*iterator));
+        }
+        return *slot;
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_MEMOIZE_CACHE_HPP
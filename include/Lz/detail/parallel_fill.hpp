@@ -0,0 +1,93 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_FILL_HPP
+#define LZ_PARALLEL_FILL_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+/**
+ * Strategy for lz::to to convert sized random access iterables using multiple threads. Every thread converts a disjoint slice
+ * of at least `grain_size` elements. If `threads` is 0, std::thread::hardware_concurrency() threads are used.
+ */
+class parallel_execution {
+    size_t _threads{};
+    size_t _grain_size{ 1024 };
+
+public:
+    constexpr parallel_execution() = default;
+
+    constexpr explicit parallel_execution(const size_t threads, const size_t grain_size = 1024) noexcept :
+        _threads{ threads },
+        _grain_size{ grain_size == 0 ? 1 : grain_size } {
+    }
+
+    /**
+     * @return The number of threads to use for @p size elements, which is at least 1.
+     */
+    LZ_NODISCARD size_t thread_count(const size_t size) const noexcept {
+        const size_t threads = _threads != 0 ? _threads : (std::max)(std::thread::hardware_concurrency(), 1u);
+        return (std::max)(size_t{ 1 }, (std::min)(threads, size / _grain_size));
+    }
+};
+
+/**
+ * Splits [0, size) into `execution.thread_count(size)` slices of (almost) equal size and calls `f(slice, first, last)` for
+ * every slice, each on its own thread. The calling thread handles the first slice. Rethrows the exception of the first slice
+ * that threw, after all threads are joined.
+ */
+template<class F>
+void for_each_slice_parallel(const size_t size, const parallel_execution& execution, F f) {
+    const size_t slices = execution.thread_count(size);
+    const size_t slice_size = size / slices;
+    const size_t remainder = size % slices;
+
+    std::vector<std::exception_ptr> exceptions(slices);
+    auto run = [&f, &exceptions, slice_size, remainder](const size_t slice) {
+        const size_t first = slice * slice_size + (std::min)(slice, remainder);
+        const size_t last = first + slice_size + (slice < remainder ? 1 : 0);
+        try {
+            f(slice, first, last);
+        }
+        catch (...) {
+            exceptions[slice] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(slices - 1);
+    auto join_all = [&workers] {
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    };
+
+    try {
+        for (size_t slice = 1; slice < slices; ++slice) {
+            workers.emplace_back(run, slice);
+        }
+    }
+    catch (...) {
+        join_all();
+        throw;
+    }
+    run(0);
+    join_all();
+
+    for (auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PARALLEL_FILL_HPP
@@ -0,0 +1,180 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_MAP_STATE_HPP
+#define LZ_PARALLEL_MAP_STATE_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/traits/func_ret_type.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+#include <Lz/util/optional.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+/**
+ * Shared state of a parallel_map_iterator. Worker threads pull elements from the input (one at a time, under the lock), apply
+ * the function without holding the lock and store the result in a ring buffer of `window` slots. At most `window` elements are
+ * ever pulled ahead of the consumer. If @p Ordered is true, the result of the n-th input element is stored in slot
+ * `n % window`, so the consumer sees the results in input order. Otherwise results are stored in order of completion.
+ */
+template<class Iterator, class S, class UnaryOp, bool Ordered>
+class parallel_map_state {
+public:
+    using value_type = remove_cvref_t<func_ret_type_iter<const UnaryOp&, Iterator>>;
+
+private:
+    using input_type = remove_cvref_t<ref_t<Iterator>>;
+
+    std::mutex _mutex{};
+    std::condition_variable _space_available{};
+    std::condition_variable _result_available{};
+
+    Iterator _iterator;
+    S _end;
+    const UnaryOp _unary_op;
+
+    std::vector<optional<value_type>> _ring;
+    optional<value_type> _current{};
+
+    size_t _pulled{};
+    size_t _completed{};
+    size_t _consumed{};
+    std::exception_ptr _exception{};
+    bool _input_exhausted{ false };
+    bool _stop{ false };
+    bool _at_end{ false };
+
+    std::vector<std::thread> _workers{};
+
+    static size_t thread_count_for(const size_t threads) noexcept {
+        return threads != 0 ? threads : (std::max)(std::thread::hardware_concurrency(), 1u);
+    }
+
+    void work() {
+        std::unique_lock<std::mutex> lock{ _mutex };
+        try {
+            while (true) {
+                _space_available.wait(lock, [this] { return _stop || _input_exhausted || _pulled - _consumed < _ring.size(); });
+                if (_stop || _input_exhausted) {
+                    return;
+                }
+                if (_iterator == _end) {
+                    _input_exhausted = true;
+                    _space_available.notify_all();
+                    _result_available.notify_one();
+                    return;
+                }
+
+                const size_t sequence = _pulled++;
+                input_type input = *_iterator;
+                ++_iterator;
+
+                lock.unlock();
+                value_type result = _unary_op(input);
+                lock.lock();
+
+                const size_t slot = (Ordered ? sequence : _completed++) % _ring.size();
+                _ring[slot] = std::move(result);
+                _result_available.notify_one();
+            }
+        }
+        catch (...) {
+            if (!lock.owns_lock()) {
+                lock.lock();
+            }
+            if (!_exception) {
+                _exception = std::current_exception();
+            }
+            _stop = true;
+            _space_available.notify_all();
+            _result_available.notify_one();
+        }
+    }
+
+    void stop_and_join() noexcept {
+        {
+            std::lock_guard<std::mutex> lock{ _mutex };
+            _stop = true;
+        }
+        _space_available.notify_all();
+        for (auto& worker : _workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+    }
+
+public:
+    parallel_map_state(Iterator iterator, S end, UnaryOp unary_op, size_t threads, const size_t window) :
+        _iterator{ std::move(iterator) },
+        _end{ std::move(end) },
+        _unary_op{ std::move(unary_op) },
+        _ring(window != 0 ? window : thread_count_for(threads) * 4) {
+        threads = thread_count_for(threads);
+        _workers.reserve(threads);
+        try {
+            for (size_t i = 0; i < threads; ++i) {
+                _workers.emplace_back(&parallel_map_state::work, this);
+            }
+        }
+        catch (...) {
+            stop_and_join();
+            throw;
+        }
+    }
+
+    parallel_map_state(const parallel_map_state&) = delete;
+    parallel_map_state& operator=(const parallel_map_state&) = delete;
+
+    ~parallel_map_state() {
+        stop_and_join();
+    }
+
+    /**
+     * Blocks until the next result is available and makes it the current element. Rethrows the first exception thrown by the
+     * input iterator or the function. Results that were not consumed before the exception was thrown may be dropped.
+     */
+    void advance() {
+        std::unique_lock<std::mutex> lock{ _mutex };
+        auto& slot = _ring[_consumed % _ring.size()];
+        _result_available.wait(lock, [this, &slot] {
+            return slot.has_value() || _exception != nullptr || (_input_exhausted && _consumed == _pulled);
+        });
+
+        if (slot.has_value()) {
+            _current = std::move(*slot);
+            slot.reset();
+            ++_consumed;
+            lock.unlock();
+            _space_available.notify_one();
+            return;
+        }
+        if (_exception) {
+            std::rethrow_exception(_exception);
+        }
+        _current.reset();
+        _at_end = true;
+    }
+
+    LZ_NODISCARD value_type& current() noexcept {
+        LZ_ASSERT(_current.has_value(), "Cannot dereference end parallel_map iterator");
+        return *_current;
+    }
+
+    LZ_NODISCARD bool at_end() const noexcept {
+        return _at_end;
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PARALLEL_MAP_STATE_HPP
@@ -0,0 +1,125 @@
+#pragma once
+
+#ifndef LZ_PREFETCH_ASYNC_STATE_HPP
+#define LZ_PREFETCH_ASYNC_STATE_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/procs/assert.hpp>
+#include <Lz/detail/spsc_ring_buffer.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <Lz/detail/traits/strict_iterator_traits.hpp>
+#include <Lz/util/optional.hpp>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <thread>
+
+namespace lz {
+namespace detail {
+
+/**
+ * Shared state of a prefetch_async_iterator. A background thread iterates over the input and pushes copies of its elements into
+ * a spsc_ring_buffer, the consumer pops them from it. If the buffer is full (or empty), the producer (or consumer) spins for a
+ * short while, after which it yields and eventually sleeps, so that a slow stage does not burn a core.
+ */
+template<class Iterator, class S>
+class prefetch_async_state {
+public:
+    using value_type = remove_cvref_t<ref_t<Iterator>>;
+
+private:
+    spsc_ring_buffer<value_type> _buffer;
+    optional<value_type> _current{};
+    std::exception_ptr _exception{};
+    std::atomic<bool> _stop{ false };
+    std::atomic<bool> _producer_done{ false };
+    bool _at_end{ false };
+    std::thread _producer;
+
+    static void backoff(unsigned& spins) {
+        if (spins < 64) {
+            ++spins;
+        }
+        else if (spins < 128) {
+            ++spins;
+            std::this_thread::yield();
+        }
+        else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    void produce(Iterator iterator, S end) {
+        try {
+            for (; iterator != end; ++iterator) {
+                value_type value = *iterator;
+                unsigned spins = 0;
+                while (!_buffer.try_push(std::move(value))) {
+                    if (_stop.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                    backoff(spins);
+                }
+                if (_stop.load(std::memory_order_relaxed)) {
+                    return;
+                }
+            }
+        }
+        catch (...) {
+            // Published by the release store below
+            _exception = std::current_exception();
+        }
+        _producer_done.store(true, std::memory_order_release);
+    }
+
+public:
+    prefetch_async_state(Iterator iterator, S end, const size_t capacity) :
+        _buffer{ capacity },
+        _producer{ &prefetch_async_state::produce, this, std::move(iterator), std::move(end) } {
+    }
+
+    prefetch_async_state(const prefetch_async_state&) = delete;
+    prefetch_async_state& operator=(const prefetch_async_state&) = delete;
+
+    ~prefetch_async_state() {
+        _stop.store(true, std::memory_order_relaxed);
+        _producer.join();
+    }
+
+    /**
+     * Blocks until the next element is available and makes it the current element. Rethrows the exception thrown by the input
+     * iterable, if any, after all elements before it have been consumed.
+     */
+    void advance() {
+        unsigned spins = 0;
+        while (!_buffer.try_pop(_current)) {
+            if (_producer_done.load(std::memory_order_acquire)) {
+                // The producer may have pushed its last elements right before it finished
+                if (_buffer.try_pop(_current)) {
+                    return;
+                }
+                if (_exception) {
+                    std::rethrow_exception(_exception);
+                }
+                _current.reset();
+                _at_end = true;
+                return;
+            }
+            backoff(spins);
+        }
+    }
+
+    LZ_NODISCARD value_type& current() noexcept {
+        LZ_ASSERT(_current.has_value(), "Cannot dereference end prefetch_async iterator");
+        return *_current;
+    }
+
+    LZ_NODISCARD bool at_end() const noexcept {
+        return _at_end;
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_PREFETCH_ASYNC_STATE_HPP
@@ -0,0 +1,22 @@
+#pragma once
+
+#ifndef LZ_DETAIL_LOAD_WORD_HPP
+#define LZ_DETAIL_LOAD_WORD_HPP
+
+#include <cstdint>
+#include <cstring>
+
+namespace lz {
+namespace detail {
+
+// Loads 8 characters at once, so that they can be processed as one 64 bit word (SWAR, SIMD within a register)
+inline std::uint64_t load_eight_chars(const char* chars) noexcept {
+    std::uint64_t word;
+    std::memcpy(&word, chars, sizeof(word));
+    return word;
+}
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_DETAIL_LOAD_WORD_HPP
@@ -0,0 +1,317 @@
+#pragma once
+
+#ifndef LZ_DETAIL_PARSE_NUMBER_HPP
+#define LZ_DETAIL_PARSE_NUMBER_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/procs/load_word.hpp>
+#include <Lz/detail/traits/enable_if.hpp>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#if defined(LZ_HAS_CXX_17) && LZ_HAS_INCLUDE(<charconv>)
+#include <charconv>
+#ifdef __cpp_lib_to_chars
+#if __cpp_lib_to_chars >= 201611L
+#define LZ_HAS_FLOAT_FROM_CHARS
+#endif
+#endif
+#endif
+
+namespace lz {
+namespace detail {
+
+#if defined(_MSC_VER)
+constexpr bool can_parse_eight_digits = true;
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+constexpr bool can_parse_eight_digits = __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+#else
+constexpr bool can_parse_eight_digits = false;
+#endif
+
+template<class T, class U>
+constexpr enable_if_t<std::is_same<T, U>::value, T> integer_cast(const U value) noexcept {
+    return value;
+}
+
+template<class T, class U>
+constexpr enable_if_t<!std::is_same<T, U>::value, T> integer_cast(const U value) noexcept {
+    return static_cast<T>(value);
+}
+
+constexpr bool is_digit(const char c) noexcept {
+    return c >= '0' && c <= '9';
+}
+
+constexpr unsigned digit_value(const char c) noexcept {
+    return static_cast<unsigned>(c - '0');
+}
+
+// SWAR digit parsing: 8 ASCII digits in a little endian 64 bit word are validated and converted using a couple of additions
+// and three multiplications, instead of 8 dependent multiply-adds
+constexpr bool is_eight_digits(const std::uint64_t word) noexcept {
+    return (((word + 0x4646464646464646) | (word - 0x3030303030303030)) & 0x8080808080808080) == 0;
+}
+
+constexpr std::uint64_t combine_digit_pairs(const std::uint64_t digits) noexcept {
+    return digits * 10 + (digits >> 8);
+}
+
+constexpr std::uint32_t combine_digit_quads(const std::uint64_t pairs) noexcept {
+    return static_cast<std::uint32_t>(((pairs & 0x000000FF000000FF) * (100 + (std::uint64_t{ 1000000 } << 32)) +
+                                       ((pairs >> 16) & 0x000000FF000000FF) * (1 + (std::uint64_t{ 10000 } << 32))) >>
+                                      32);
+}
+
+constexpr std::uint32_t parse_eight_digits(const std::uint64_t word) noexcept {
+    return combine_digit_quads(combine_digit_pairs(word - 0x3030303030303030));
+}
+
+// Same syntax as std::from_chars in base 10: an optional minus sign (signed types only) followed by digits. All characters must
+// be used
+template<class T>
+bool parse_integer(const char* first, const char* const last, T& result) noexcept {
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    bool negative = false;
+    if (first != last && *first == '-') {
+        if (!std::is_signed<T>::value) {
+            return false;
+        }
+        negative = true;
+        ++first;
+    }
+    if (first == last) {
+        return false;
+    }
+
+    std::uint64_t value = 0;
+    if (can_parse_eight_digits) {
+        // value * 10^8 + 99999999 does not overflow while value < 10^11
+        while (last - first >= 8 && value < 100000000000) {
+            const auto word = load_eight_chars(first);
+            if (!is_eight_digits(word)) {
+                break;
+            }
+            value = value * 100000000 + parse_eight_digits(word);
+            first += 8;
+        }
+    }
+    for (; first != last; ++first) {
+        const auto digit = digit_value(*first);
+        if (digit > 9 || value > (std::numeric_limits<std::uint64_t>::max() - digit) / 10) {
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+
+    const std::uint64_t max = std::numeric_limits<unsigned_type>::max() >> (std::is_signed<T>::value ? 1 : 0);
+    if (negative) {
+        if (value > max + 1) {
+            return false;
+        }
+        // Written this way to avoid overflow for the minimum value
+        result = value == 0 ? T{} : integer_cast<T>(-integer_cast<std::int64_t>(value - 1) - 1);
+        return true;
+    }
+    if (value > max) {
+        return false;
+    }
+    result = integer_cast<T>(value);
+    return true;
+}
+
+#ifdef LZ_HAS_FLOAT_FROM_CHARS
+
+template<class T>
+bool parse_floating(const char* first, const char* const last, T& result) noexcept {
+    const auto parsed = std::from_chars(first, last, result);
+    return parsed.ec == std::errc{} && parsed.ptr == last;
+}
+
+#else
+
+// Mantissas and powers of 10 up to these limits are exact, so one multiplication or division is correctly rounded
+template<class T>
+struct exact_float_limits {
+    static constexpr std::uint64_t max_mantissa = 0;
+    static constexpr int max_exponent = -1;
+};
+
+template<>
+struct exact_float_limits<float> {
+    static constexpr std::uint64_t max_mantissa = std::uint64_t{ 1 } << 24;
+    static constexpr int max_exponent = 10;
+};
+
+template<>
+struct exact_float_limits<double> {
+    static constexpr std::uint64_t max_mantissa = std::uint64_t{ 1 } << 53;
+    static constexpr int max_exponent = 22;
+};
+
+inline float exact_power_of_ten(const int exponent, float) noexcept {
+    static const float powers[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    return powers[exponent];
+}
+
+inline double exact_power_of_ten(const int exponent, double) noexcept {
+    static const double powers[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    return powers[exponent];
+}
+
+// Never used, long doubles always use the slow path
+inline long double exact_power_of_ten(const int, long double) noexcept {
+    return 1;
+}
+
+inline float string_to_floating(const char* str, char** end, float) noexcept {
+    return std::strtof(str, end);
+}
+
+inline double string_to_floating(const char* str, char** end, double) noexcept {
+    return std::strtod(str, end);
+}
+
+inline long double string_to_floating(const char* str, char** end, long double) noexcept {
+    return std::strtold(str, end);
+}
+
+inline bool equals_ignore_case(const char* first, const char* const last, const char* lower) noexcept {
+    for (; *lower != '\0'; ++first, ++lower) {
+        if (first == last || static_cast<char>(*first | 0x20) != *lower) {
+            return false;
+        }
+    }
+    return first == last;
+}
+
+template<class T>
+bool parse_special_floating(const char* first, const char* const last, const bool negative, T& result) noexcept {
+    if (equals_ignore_case(first, last, "inf") || equals_ignore_case(first, last, "infinity")) {
+        result = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+        return true;
+    }
+    if (equals_ignore_case(first, last, "nan")) {
+        result = negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+        return true;
+    }
+    return false;
+}
+
+// Used for numbers that the fast path can't parse exactly. Only called with validated decimal numbers. strtod is locale
+// dependent, but locales that don't use '.' as decimal point are rare in combination with such numbers
+template<class T>
+bool parse_floating_slow(const char* first, const char* const last, T& result) {
+    const std::string copy(first, last);
+    char* end = nullptr;
+    const auto old_errno = errno;
+    errno = 0;
+    const T value = string_to_floating(copy.c_str(), &end, T{});
+    const bool out_of_range = errno == ERANGE;
+    errno = old_errno;
+    if (out_of_range || end != copy.c_str() + copy.size()) {
+        return false;
+    }
+    result = value;
+    return true;
+}
+
+// Same syntax as std::from_chars with std::chars_format::general. All characters must be used
+template<class T>
+bool parse_floating(const char* first, const char* const last, T& result) {
+    const char* it = first;
+    const bool negative = it != last && *it == '-';
+    if (negative) {
+        ++it;
+    }
+
+    std::uint64_t mantissa = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    bool truncated = false;
+    bool has_digits = false;
+    auto add_digit = [&](const unsigned digit, const bool fractional) {
+        has_digits = true;
+        if (mantissa == 0 && digit == 0) {
+            exponent -= fractional ? 1 : 0;
+        }
+        else if (significant_digits < 19) {
+            mantissa = mantissa * 10 + digit;
+            ++significant_digits;
+            exponent -= fractional ? 1 : 0;
+        }
+        else {
+            truncated = true;
+            exponent += fractional ? 0 : 1;
+        }
+    };
+
+    for (; it != last && is_digit(*it); ++it) {
+        add_digit(digit_value(*it), false);
+    }
+    if (it != last && *it == '.') {
+        for (++it; it != last && is_digit(*it); ++it) {
+            add_digit(digit_value(*it), true);
+        }
+    }
+    if (!has_digits) {
+        return parse_special_floating(negative ? first + 1 : first, last, negative, result);
+    }
+
+    if (it != last && (*it == 'e' || *it == 'E')) {
+        ++it;
+        const bool negative_exponent = it != last && *it == '-';
+        if (it != last && (*it == '-' || *it == '+')) {
+            ++it;
+        }
+        if (it == last || !is_digit(*it)) {
+            return false;
+        }
+        int exponent_value = 0;
+        for (; it != last && is_digit(*it); ++it) {
+            if (exponent_value < 100000) {
+                exponent_value = exponent_value * 10 + static_cast<int>(digit_value(*it));
+            }
+        }
+        exponent += negative_exponent ? -exponent_value : exponent_value;
+    }
+    if (it != last) {
+        return false;
+    }
+
+    if (mantissa == 0) {
+        result = negative ? -T{} : T{};
+        return true;
+    }
+    if (!truncated && mantissa <= exact_float_limits<T>::max_mantissa && exponent <= exact_float_limits<T>::max_exponent &&
+        exponent >= -exact_float_limits<T>::max_exponent) {
+        auto value = static_cast<T>(mantissa);
+        value = exponent < 0 ? value / exact_power_of_ten(-exponent, T{}) : value * exact_power_of_ten(exponent, T{});
+        result = negative ? -value : value;
+        return true;
+    }
+    return parse_floating_slow(first, last, result);
+}
+
+#endif // LZ_HAS_FLOAT_FROM_CHARS
+
+template<class T>
+enable_if_t<std::is_integral<T>::value, bool> parse_number(const char* first, const char* last, T& result) {
+    return parse_integer(first, last, result);
+}
+
+template<class T>
+enable_if_t<std::is_floating_point<T>::value, bool> parse_number(const char* first, const char* last, T& result) {
+    return parse_floating(first, last, result);
+}
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_DETAIL_PARSE_NUMBER_HPP
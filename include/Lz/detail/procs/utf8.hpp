@@ -0,0 +1,119 @@
+#pragma once
+
+#ifndef LZ_DETAIL_UTF8_HPP
+#define LZ_DETAIL_UTF8_HPP
+
+#include <Lz/detail/procs/load_word.hpp>
+#include <Lz/util/default_sentinel.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace lz {
+namespace detail {
+
+// Not a code point, returned by decode_utf8 for ill formed sequences
+constexpr char32_t utf8_invalid = 0x110000;
+
+constexpr char32_t utf8_replacement_character = 0xFFFD;
+
+constexpr unsigned char utf8_byte(const char c) noexcept {
+    return static_cast<unsigned char>(c);
+}
+
+constexpr bool utf8_at_end(const char* it, const char* end) noexcept {
+    return it == end;
+}
+
+// Null terminated strings. Decoding never reads past the terminator, because '\0' is not a valid continuation byte
+constexpr bool utf8_at_end(const char* it, default_sentinel_t) noexcept {
+    return *it == '\0';
+}
+
+// A word is ASCII only if none of its 8 bytes has its high bit set, regardless of byte order
+constexpr bool is_ascii_word(const std::uint64_t word) noexcept {
+    return (word & 0x8080808080808080) == 0;
+}
+
+/**
+ * Decodes one UTF-8 sequence at `first`, which may not be at the end. Returns the length of the sequence. Ill formed sequences
+ * result in `utf8_invalid`, and have the length of their maximal well formed prefix (at least 1), as recommended by the
+ * Unicode standard, so that every ill formed subpart is replaced by exactly one U+FFFD.
+ */
+template<class End>
+std::size_t decode_utf8(const char* first, const End last, char32_t& codepoint) noexcept {
+    const auto lead = utf8_byte(*first);
+    if (lead < 0x80) {
+        codepoint = lead;
+        return 1;
+    }
+
+    std::size_t length;
+    char32_t value;
+    // The allowed range of the second byte, which excludes overlong encodings, surrogates and code points above U+10FFFF
+    unsigned char lower = 0x80;
+    unsigned char upper = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+        value = lead & 0x1Fu;
+    }
+    else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        value = lead & 0x0Fu;
+        lower = lead == 0xE0 ? 0xA0 : 0x80;
+        upper = lead == 0xED ? 0x9F : 0xBF;
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        value = lead & 0x07u;
+        lower = lead == 0xF0 ? 0x90 : 0x80;
+        upper = lead == 0xF4 ? 0x8F : 0xBF;
+    }
+    else {
+        codepoint = utf8_invalid;
+        return 1;
+    }
+
+    for (std::size_t i = 1; i < length; ++i) {
+        if (utf8_at_end(first + i, last)) {
+            codepoint = utf8_invalid;
+            return i;
+        }
+        const auto byte = utf8_byte(first[i]);
+        if (byte < lower || byte > upper) {
+            codepoint = utf8_invalid;
+            return i;
+        }
+        value = (value << 6) | (byte & 0x3Fu);
+        lower = 0x80;
+        upper = 0xBF;
+    }
+    codepoint = value;
+    return length;
+}
+
+// Returns the start of the first ill formed sequence in [first, last), or last if there is none. ASCII is skipped 8
+// characters at a time
+inline const char* find_invalid_utf8(const char* first, const char* const last) noexcept {
+    while (first != last) {
+        if (last - first >= 8 && is_ascii_word(load_eight_chars(first))) {
+            first += 8;
+            continue;
+        }
+        if (utf8_byte(*first) < 0x80) {
+            ++first;
+            continue;
+        }
+        char32_t codepoint;
+        const auto length = decode_utf8(first, last, codepoint);
+        if (codepoint == utf8_invalid) {
+            return first;
+        }
+        first += length;
+    }
+    return last;
+}
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_DETAIL_UTF8_HPP
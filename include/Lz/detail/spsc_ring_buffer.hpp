@@ -0,0 +1,83 @@
+#pragma once
+
+#ifndef LZ_SPSC_RING_BUFFER_HPP
+#define LZ_SPSC_RING_BUFFER_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/util/optional.hpp>
+#include <atomic>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+/**
+ * Bounded, lock-free single producer/single consumer queue. Each side keeps a cached copy of the other side's position and only
+ * reloads it (with acquire semantics) when the cached copy says the queue is full/empty. This way, the consumer picks up every
+ * element that has become available since its last reload with a single synchronization, and vice versa. The positions of both
+ * sides are padded to a cache line to prevent false sharing.
+ */
+template<class T>
+class spsc_ring_buffer {
+    static constexpr size_t cache_line_size = 64;
+
+    struct producer_side {
+        std::atomic<size_t> tail{ 0 };
+        size_t cached_head{ 0 };
+        char padding[cache_line_size - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+    };
+
+    struct consumer_side {
+        std::atomic<size_t> head{ 0 };
+        size_t cached_tail{ 0 };
+        char padding[cache_line_size - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+    };
+
+    producer_side _producer{};
+    consumer_side _consumer{};
+    std::vector<optional<T>> _slots;
+
+public:
+    explicit spsc_ring_buffer(const size_t capacity) : _slots(capacity != 0 ? capacity : 1) {
+    }
+
+    /**
+     * Must only be called by the producer. Returns false if the queue is full, in which case @p value is left untouched.
+     */
+    template<class U>
+    bool try_push(U&& value) {
+        const size_t tail = _producer.tail.load(std::memory_order_relaxed);
+        if (tail - _producer.cached_head == _slots.size()) {
+            _producer.cached_head = _consumer.head.load(std::memory_order_acquire);
+            if (tail - _producer.cached_head == _slots.size()) {
+                return false;
+            }
+        }
+        _slots[tail % _slots.size()] = std::forward<U>(value);
+        _producer.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Must only be called by the consumer. Moves the oldest element into @p out, returns false if the queue is empty.
+     */
+    bool try_pop(optional<T>& out) {
+        const size_t head = _consumer.head.load(std::memory_order_relaxed);
+        if (head == _consumer.cached_tail) {
+            _consumer.cached_tail = _producer.tail.load(std::memory_order_acquire);
+            if (head == _consumer.cached_tail) {
+                return false;
+            }
+        }
+        auto& slot = _slots[head % _slots.size()];
+        out = std::move(*slot);
+        slot.reset();
+        _consumer.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_SPSC_RING_BUFFER_HPP
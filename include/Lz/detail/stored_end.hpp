@@ -0,0 +1,45 @@
+#pragma once
+
+#ifndef LZ_STORED_END_HPP
+#define LZ_STORED_END_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/traits/conditional.hpp>
+#include <Lz/traits/iter_type.hpp>
+
+namespace lz {
+namespace detail {
+
+/**
+ * Stores the end of an iterable, instead of the iterable itself. Iterators that only need the end of their input iterable can
+ * use this, if it is smaller than a copy of the iterable (see compact_iterable_t).
+ */
+template<class Iterable>
+class stored_end {
+    sentinel_t<Iterable> _end{};
+
+public:
+    constexpr stored_end() = default;
+
+    constexpr stored_end(const Iterable& iterable) : _end{ iterable.end() } {
+    }
+
+    LZ_NODISCARD constexpr sentinel_t<Iterable> end() const {
+        return _end;
+    }
+};
+
+/**
+ * The smallest of @p Iterable (usually a maybe_owned, which is a pointer for containers and a copy for views) and its stored
+ * end, if the begin of the iterable is not needed. Both can be constructed from a `const Iterable&` and have an end()
+ * function. For forward and sentinelled pipelines, the end is usually much smaller than the view it originates from. If
+ * @p NeedsBegin is true (bidirectional iterators), the iterable itself is used, since calling begin() may not be O(1).
+ */
+template<class Iterable, bool NeedsBegin>
+using compact_iterable_t =
+    conditional_t<!NeedsBegin && (sizeof(stored_end<Iterable>) < sizeof(Iterable)), stored_end<Iterable>, Iterable>;
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_STORED_END_HPP
@@ -0,0 +1,65 @@
+#pragma once
+
+#ifndef LZ_DETAIL_TRAITS_STATIC_SIZE_HPP
+#define LZ_DETAIL_TRAITS_STATIC_SIZE_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/traits/conjunction.hpp>
+#include <Lz/detail/traits/enable_if.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <Lz/detail/traits/void.hpp>
+#include <array>
+#include <type_traits>
+
+namespace lz {
+namespace detail {
+
+// Specialized by iterables whose size is known at compile time. Has no `value` member if the size is not known at compile time
+template<class T, class = void>
+struct static_size_impl {};
+
+template<class T>
+struct static_size_impl<T, enable_if_t<std::is_array<T>::value>> : std::integral_constant<size_t, std::extent<T>::value> {};
+
+template<class T, size_t N>
+struct static_size_impl<std::array<T, N>> : std::integral_constant<size_t, N> {};
+
+LZ_MODULE_EXPORT template<class Iterable>
+struct static_size : static_size_impl<remove_cvref_t<Iterable>> {};
+
+LZ_MODULE_EXPORT template<class T, class = void>
+struct has_static_size : std::false_type {};
+
+LZ_MODULE_EXPORT template<class T>
+struct has_static_size<T, void_t<decltype(static_size<T>::value)>> : std::true_type {};
+
+#ifdef LZ_HAS_CXX_17
+
+LZ_MODULE_EXPORT template<class Iterable>
+LZ_INLINE_VAR constexpr size_t static_size_v = static_size<Iterable>::value;
+
+LZ_MODULE_EXPORT template<class T>
+LZ_INLINE_VAR constexpr bool has_static_size_v = has_static_size<T>::value;
+
+#endif // LZ_HAS_CXX_17
+
+// The smallest static size of Iterables, only if all Iterables have a static size
+template<bool, class... Iterables>
+struct min_static_size_impl {};
+
+template<class Iterable>
+struct min_static_size_impl<true, Iterable> : static_size<Iterable> {};
+
+template<class Iterable, class... Iterables>
+struct min_static_size_impl<true, Iterable, Iterables...>
+    : std::integral_constant<size_t, (static_size<Iterable>::value < min_static_size_impl<true, Iterables...>::value)
+                                         ? static_size<Iterable>::value
+                                         : min_static_size_impl<true, Iterables...>::value> {};
+
+template<class... Iterables>
+struct min_static_size : min_static_size_impl<conjunction<has_static_size<Iterables>...>::value, Iterables...> {};
+
+} // namespace detail
+} // namespace lz
+
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+
+#ifndef LZ_DETAIL_TRAITS_STRING_TRAITS_HPP
+#define LZ_DETAIL_TRAITS_STRING_TRAITS_HPP
+
+#include <Lz/detail/traits/enable_if.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <Lz/detail/traits/void.hpp>
+#include <Lz/traits/lazy_view.hpp>
+#include <Lz/util/string_view.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace lz {
+namespace detail {
+
+// Contiguous strings, such as std::string
+template<class T, class = void>
+struct has_data_and_size : std::false_type {};
+
+template<class T>
+struct has_data_and_size<T, void_t<decltype(std::declval<const T&>().data() + std::declval<const T&>().size())>>
+    : std::true_type {};
+
+// Types that contain a string, such as lz::csv_field
+template<class T, class = void>
+struct has_string_value : std::false_type {};
+
+template<class T>
+struct has_string_value<T, enable_if_t<std::is_convertible<decltype(std::declval<const T&>().value()), string_view>::value>>
+    : std::true_type {};
+
+template<class T>
+struct is_string_view : std::false_type {};
+
+template<class C>
+struct is_string_view<basic_string_view<C>> : std::true_type {};
+
+// Strings that may be referenced by an iterable: lvalues and types that do not own their characters, such as string views,
+// pointers and lazy views. Temporary strings that own their characters, such as std::string, are destroyed too early
+template<class String>
+struct is_borrowable_string
+    : std::integral_constant<bool, std::is_lvalue_reference<String>::value || is_string_view<remove_cvref_t<String>>::value ||
+                                       std::is_pointer<remove_cvref_t<String>>::value ||
+                                       std::is_base_of<lazy_view, remove_cvref_t<String>>::value> {};
+
+} // namespace detail
+} // namespace lz
+
+#endif // LZ_DETAIL_TRAITS_STRING_TRAITS_HPP
@@ -0,0 +1,246 @@
+#pragma once
+
+#ifndef LZ_GENERATOR_HPP
+#define LZ_GENERATOR_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+
+#ifdef LZ_HAS_COROUTINES
+
+#include <Lz/detail/generator_promise.hpp>
+#include <Lz/detail/iterators/generator.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <Lz/traits/lazy_view.hpp>
+#include <coroutine>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+LZ_MODULE_EXPORT namespace lz {
+
+template<class T, class Allocator>
+class generator;
+
+} // namespace lz
+
+namespace lz {
+namespace detail {
+
+template<class>
+struct is_generator : std::false_type {};
+
+template<class T, class Allocator>
+struct is_generator<generator<T, Allocator>> : std::true_type {};
+
+} // namespace detail
+} // namespace lz
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Can be used to yield all elements of another generator or iterable from a generator, using
+ * `co_yield lz::elements_of(...)`. If the argument is a `lz::generator` with the same value type, it is resumed directly from
+ * the consumer (using symmetric transfer) until it is done, so recursive generators cost O(1) per element, regardless of their
+ * depth. Otherwise, the elements of the iterable are yielded one by one. Example:
+ * ```cpp
+ * lz::generator<int> walk(const node* n) {
+ *     if (n == nullptr) {
+ *         co_return;
+ *     }
+ *     co_yield lz::elements_of(walk(n->left));
+ *     co_yield n->value;
+ *     co_yield lz::elements_of(walk(n->right));
+ * }
+ * ```
+ * @param range The generator or iterable to yield the elements of. Temporary generators are moved into the yielding generator.
+ * Lvalue generators are referenced and resumed in place, so they are consumed by the yield. Other iterables are held by
+ * reference if they are lvalues.
+ */
+template<class Range>
+constexpr detail::elements_of_holder<Range>
+elements_of(Range&& range) noexcept(std::is_nothrow_constructible<Range, Range&&>::value) {
+    return { std::forward<Range>(range) };
+}
+
+/**
+ * @brief A lazy view over the values that are yielded (using `co_yield`) by a C++20 coroutine. This way, generators that
+ * need state can be written as plain functions, instead of a lambda with hand rolled state, as is needed with `lz::generate`
+ * and `lz::generate_while`. Yielded values are not copied: the iterator refers to the yielded value until it is incremented.
+ * Generators can be nested using `co_yield lz::elements_of(...)`. Nested generators are resumed directly from the consumer
+ * (symmetric transfer), so recursive generators cost O(1) per element. The coroutine frame is allocated once per generator
+ * (never per element), through @p Allocator. A specific allocator instance can be passed using `std::allocator_arg` as the
+ * first parameters of the coroutine. Copies of a generator share the same coroutine (which is destroyed when the last copy is
+ * destroyed), so a generator can only be iterated once. Its iterator category is input and its end() function returns a
+ * sentinel. Example:
+ * ```cpp
+ * lz::generator<int> fibonacci() {
+ *     int a = 0, b = 1;
+ *     while (true) {
+ *         co_yield a;
+ *         a = std::exchange(b, a + b);
+ *     }
+ * }
+ *
+ * auto below_ten = fibonacci() | lz::take_while([](int i) { return i < 10; }); // { 0, 1, 1, 2, 3, 5, 8 }
+ *
+ * // Using a custom allocator
+ * lz::generator<int, my_allocator<int>> numbers(std::allocator_arg_t, const my_allocator<int>&) {
+ *     co_yield 1;
+ * }
+ * auto gen = numbers(std::allocator_arg, my_allocator<int>{});
+ * ```
+ * @tparam T The type of the yielded values.
+ * @tparam Allocator The allocator used to allocate the coroutine frame.
+ */
+template<class T, class Allocator = std::allocator<void>>
+class generator : public lazy_view {
+    static_assert(std::is_object<T>::value && std::is_same<T, detail::remove_cvref_t<T>>::value,
+                  "T must be a non const, non volatile object type");
+
+public:
+    class promise_type;
+
+private:
+    std::coroutine_handle<promise_type> _coroutine{};
+
+    template<class, class>
+    friend class generator;
+
+    explicit generator(std::coroutine_handle<promise_type> coroutine) noexcept : _coroutine{ coroutine } {
+    }
+
+    template<class Gen>
+    struct nested_awaiter {
+        Gen _generator;
+
+        bool await_ready() const noexcept {
+            return !_generator._coroutine;
+        }
+
+        template<class Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+            auto& nested = _generator._coroutine.promise();
+            auto& current = handle.promise();
+            nested._root = current._root;
+            nested._parent = handle;
+            current._root->_leaf = _generator._coroutine;
+            return _generator._coroutine;
+        }
+
+        void await_resume() const {
+            if (_generator._coroutine && _generator._coroutine.promise()._exception) {
+                std::rethrow_exception(_generator._coroutine.promise()._exception);
+            }
+        }
+    };
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
+#endif
+
+    template<class Range>
+    static generator<T> yield_all(Range range) {
+        for (auto&& element : range) {
+            co_yield static_cast<const T&>(element);
+        }
+    }
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+    void release() noexcept {
+        if (_coroutine && --_coroutine.promise()._references == 0) {
+            _coroutine.destroy();
+        }
+    }
+
+public:
+    class promise_type : public detail::generator_promise_base<T>, public detail::generator_frame_allocator<Allocator> {
+    public:
+        using detail::generator_promise_base<T>::yield_value;
+
+        generator get_return_object() noexcept {
+            auto coroutine = std::coroutine_handle<promise_type>::from_promise(*this);
+            this->_leaf = coroutine;
+            return generator{ coroutine };
+        }
+
+        template<class Range>
+        auto yield_value(detail::elements_of_holder<Range> elements) {
+            if constexpr (detail::is_generator<detail::remove_cvref_t<Range>>::value) {
+                static_assert(std::is_same<typename detail::remove_cvref_t<Range>::value_type, T>::value,
+                              "Nested generators must yield the same type");
+                return nested_awaiter<Range>{ std::forward<Range>(elements.range) };
+            }
+            else {
+                return nested_awaiter<generator<T>>{ yield_all<Range>(std::forward<Range>(elements.range)) };
+            }
+        }
+    };
+
+    using value_type = T;
+    using iterator = detail::generator_iterator<T>;
+    using const_iterator = iterator;
+
+    constexpr generator() noexcept = default;
+
+    generator(const generator& other) noexcept : _coroutine{ other._coroutine } {
+        if (_coroutine) {
+            ++_coroutine.promise()._references;
+        }
+    }
+
+    generator(generator&& other) noexcept : _coroutine{ std::exchange(other._coroutine, nullptr) } {
+    }
+
+    generator& operator=(const generator& other) noexcept {
+        if (this != &other) {
+            release();
+            _coroutine = other._coroutine;
+            if (_coroutine) {
+                ++_coroutine.promise()._references;
+            }
+        }
+        return *this;
+    }
+
+    generator& operator=(generator&& other) noexcept {
+        if (this != &other) {
+            release();
+            _coroutine = std::exchange(other._coroutine, nullptr);
+        }
+        return *this;
+    }
+
+    ~generator() {
+        release();
+    }
+
+    /**
+     * Runs the coroutine until its first `co_yield` (or its end) on the first call. Since a generator can only be iterated
+     * once, subsequent calls return an iterator to the current position of the coroutine.
+     */
+    [[nodiscard]] iterator begin() const {
+        if (!_coroutine) {
+            return {};
+        }
+        auto& promise = _coroutine.promise();
+        if (promise._value == nullptr && !_coroutine.done()) {
+            _coroutine.resume();
+        }
+        return { _coroutine, promise };
+    }
+
+    [[nodiscard]] constexpr default_sentinel_t end() const noexcept {
+        return {};
+    }
+};
+
+} // namespace lz
+
+#endif // LZ_HAS_COROUTINES
+
+#endif // LZ_GENERATOR_HPP
@@ -0,0 +1,55 @@
+#pragma once
+
+#ifndef LZ_GROUP_BY_HASHED_HPP
+#define LZ_GROUP_BY_HASHED_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/group_by_hashed.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Groups the elements of an unsorted iterable by key, and aggregates every group into a single value, in one pass over
+ * the input. Unlike `lz::group_by`, the input iterable does not need to be sorted. For every element, `key_fn(element)` is hashed
+ * (using `std::hash`) into an open addressing hash table and the aggregate of its group is updated with
+ * `aggregate = aggregator(std::move(aggregate), element)`. The aggregate of a key that is seen for the first time starts as
+ * `init`, which defaults to a value initialized value_type of the input iterable. The pass over the input iterable is done when
+ * calling begin(). The hash table grows as keys are inserted. If the number of distinct keys is known, it can be passed as an
+ * optional last argument `expected_keys`, so that no rehashing is needed while aggregating. The elements are
+ * `std::pair<key, aggregate>` in order of first appearance of the key. Its end() function returns a sentinel, its iterator
+ * category is forward and it does not contain a .size() method. Example:
+ * ```cpp
+ * struct order { int customer; double amount; };
+ * std::vector<order> orders = { { 1, 10.0 }, { 2, 5.0 }, { 1, 2.5 } };
+ * auto totals = lz::group_by_hashed(orders, [](const order& o) { return o.customer; },
+ *                                   [](double acc, const order& o) { return acc + o.amount; }, 0.0);
+ * // totals = { {1, 12.5}, {2, 5.0} }
+ * // or
+ * auto totals = orders | lz::group_by_hashed([](const order& o) { return o.customer; },
+ *                                            [](double acc, const order& o) { return acc + o.amount; }, 0.0);
+ * // totals = { {1, 12.5}, {2, 5.0} }
+ * // With about 1000 customers, reserve the hash table once, regardless of the number of orders
+ * auto totals = orders | lz::group_by_hashed([](const order& o) { return o.customer; },
+ *                                            [](double acc, const order& o) { return acc + o.amount; }, 0.0, 1000);
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::group_by_hashed_adaptor group_by_hashed{};
+
+/**
+ * @brief Helper alias for the group by hashed iterable.
+ * @tparam Iterable The type of the iterable to group.
+ * @tparam KeyFn The type of the function that returns the key of an element.
+ * @tparam T The type of the aggregate.
+ * @tparam Aggregator The type of the function that combines an aggregate with an element.
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * using grouped_t = lz::group_by_hashed_iterable<std::vector<int>, std::function<int(int)>, int, std::plus<int>>;
+ * grouped_t grouped = lz::group_by_hashed(vec, std::function<int(int)>([](int i) { return i % 2; }), std::plus<int>{});
+ * ```
+ */
+template<class Iterable, class KeyFn, class T, class Aggregator>
+using group_by_hashed_iterable = detail::group_by_hashed_iterable<Iterable, KeyFn, T, Aggregator>;
+
+} // namespace lz
+
+#endif // LZ_GROUP_BY_HASHED_HPP
@@ -0,0 +1,42 @@
+#pragma once
+
+#ifndef LZ_INDEXED_FLATTEN_HPP
+#define LZ_INDEXED_FLATTEN_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/indexed_flatten.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Flattens a random access iterable of random access iterables (such as a vector of vectors) by one dimension, like
+ * `lz::flatten`, but returns a random access iterable. On construction, the sizes of the inner iterables are stored once in an
+ * index of prefix sums, which is shared by all copies of this iterable. This makes .size() O(1) and random access (`operator+`,
+ * `operator[]`, `lz::next`) O(log n), where n is the number of inner iterables. Incrementing and decrementing remain O(1)
+ * (amortized, if there are empty inner iterables). Since it is sized and random access, it can also be converted in parallel
+ * using `lz::to(lz::par)`. The inner iterables must be returned by reference, and must not be resized while this iterable is
+ * in use. Example:
+ * ```cpp
+ * std::vector<std::vector<int>> vectors = { { 1, 2, 3 }, {}, { 4, 5 } };
+ * auto flattened = lz::indexed_flatten(vectors); // { 1, 2, 3, 4, 5 }
+ * // or
+ * auto flattened = vectors | lz::indexed_flatten; // { 1, 2, 3, 4, 5 }
+ * auto fourth = flattened.begin()[3]; // 4, found using a binary search
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::indexed_flatten_adaptor indexed_flatten{};
+
+/**
+ * @brief Indexed flatten iterable helper alias.
+ * @tparam Iterable The type of the iterable to flatten.
+ * ```cpp
+ * std::vector<std::vector<int>> vectors = { { 1, 2, 3 }, { 4, 5, 6 }, { 7 } };
+ * lz::indexed_flatten_iterable<std::vector<std::vector<int>>> flattened = lz::indexed_flatten(vectors);
+ * ```
+ */
+template<class Iterable>
+using indexed_flatten_iterable = detail::indexed_flatten_iterable<Iterable>;
+
+} // namespace lz
+
+#endif
@@ -0,0 +1,51 @@
+#pragma once
+
+#ifndef LZ_JOIN_TO_STRING_HPP
+#define LZ_JOIN_TO_STRING_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/join_to_string.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Joins the strings of an iterable into a std::string, separated by a separator. If the iterable is forward and its
+ * elements are references or views (such as lz::string_view), the exact length is calculated in a first pass, so that the result
+ * is allocated once. Otherwise, the elements are only traversed once. Elements must be convertible to `lz::string_view`, have a
+ * `data()` and `size()` member, have a `value()` member that returns a `lz::string_view` (such as lz::csv_field), or be a `char`.
+ * Use lz::format to join other types. Example:
+ * ```cpp
+ * std::vector<std::string> vec = { "a", "b", "c" };
+ * std::string joined = lz::join_to_string(vec, ", "); // "a, b, c"
+ * // or
+ * std::string joined = vec | lz::join_to_string(", "); // "a, b, c"
+ * std::string sentence = "hello world";
+ * std::string words = sentence | lz::sv_split(' ') | lz::join_to_string("_"); // "hello_world"
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::join_to_string_adaptor join_to_string{};
+
+/**
+ * @brief Joins the strings of an iterable into a caller supplied std::string or output iterator, separated by a separator.
+ * When appending to a std::string, the exact length is calculated first if the iterable is forward and its elements are
+ * references or views, so that the string is allocated at most once, and its existing capacity is reused. A pointer to a
+ * contiguous buffer receives every string in one copy, the buffer must be large enough. Elements have the same requirements
+ * as lz::join_to_string. Example:
+ * ```cpp
+ * std::vector<std::string> vec = { "a", "b", "c" };
+ * std::string output = "letters: ";
+ * lz::join_to(vec, output, ", "); // output = "letters: a, b, c"
+ * // or
+ * vec | lz::join_to(output, ", ");
+ *
+ * char buffer[16];
+ * char* end = lz::join_to(vec, buffer, ", "); // buffer = "a, b, c", end = buffer + 7
+ * // or
+ * char* end = vec | lz::join_to(buffer, ", ");
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::join_to_adaptor join_to{};
+
+} // namespace lz
+
+#endif // LZ_JOIN_TO_STRING_HPP
@@ -0,0 +1,45 @@
+#pragma once
+
+#ifndef LZ_MEMOIZE_MAP_HPP
+#define LZ_MEMOIZE_MAP_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/memoize_map.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Applies a function to each element in an iterable, like `lz::map`, but stores the results, so that the function is
+ * called at most once per element, no matter how many times an element is dereferenced or how many times the iterable is
+ * traversed. Useful for expensive functions in combination with multi pass iterables, such as `lz::pairwise`, `lz::chunks` or
+ * `lz::cartesian_product`. For random access iterables, the results are stored in a buffer that is allocated once (with one
+ * slot per element), the first time an element is dereferenced. For forward iterables, the results are stored in a deque that
+ * grows with the furthest position that was dereferenced. The iterator category is random access if the input iterable is
+ * random access, forward otherwise. The input iterable must be forward or stronger. Its iterator returns a const reference to
+ * the stored result. The results are shared by all copies of this iterable and are not thread safe. If the input iterable has a
+ * .size() method, then this iterable will also have a .size() method. Example:
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * auto memoized = vec | lz::memoize_map([](int i) { return expensive(i); });
+ * // or
+ * auto memoized = lz::memoize_map(vec, [](int i) { return expensive(i); });
+ * auto pairs = memoized | lz::pairwise(2); // expensive is called once per element
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::memoize_map_adaptor memoize_map{};
+
+/**
+ * @brief Memoize map iterable helper alias.
+ * @tparam Iterable The type of the iterable to map.
+ * @tparam UnaryOp The type of the unary operation to apply to each element.
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * lz::memoize_map_iterable<std::vector<int>, std::function<int(int)>> map_vec(vec, [](int i) { return i * 2; });
+ * ```
+ */
+template<class Iterable, class UnaryOp>
+using memoize_map_iterable = detail::memoize_map_iterable<Iterable, UnaryOp>;
+
+} // namespace lz
+
+#endif
@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_MAP_HPP
+#define LZ_PARALLEL_MAP_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/parallel_map.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Applies a function to each element in an iterable, like `lz::map`, but evaluates the function on `threads` worker
+ * threads, ahead of the consumer. The results are yielded in the same order as the input. To preserve this order, completed
+ * results are kept in a reorder buffer of `window` slots: at most `window` elements are pulled from the input iterable ahead
+ * of the element that is currently being consumed. Elements of the input iterable are pulled one at a time and copied before
+ * they are passed to the function, the function itself may be called concurrently and must therefore be thread safe. The
+ * worker threads are started when calling begin() and are stopped when the last copy of the iterator is destroyed. Exceptions
+ * thrown by the function are rethrown when incrementing the iterator. Its iterator category is input, its end() function
+ * returns a sentinel and it contains a .size() method if the input iterable is sized. `threads` defaults to
+ * `std::thread::hardware_concurrency()` and `window` defaults to 4 * threads. Example:
+ * ```cpp
+ * std::vector<std::string> lines = { "1", "2", "3" };
+ * auto parsed = lz::parallel_map(lines, [](const std::string& s) { return std::stoi(s); }, 4, 16); // { 1, 2, 3 }
+ * // or
+ * auto parsed = lines | lz::parallel_map([](const std::string& s) { return std::stoi(s); }, 4, 16); // { 1, 2, 3 }
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::parallel_map_adaptor<true> parallel_map{};
+
+/**
+ * @brief Applies a function to each element in an iterable, like `lz::parallel_map`, but yields the results in order of
+ * completion instead of input order. This way, a single slow element does not hold back the results of the elements after it.
+ * At most `window` elements are pulled from the input iterable ahead of the element that is currently being consumed. Its
+ * iterator category is input, its end() function returns a sentinel and it contains a .size() method if the input iterable is
+ * sized. Example:
+ * ```cpp
+ * std::vector<std::string> lines = { "1", "2", "3" };
+ * auto parsed = lz::unordered_parallel_map(lines, [](const std::string& s) { return std::stoi(s); }); // { 1, 2, 3 } in any order
+ * // or
+ * auto parsed = lines | lz::unordered_parallel_map([](const std::string& s) { return std::stoi(s); }); // { 1, 2, 3 } in any order
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::parallel_map_adaptor<false> unordered_parallel_map{};
+
+/**
+ * @brief Helper alias for the parallel map iterable.
+ * @tparam Iterable The type of the iterable to map.
+ * @tparam UnaryOp The type of the function to apply to each element.
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3 };
+ * using iterable = lz::parallel_map_iterable<std::vector<int>, std::function<int(int)>>;
+ * iterable mapped = lz::parallel_map(vec, std::function<int(int)>([](int i) { return i * 2; }));
+ * ```
+ */
+template<class Iterable, class UnaryOp>
+using parallel_map_iterable = detail::parallel_map_iterable<Iterable, UnaryOp, true>;
+
+/**
+ * @brief Helper alias for the unordered parallel map iterable.
+ * @tparam Iterable The type of the iterable to map.
+ * @tparam UnaryOp The type of the function to apply to each element.
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3 };
+ * using iterable = lz::unordered_parallel_map_iterable<std::vector<int>, std::function<int(int)>>;
+ * iterable mapped = lz::unordered_parallel_map(vec, std::function<int(int)>([](int i) { return i * 2; }));
+ * ```
+ */
+template<class Iterable, class UnaryOp>
+using unordered_parallel_map_iterable = detail::parallel_map_iterable<Iterable, UnaryOp, false>;
+
+} // namespace lz
+
+#endif // LZ_PARALLEL_MAP_HPP
@@ -0,0 +1,69 @@
+#pragma once
+
+#ifndef LZ_PARSE_HPP
+#define LZ_PARSE_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/parse.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+#ifdef LZ_HAS_CXX_11
+
+/**
+ * @brief Parses every string of an iterable to a number of type `T`, in base 10. Its value type is an `lz::optional<T>`, which
+ * is empty if the string is not a valid number of type `T` or if it is out of range. Parsing uses the same syntax as
+ * `std::from_chars`: no leading whitespace and no leading `+`. Integers are parsed eight digits at a time where possible.
+ * Elements must be convertible to `lz::string_view`, or have a `value()` method that returns one, such as lz::csv_field. The
+ * iterator category, size and sentinel are the same as lz::map. Example:
+ * ```cpp
+ * std::string str = "1,-2,x,300";
+ * auto parsed = lz::parse<int>{}(lz::sv_split(str, ',')); // { 1, -2, nullopt, 300 }
+ * // or
+ * auto parsed = str | lz::sv_split(',') | lz::parse<int>{}; // { 1, -2, nullopt, 300 }
+ * auto bytes = str | lz::sv_split(',') | lz::parse<std::uint8_t>{}; // { 1, nullopt, nullopt, nullopt }
+ * auto doubles = str | lz::sv_split(',') | lz::parse<double>{}; // { 1.0, -2.0, nullopt, 300.0 }
+ * ```
+ * @tparam T The integral (except bool) or floating point type to parse to.
+ */
+template<class T>
+using parse = detail::parse_adaptor<T>;
+
+#else
+
+/**
+ * @brief Parses every string of an iterable to a number of type `T`, in base 10. Its value type is an `lz::optional<T>`, which
+ * is empty if the string is not a valid number of type `T` or if it is out of range. Parsing uses the same syntax as
+ * `std::from_chars`: no leading whitespace and no leading `+`. Integers are parsed eight digits at a time where possible.
+ * Elements must be convertible to `lz::string_view`, or have a `value()` method that returns one, such as lz::csv_field. The
+ * iterator category, size and sentinel are the same as lz::map. Example:
+ * ```cpp
+ * std::string str = "1,-2,x,300";
+ * auto parsed = lz::parse<int>(lz::sv_split(str, ',')); // { 1, -2, nullopt, 300 }
+ * // or
+ * auto parsed = str | lz::sv_split(',') | lz::parse<int>; // { 1, -2, nullopt, 300 }
+ * auto bytes = str | lz::sv_split(',') | lz::parse<std::uint8_t>; // { 1, nullopt, nullopt, nullopt }
+ * auto doubles = str | lz::sv_split(',') | lz::parse<double>; // { 1.0, -2.0, nullopt, 300.0 }
+ * ```
+ * @tparam T The integral (except bool) or floating point type to parse to.
+ */
+template<class T>
+LZ_INLINE_VAR constexpr detail::parse_adaptor<T> parse{};
+
+#endif
+
+/**
+ * @brief Parse iterable helper alias.
+ * @tparam T The type that is parsed to.
+ * @tparam Iterable The type of the iterable of strings.
+ * ```cpp
+ * std::vector<lz::string_view> strings = { "1", "2" };
+ * lz::parse_iterable<int, std::vector<lz::string_view>> parsed = lz::parse<int>(strings);
+ * ```
+ */
+template<class T, class Iterable>
+using parse_iterable = detail::map_iterable<Iterable, detail::parse_fn<T>>;
+
+} // namespace lz
+
+#endif // LZ_PARSE_HPP
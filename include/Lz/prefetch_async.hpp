@@ -0,0 +1,46 @@
+#pragma once
+
+#ifndef LZ_PREFETCH_ASYNC_HPP
+#define LZ_PREFETCH_ASYNC_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/prefetch_async.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Iterates over the input iterable on a background thread, and hands its elements to the consumer through a lock-free
+ * single producer/single consumer ring buffer of `capacity` (defaults to 1024) elements. This way, the (I/O bound) stages before
+ * this adaptor run in parallel with the (CPU bound) stages after it, without restructuring the pipeline. The elements of the
+ * input iterable are copied into the buffer. The consumer picks up all elements that have become available since its last check
+ * with a single synchronization. The background thread is started when calling begin() and is stopped when the last copy of the
+ * iterator is destroyed. Exceptions thrown by the input iterable are rethrown when incrementing the iterator. Its iterator
+ * category is input, its end() function returns a sentinel and it contains a .size() method if the input iterable is sized.
+ * Example:
+ * ```cpp
+ * std::ifstream file("numbers.txt");
+ * // reads the numbers from the file on a background thread, while `process` runs on the current thread
+ * auto numbers = lz::generate_while([&file]() { int i = 0; const bool ok = static_cast<bool>(file >> i); return std::make_pair(i, ok); });
+ * auto processed = lz::prefetch_async(numbers, 256) | lz::map(process);
+ * // or
+ * auto processed = numbers | lz::prefetch_async(256) | lz::map(process);
+ * // or, using the default capacity
+ * auto processed = numbers | lz::prefetch_async | lz::map(process);
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::prefetch_async_adaptor prefetch_async{};
+
+/**
+ * @brief Helper alias for the prefetch async iterable.
+ * @tparam Iterable The type of the iterable to read ahead.
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3 };
+ * lz::prefetch_async_iterable<std::vector<int>> prefetched = lz::prefetch_async(vec);
+ * ```
+ */
+template<class Iterable>
+using prefetch_async_iterable = detail::prefetch_async_iterable<Iterable>;
+
+} // namespace lz
+
+#endif // LZ_PREFETCH_ASYNC_HPP
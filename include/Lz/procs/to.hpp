@@ -5,16 +5,24 @@
 
 #include <Lz/algorithm/copy.hpp>
 #include <Lz/algorithm/for_each.hpp>
+#include <Lz/basic_iterable.hpp>
 #include <Lz/detail/adaptors/fn_args_holder.hpp>
+#include <Lz/detail/chunked_buffer.hpp>
 #include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/parallel_fill.hpp>
 #include <Lz/detail/traits/enable_if.hpp>
 #include <Lz/detail/traits/first_arg.hpp>
 #include <Lz/detail/traits/is_iterable.hpp>
+#include <Lz/detail/traits/is_sized.hpp>
 #include <Lz/detail/traits/iterator_categories.hpp>
 #include <Lz/detail/traits/remove_ref.hpp>
+#include <Lz/detail/traits/static_size.hpp>
 #include <Lz/detail/traits/strict_iterator_traits.hpp>
 #include <Lz/detail/traits/void.hpp>
+#include <Lz/procs/eager_size.hpp>
 #include <Lz/procs/size.hpp>
+#include <array>
+#include <iterator>
 
 #ifdef LZ_HAS_CONCEPTS
 
@@ -39,6 +47,95 @@ struct prealloc_container<Iterable, Container,
     }
 };
 
+template<class Container, class = void>
+struct has_reserve : std::false_type {};
+
+template<class Container>
+struct has_reserve<Container, void_t<decltype(std::declval<Container&>().reserve(size_t{}))>> : std::true_type {};
+
+template<class Container, class = void>
+struct is_contiguous_resizable : std::false_type {};
+
+template<class Container>
+struct is_contiguous_resizable<
+    Container, void_t<decltype(std::declval<Container&>().resize(size_t{})),
+                      decltype(std::declval<Container&>().push_back(std::declval<typename Container::value_type>())),
+                      enable_if_t<std::is_same<decltype(std::declval<Container&>().data()), typename Container::value_type*>::value>>>
+    : std::true_type {};
+
+template<class Container, class = void>
+struct has_resize_and_overwrite : std::false_type {};
+
+template<class Container>
+struct has_resize_and_overwrite<Container, void_t<decltype(std::declval<Container&>().resize_and_overwrite(
+                                               size_t{}, std::declval<size_t (*)(typename Container::value_type*, size_t)>()))>>
+    : std::true_type {};
+
+// resize_and_overwrite has undefined behaviour if the operation throws, so only use it if copying cannot throw
+template<class Iterable, class Container>
+struct use_resize_and_overwrite
+    : std::integral_constant<bool, has_resize_and_overwrite<Container>::value && noexcept(*std::declval<iter_t<Iterable>&>()) &&
+                                      noexcept(++std::declval<iter_t<Iterable>&>()) &&
+                                      noexcept(std::declval<iter_t<Iterable>&>() != std::declval<sentinel_t<Iterable>&>()) &&
+                                      std::is_nothrow_assignable<typename Container::value_type&, ref_iterable_t<Iterable>>::value> {
+};
+
+template<class Iterable, class Container, class = void>
+struct can_write_in_place : std::false_type {};
+
+// Elements that can be assigned to trivial elements of a contiguous container (e.g. std::vector<int> or std::string), can be
+// written directly into place, instead of using push_back
+template<class Iterable, class Container>
+struct can_write_in_place<Iterable, Container, enable_if_t<is_contiguous_resizable<Container>::value>>
+    : std::integral_constant<bool, std::is_trivial<typename Container::value_type>::value &&
+                                       std::is_assignable<typename Container::value_type&, ref_iterable_t<Iterable>>::value> {
+};
+
+template<class Iterable, class Container>
+struct is_bulk_writable
+    : std::integral_constant<bool, is_sized<Iterable>::value && can_write_in_place<Iterable, Container>::value> {};
+
+// Iterables with a copy_to member (such as lz::random) are written using that member by bulk_write, which is faster than the
+// (begin, end) constructor of the container, even if the iterable is random access
+template<class Iterable, class Container, class = void>
+struct has_copy_to_data : std::false_type {};
+
+template<class Iterable, class Container>
+struct has_copy_to_data<Iterable, Container, enable_if_t<is_contiguous_resizable<Container>::value>>
+    : has_copy_to<remove_cvref_t<Iterable>, typename Container::value_type*> {};
+
+/**
+ * Appends the elements of @p iterable to @p container by growing the container once and writing the elements directly into
+ * place. This way, no capacity check and size update is needed per element (as with push_back). If the container has a
+ * `resize_and_overwrite` member (std::basic_string since C++23) and copying cannot throw, the elements are not value
+ * initialized first. lz::copy uses std::copy if possible, so contiguous iterables of the same (trivial) type are copied using
+ * memmove.
+ */
+template<class Iterable, class Container>
+LZ_CONSTEXPR_CXX_20 enable_if_t<!use_resize_and_overwrite<Iterable, Container>::value>
+bulk_write(Iterable&& iterable, Container& container, const size_t size) {
+    const auto old_size = container.size();
+    container.resize(old_size + size);
+    lz::copy(std::forward<Iterable>(iterable), container.data() + old_size);
+}
+
+template<class Iterable, class Container>
+LZ_CONSTEXPR_CXX_20 enable_if_t<use_resize_and_overwrite<Iterable, Container>::value>
+bulk_write(Iterable&& iterable, Container& container, const size_t size) {
+    using pointer = typename Container::value_type*;
+    const auto old_size = container.size();
+    container.resize_and_overwrite(old_size + size, [&iterable, old_size](pointer out, const size_t new_size) {
+        lz::copy(std::forward<Iterable>(iterable), out + old_size);
+        return new_size;
+    });
+}
+
+template<class Iterable, class Container>
+LZ_CONSTEXPR_CXX_20 void bulk_write(Iterable&& iterable, Container& container) {
+    const auto size = static_cast<size_t>(lz::size(iterable));
+    bulk_write(std::forward<Iterable>(iterable), container, size);
+}
+
 #ifndef LZ_HAS_CXX_17
 
 template<class Container, class = void>
@@ -142,11 +239,35 @@ struct custom_copier_for {
     }
 };
 
+// If the size of the iterable is known at compile time, it is checked at compile time and the elements are copied using a loop
+// with a fixed number of iterations, which can be unrolled by the compiler
+template<class T, size_t N>
+struct custom_copier_for<std::array<T, N>> {
+    template<class Iterable>
+    LZ_CONSTEXPR_CXX_17 detail::enable_if_t<detail::has_static_size<Iterable>::value>
+    copy(Iterable&& iterable, std::array<T, N>& container) const {
+        static_assert(static_size<Iterable>::value <= N, "The iterable does not fit in the std::array");
+        auto it = detail::begin(iterable);
+        for (size_t i = 0; i < static_size<Iterable>::value; ++i, ++it) {
+            container[i] = *it;
+        }
+    }
+
+    template<class Iterable>
+    LZ_CONSTEXPR_CXX_14 detail::enable_if_t<!detail::has_static_size<Iterable>::value>
+    copy(Iterable&& iterable, std::array<T, N>& container) const {
+        lz::copy(std::forward<Iterable>(iterable), container.begin());
+    }
+};
+
 #ifdef LZ_HAS_CXX_17
 
 template<class Iterable, class Container>
 LZ_CONSTEXPR_CXX_20 void copy_to_container(Iterable&& iterable, Container& container) {
-    if constexpr (has_push_back_v<Container>) {
+    if constexpr (is_bulk_writable<Iterable, Container>::value) {
+        bulk_write(std::forward<Iterable>(iterable), container);
+    }
+    else if constexpr (has_push_back_v<Container>) {
         prealloc_container<Iterable, Container>{}.try_reserve(iterable, container);
         lz::copy(std::forward<Iterable>(iterable), std::back_inserter(container));
     }
@@ -173,13 +294,21 @@ LZ_CONSTEXPR_CXX_20 void copy_to_container(Iterable&& iterable, Container& conta
 
 #else
 
+// Container is contiguous and resizable, and iterable is sized (write in place)
+template<class Iterable, class Container>
+LZ_CONSTEXPR_CXX_20 enable_if_t<is_bulk_writable<Iterable, Container>::value>
+copy_to_container(Iterable&& iterable, Container& container) {
+    bulk_write(std::forward<Iterable>(iterable), container);
+}
+
 // Container has:
 // - push_back (use push_back)
 // - insert
 // - has_insert_after
 template<class Iterable, class Container>
 LZ_CONSTEXPR_CXX_20 enable_if_t<has_push_back<Container>::value && has_insert<Container>::value &&
-                                has_insert_after<Container>::value && !has_push<Container>::value>
+                                has_insert_after<Container>::value && !has_push<Container>::value &&
+                                !is_bulk_writable<Iterable, Container>::value>
 copy_to_container(Iterable&& iterable, Container& container) {
     prealloc_container<Iterable, Container>{}.try_reserve(iterable, container);
     lz::copy(std::forward<Iterable>(iterable), std::back_inserter(container));
@@ -190,7 +319,8 @@ copy_to_container(Iterable&& iterable, Container& container) {
 // - insert
 template<class Iterable, class Container>
 LZ_CONSTEXPR_CXX_20 enable_if_t<has_push_back<Container>::value && has_insert<Container>::value &&
-                                !has_insert_after<Container>::value && !has_push<Container>::value>
+                                !has_insert_after<Container>::value && !has_push<Container>::value &&
+                                !is_bulk_writable<Iterable, Container>::value>
 copy_to_container(Iterable&& iterable, Container& container) {
     prealloc_container<Iterable, Container>{}.try_reserve(iterable, container);
     lz::copy(std::forward<Iterable>(iterable), std::back_inserter(container));
@@ -261,6 +391,13 @@ struct container_constructor {
         if constexpr (std::is_constructible<Container, Iterable, remove_cvref_t<Args>...>::value) {
             return Container{ std::forward<Iterable>(iterable), std::forward<Args>(args)... };
         }
+        else if constexpr ((!is_ra_v<it> || has_copy_to_data<Iterable, Container>::value) &&
+                           is_bulk_writable<Iterable, Container>::value) {
+            // Prevent the (begin, end) constructor from traversing the iterable twice or from bypassing copy_to
+            Container container{ std::forward<Args>(args)... };
+            bulk_write(std::forward<Iterable>(iterable), container);
+            return container;
+        }
         else if constexpr (std::is_constructible_v<Container, it, sentinel_t<Iterable>, remove_cvref_t<Args>...>) {
             return Container{ detail::begin(iterable), detail::end(iterable), std::forward<Args>(args)... };
         }
@@ -288,6 +425,12 @@ struct container_constructor {
     template<class Iterable, class... Args>
     using constructible_from_iterable = std::is_constructible<Container, Iterable, remove_cvref_t<Args>...>;
 
+    // Prevent the (begin, end) constructor from traversing the iterable twice or from bypassing copy_to
+    template<class Iterable>
+    using prefer_bulk_write =
+        std::integral_constant<bool, (!is_ra<iter_t<Iterable>>::value || has_copy_to_data<Iterable, Container>::value) &&
+                                         is_bulk_writable<Iterable, Container>::value>;
+
     template<class Iterable, class... Args>
     LZ_NODISCARD static constexpr enable_if_t<constructible_from_iterable<Iterable, Args...>::value, Container>
     construct(Iterable&& iterable, Args&&... args) {
@@ -295,15 +438,26 @@ struct container_constructor {
     }
 
     template<class Iterable, class... Args>
-    LZ_NODISCARD static constexpr enable_if_t<
-        !constructible_from_iterable<Iterable, Args...>::value && constructible_from_it_sent<Iterable, Args...>::value, Container>
+    LZ_NODISCARD static LZ_CONSTEXPR_CXX_20
+        enable_if_t<!constructible_from_iterable<Iterable, Args...>::value && prefer_bulk_write<Iterable>::value, Container>
+        construct(Iterable&& iterable, Args&&... args) {
+        Container container{ std::forward<Args>(args)... };
+        bulk_write(std::forward<Iterable>(iterable), container);
+        return container;
+    }
+
+    template<class Iterable, class... Args>
+    LZ_NODISCARD static constexpr enable_if_t<!constructible_from_iterable<Iterable, Args...>::value &&
+                                                  !prefer_bulk_write<Iterable>::value &&
+                                                  constructible_from_it_sent<Iterable, Args...>::value,
+                                              Container>
     construct(Iterable&& iterable, Args&&... args) {
         return Container{ detail::begin(iterable), detail::end(iterable), std::forward<Args>(args)... };
     }
 
     template<class Iterable, class... Args>
     LZ_NODISCARD static LZ_CONSTEXPR_CXX_14
-        enable_if_t<!constructible_from_iterable<Iterable, Args...>::value &&
+        enable_if_t<!constructible_from_iterable<Iterable, Args...>::value && !prefer_bulk_write<Iterable>::value &&
                         !constructible_from_it_sent<Iterable, Args...>::value &&
                         constructible_from_it_it<Iterable, Args...>::value && is_ra<iter_t<Iterable>>::value,
                     Container>
@@ -314,7 +468,7 @@ struct container_constructor {
 
     template<class Iterable, class... Args>
     LZ_NODISCARD static LZ_CONSTEXPR_CXX_14
-        enable_if_t<!constructible_from_iterable<Iterable, Args...>::value &&
+        enable_if_t<!constructible_from_iterable<Iterable, Args...>::value && !prefer_bulk_write<Iterable>::value &&
                         !constructible_from_it_sent<Iterable, Args...>::value &&
                         (!constructible_from_it_it<Iterable, Args...>::value || !is_ra<iter_t<Iterable>>::value),
                     Container>
@@ -327,24 +481,245 @@ struct container_constructor {
 #endif
 };
 
+template<class Container, class Iterable>
+using use_strategy = std::integral_constant<bool, !is_sized<Iterable>::value && has_reserve<Container>::value>;
+
+// Sized iterables and containers that cannot be reserved don't benefit from buffering
+template<class Container, class Iterable, class Allocator, class... Args>
+LZ_CONSTEXPR_CXX_20 enable_if_t<!use_strategy<Container, Iterable>::value, Container>
+construct_buffered(Iterable&& iterable, const chunked_buffering<Allocator>&, Args&&... args) {
+    return container_constructor<Container>::construct(std::forward<Iterable>(iterable), std::forward<Args>(args)...);
+}
+
+template<class Container, class Iterable, class Allocator, class... Args>
+enable_if_t<use_strategy<Container, Iterable>::value, Container>
+construct_buffered(Iterable&& iterable, const chunked_buffering<Allocator>& strategy, Args&&... args) {
+    using value_type = typename Container::value_type;
+    using ref = ref_iterable_t<Iterable>;
+
+    chunked_buffer<value_type, remove_cvref_t<decltype(strategy.allocator())>> buffer{ strategy.chunk_size(),
+                                                                                       strategy.allocator() };
+    lz::for_each(std::forward<Iterable>(iterable), [&buffer](ref value) { buffer.push_back(static_cast<ref>(value)); });
+
+    Container container{ std::forward<Args>(args)... };
+    container.reserve(container.size() + buffer.size());
+    buffer.drain([&container](value_type* first, value_type* last) {
+        copy_to_container(lz::make_basic_iterable(std::make_move_iterator(first), std::make_move_iterator(last)), container);
+    });
+    return container;
+}
+
+template<class Container, class Iterable, class... Args>
+LZ_CONSTEXPR_CXX_20 enable_if_t<!use_strategy<Container, Iterable>::value, Container>
+construct_counted(Iterable&& iterable, Args&&... args) {
+    return container_constructor<Container>::construct(std::forward<Iterable>(iterable), std::forward<Args>(args)...);
+}
+
+template<class Container, class Iterable, class... Args>
+LZ_CONSTEXPR_CXX_20 enable_if_t<use_strategy<Container, Iterable>::value && can_write_in_place<Iterable, Container>::value, Container>
+construct_counted(Iterable&& iterable, Args&&... args) {
+    Container container{ std::forward<Args>(args)... };
+    const auto size = static_cast<size_t>(lz::eager_size(iterable));
+    bulk_write(std::forward<Iterable>(iterable), container, size);
+    return container;
+}
+
+template<class Container, class Iterable, class... Args>
+LZ_CONSTEXPR_CXX_20 enable_if_t<use_strategy<Container, Iterable>::value && !can_write_in_place<Iterable, Container>::value, Container>
+construct_counted(Iterable&& iterable, Args&&... args) {
+    Container container{ std::forward<Args>(args)... };
+    container.reserve(container.size() + static_cast<size_t>(lz::eager_size(iterable)));
+    copy_to_container(std::forward<Iterable>(iterable), container);
+    return container;
+}
+
+template<class Iterable, class Container, class = void>
+struct is_parallel_fillable : std::false_type {};
+
+// Containers that can be resized and of which the elements can be assigned from multiple threads through random access
+// iterators (std::vector<bool> is excluded because its elements share memory)
+template<class Iterable, class Container>
+struct is_parallel_fillable<
+    Iterable, Container,
+    void_t<decltype(std::declval<Container&>().resize(size_t{})),
+           enable_if_t<is_ra<typename Container::iterator>::value &&
+                       std::is_same<decltype(*std::declval<Container&>().begin()), typename Container::value_type&>::value>>>
+    : std::integral_constant<bool, std::is_default_constructible<typename Container::value_type>::value &&
+                                       std::is_assignable<typename Container::value_type&, ref_iterable_t<Iterable>>::value> {
+};
+
+template<class Container, class = void>
+struct has_range_insert : std::false_type {};
+
+// Associative containers, such as std::set and std::unordered_map
+template<class Container>
+struct has_range_insert<Container, void_t<decltype(std::declval<Container&>().insert(std::declval<typename Container::iterator>(),
+                                                                                   std::declval<typename Container::iterator>()))>>
+    : std::true_type {};
+
+template<class Container, class = void>
+struct has_merge : std::false_type {};
+
+template<class Container>
+struct has_merge<Container, void_t<decltype(std::declval<Container&>().merge(std::declval<Container&>()))>> : std::true_type {};
+
+template<class Container>
+enable_if_t<has_merge<Container>::value> merge_into(Container& container, Container& part) {
+    container.merge(part);
+}
+
+template<class Container>
+enable_if_t<!has_merge<Container>::value> merge_into(Container& container, Container& part) {
+    container.insert(std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+}
+
+// Iterables of which the iterators share mutable state (such as lz::random, whose iterators share the engine) cannot be
+// iterated from multiple threads at once. They opt out using a `static constexpr bool thread_splittable = false` member
+template<class Iterable, class = void>
+struct is_thread_splittable : std::true_type {};
+
+template<class Iterable>
+struct is_thread_splittable<Iterable, enable_if_t<!remove_cvref_t<Iterable>::thread_splittable>> : std::false_type {};
+
+template<class Iterable>
+using is_parallelizable = std::integral_constant<bool, is_sized<Iterable>::value && is_ra<iter_t<Iterable>>::value &&
+                                                           is_thread_splittable<Iterable>::value>;
+
+template<class Container, class Iterable, class... Args>
+LZ_CONSTEXPR_CXX_20
+    enable_if_t<!is_parallelizable<Iterable>::value ||
+                    (!is_parallel_fillable<Iterable, Container>::value && !has_range_insert<Container>::value),
+                Container>
+    construct_parallel(Iterable&& iterable, const parallel_execution&, Args&&... args) {
+    return container_constructor<Container>::construct(std::forward<Iterable>(iterable), std::forward<Args>(args)...);
+}
+
+// Every element has a known position in the container, so every thread assigns a disjoint slice
+template<class Container, class Iterable, class... Args>
+enable_if_t<is_parallelizable<Iterable>::value && is_parallel_fillable<Iterable, Container>::value, Container>
+construct_parallel(Iterable&& iterable, const parallel_execution& execution, Args&&... args) {
+    using in_diff = diff_iterable_t<Iterable>;
+    using out_diff = typename std::iterator_traits<typename Container::iterator>::difference_type;
+
+    Container container{ std::forward<Args>(args)... };
+    const auto size = static_cast<size_t>(lz::size(iterable));
+    const auto old_size = container.size();
+    container.resize(old_size + size);
+
+    const auto in = detail::begin(iterable);
+    const auto out = container.begin() + static_cast<out_diff>(old_size);
+    for_each_slice_parallel(size, execution, [&in, &out](size_t, const size_t first, const size_t last) {
+        auto in_it = in + static_cast<in_diff>(first);
+        auto out_it = out + static_cast<out_diff>(first);
+        for (size_t i = first; i < last; ++i, ++in_it, ++out_it) {
+            *out_it = *in_it;
+        }
+    });
+    return container;
+}
+
+// Every thread builds a container of its own slice, which are merged afterwards
+template<class Container, class Iterable, class... Args>
+enable_if_t<is_parallelizable<Iterable>::value && !is_parallel_fillable<Iterable, Container>::value &&
+                has_range_insert<Container>::value,
+            Container>
+construct_parallel(Iterable&& iterable, const parallel_execution& execution, Args&&... args) {
+    using in_diff = diff_iterable_t<Iterable>;
+
+    const auto size = static_cast<size_t>(lz::size(iterable));
+    std::vector<Container> parts;
+    const auto part_count = execution.thread_count(size);
+    parts.reserve(part_count);
+    for (size_t i = 0; i < part_count; ++i) {
+        parts.push_back(Container{ args... });
+    }
+
+    const auto in = detail::begin(iterable);
+    for_each_slice_parallel(size, execution, [&in, &parts](const size_t slice, const size_t first, const size_t last) {
+        copy_to_container(lz::make_basic_iterable(in + static_cast<in_diff>(first), in + static_cast<in_diff>(last)),
+                          parts[slice]);
+    });
+
+    Container container = std::move(parts.front());
+    for (size_t i = 1; i < parts.size(); ++i) {
+        merge_into(container, parts[i]);
+    }
+    return container;
+}
+
+template<class T>
+struct is_to_strategy : std::false_type {};
+
+template<class Allocator>
+struct is_to_strategy<chunked_buffering<Allocator>> : std::true_type {};
+
+template<>
+struct is_to_strategy<exact_count_t> : std::true_type {};
+
+template<>
+struct is_to_strategy<parallel_execution> : std::true_type {};
+
 template<class Container>
 struct to_adaptor {
     using adaptor = to_adaptor<Container>;
 
     template<class Iterable, class... Args>
-    LZ_NODISCARD constexpr Container operator()(Iterable&& iterable, Args&&... args) const {
+    LZ_NODISCARD constexpr enable_if_t<!is_to_strategy<remove_cvref_t<first_arg_t<Args...>>>::value, Container>
+    operator()(Iterable&& iterable, Args&&... args) const {
         return container_constructor<Container>::construct(std::forward<Iterable>(iterable), std::forward<Args>(args)...);
     }
+
+    template<class Iterable, class Allocator, class... Args>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Container
+    operator()(Iterable&& iterable, const chunked_buffering<Allocator>& strategy, Args&&... args) const {
+        return construct_buffered<Container>(std::forward<Iterable>(iterable), strategy, std::forward<Args>(args)...);
+    }
+
+    template<class Iterable, class... Args>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Container operator()(Iterable&& iterable, const exact_count_t&, Args&&... args) const {
+        static_assert(is_fwd<iter_t<Iterable>>::value, "lz::exact_count requires a multipass (forward) iterable");
+        return construct_counted<Container>(std::forward<Iterable>(iterable), std::forward<Args>(args)...);
+    }
+
+    template<class Iterable, class... Args>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Container
+    operator()(Iterable&& iterable, const parallel_execution& execution, Args&&... args) const {
+        return construct_parallel<Container>(std::forward<Iterable>(iterable), execution, std::forward<Args>(args)...);
+    }
+};
+
+// Container<T, Args...>, where Args does not contain the strategy for lz::to (if any)
+template<template<class...> class Container, class T, class... Args>
+struct combined_container {
+    using type = Container<T, Args...>;
+};
+
+template<template<class...> class Container, class T, class Allocator, class... Args>
+struct combined_container<Container, T, chunked_buffering<Allocator>, Args...> {
+    using type = Container<T, Args...>;
 };
 
+template<template<class...> class Container, class T, class... Args>
+struct combined_container<Container, T, exact_count_t, Args...> {
+    using type = Container<T, Args...>;
+};
+
+template<template<class...> class Container, class T, class... Args>
+struct combined_container<Container, T, parallel_execution, Args...> {
+    using type = Container<T, Args...>;
+};
+
+template<template<class...> class Container, class Iterable, class... Args>
+using combined_container_t =
+    typename combined_container<Container, val_iterable_t<Iterable>, typename std::decay<Args>::type...>::type;
+
 template<template<class...> class Container>
 struct template_combiner {
     using adaptor = template_combiner<Container>;
 
     template<class Iterable, class... Args>
-    LZ_NODISCARD constexpr Container<val_iterable_t<Iterable>, typename std::decay<Args>::type...>
-    operator()(Iterable&& iterable, Args&&... args) const {
-        using C = Container<val_iterable_t<Iterable>, typename std::decay<Args>::type...>;
+    LZ_NODISCARD constexpr combined_container_t<Container, Iterable, Args...> operator()(Iterable&& iterable, Args&&... args) const {
+        using C = combined_container_t<Container, Iterable, Args...>;
         return to_adaptor<C>{}(std::forward<Iterable>(iterable), std::forward<Args>(args)...);
     }
 };
@@ -537,11 +912,11 @@ template<class Container, class... Args, class Iterable>
  * @return The `Container`
  */
 template<template<class...> class Container, class... Args, class Iterable>
-[[nodiscard]] constexpr Container<detail::val_iterable_t<Iterable>, Args...>
+[[nodiscard]] constexpr detail::combined_container_t<Container, Iterable, Args...>
 to(Iterable&& iterable, Args&&... args)
     requires(lz::iterable<Iterable>)
 {
-    using Cont = Container<detail::val_iterable_t<Iterable>, std::decay_t<Args>...>;
+    using Cont = detail::combined_container_t<Container, Iterable, Args...>;
     return to<Cont>(std::forward<Iterable>(iterable), std::forward<Args>(args)...);
 }
 
@@ -726,9 +1101,9 @@ to(Iterable&& iterable, Args&&... args) {
  * @return The `Container`
  */
 template<template<class...> class Container, class... Args, class Iterable>
-LZ_NODISCARD constexpr detail::enable_if_t<detail::is_iterable<Iterable>::value, Container<detail::val_iterable_t<Iterable>, Args...>>
+LZ_NODISCARD constexpr detail::enable_if_t<detail::is_iterable<Iterable>::value, detail::combined_container_t<Container, Iterable, Args...>>
 to(Iterable&& iterable, Args&&... args) {
-    using Cont = Container<detail::val_iterable_t<Iterable>, typename std::decay<Args>::type...>;
+    using Cont = detail::combined_container_t<Container, Iterable, Args...>;
     return to<Cont>(std::forward<Iterable>(iterable), std::forward<Args>(args)...);
 }
 
@@ -764,6 +1139,65 @@ to(Iterable&& iterable, Args&&... args) {
  */
 using detail::custom_copier_for;
 
+/**
+ * @brief Strategy that can be passed as the first argument of `lz::to` to convert unsized iterables (such as `lz::filter`).
+ * By default, these are appended one by one to the container, which grows geometrically: elements are moved log(n) times and
+ * the capacity of the container can be up to twice its size. With this strategy, the elements are first appended to a chain
+ * of chunks of `chunk_size` elements, allocated with `Allocator` (for instance an allocator that uses an arena). Afterwards,
+ * the container is reserved once with the exact size and the elements are moved into it, freeing every chunk as soon as it is
+ * moved. Sized iterables and containers without a `reserve` method are converted as usual. Example:
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * auto odd = lz::filter(vec, [](int i) { return i % 2 == 1; });
+ * auto result = odd | lz::to<std::vector>(lz::chunked); // capacity == size == 3
+ * // Chunks of 4096 elements, allocated from an arena
+ * std::pmr::monotonic_buffer_resource arena;
+ * result = odd | lz::to<std::vector>(lz::chunked_buffering<std::pmr::polymorphic_allocator<int>>(4096, &arena));
+ * ```
+ */
+using detail::chunked_buffering;
+
+/**
+ * @brief The default `lz::chunked_buffering` strategy for `lz::to`, with chunks of 1024 elements allocated using
+ * `std::allocator`. Example:
+ * ```cpp
+ * auto result = lz::filter(vec, [](int i) { return i % 2 == 1; }) | lz::to<std::vector>(lz::chunked);
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::chunked_buffering<> chunked{};
+
+/**
+ * @brief Strategy that can be passed as the first argument of `lz::to` to convert unsized, multipass iterables. The iterable
+ * is traversed twice: once to count its elements, so that the container is allocated once with the exact size, and once to
+ * copy them. Only use this if traversing the iterable is cheap compared to copying its elements. Sized iterables and
+ * containers without a `reserve` method are converted as usual. Example:
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * auto result = lz::filter(vec, [](int i) { return i % 2 == 1; }) | lz::to<std::vector>(lz::exact_count); // { 1, 3, 5 }
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::exact_count_t exact_count{};
+
+/**
+ * @brief Strategy that can be passed as the first argument of `lz::to` to convert sized random access iterables (such as
+ * `lz::map`, `lz::zip` or `lz::range` over random access iterables) using multiple threads. Containers that can be resized
+ * and have random access iterators (such as `std::vector`, `std::string` and `std::deque`) are resized once, after which
+ * every thread assigns a disjoint slice of the elements. For associative containers (such as `std::set` and
+ * `std::unordered_map`), every thread builds a container of its own slice, after which they are merged (using `merge` if
+ * available). Iterables of which the iterators share state (such as `lz::random`, but not `lz::counter_random`) and all
+ * other iterables and containers are converted on the calling thread. Because elements are evaluated concurrently and out of
+ * order, the functions in the pipeline must be thread safe. `lz::parallel_execution(threads, grain_size)` can be used to
+ * specify the number of threads and the minimum number of elements per thread. Example:
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * auto squares = lz::map(vec, [](int i) { return i * i; }) | lz::to<std::vector>(lz::par); // { 1, 4, 9, 16, 25 }
+ * auto set = lz::map(vec, [](int i) { return i % 2; }) | lz::to<std::set>(lz::parallel_execution(4, 1)); // { 0, 1 }
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::parallel_execution par{};
+
+using detail::parallel_execution;
+
 } // namespace lz
 
 #endif // LZ_PROCS_TO_HPP
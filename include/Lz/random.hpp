@@ -4,7 +4,9 @@
 #define LZ_RANDOM_HPP
 
 #include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/counter_random.hpp>
 #include <Lz/detail/adaptors/random.hpp>
+#include <Lz/util/random_engines.hpp>
 
 LZ_MODULE_EXPORT namespace lz {
 
@@ -48,6 +50,35 @@ LZ_INLINE_VAR constexpr detail::random_adaptor<true> random{};
  */
 LZ_INLINE_VAR constexpr detail::random_adaptor<false> common_random{};
 
+/**
+ * @brief Creates n random numbers, where the i-th number is a pure function of a seed and i (using the counter based
+ * `lz::philox4x32` engine). The numbers are therefore reproducible regardless of the order in which they are accessed or how
+ * many threads process them. The standard distributions are implementation defined, so the numbers are only reproducible for a
+ * given distribution and standard library. It contains a .size() method, is random access and does NOT have a sentinel.
+ * Example:
+ * ```cpp
+ * // overload 1. Uses std::uniform_int_distribution<int> as distribution.
+ * auto random = lz::counter_random(0, 10, 42, 5); // 5 random numbers in [0, 10], the same every run for seed 42
+ *
+ * // overload 2. Uses a custom distribution.
+ * std::normal_distribution<double> dist(0., 1.);
+ * auto random = lz::counter_random(dist, 42, 1000);
+ * auto vec = random | lz::to<std::vector>(lz::par); // Same result as lz::to<std::vector>()
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::counter_random_adaptor counter_random{};
+
+/**
+ * @brief Counter random iterable helper alias.
+ * @tparam Distribution The distribution type used to generate the random numbers.
+ * ```cpp
+ * using iterable = lz::counter_random_iterable<std::normal_distribution<double>>;
+ * iterable random = lz::counter_random(std::normal_distribution<double>(0., 1.), 42, 10);
+ * ```
+ */
+template<class Distribution>
+using counter_random_iterable = detail::counter_random_iterable<Distribution>;
+
 /**
  * @brief Common random iterable helper alias.
  * @tparam Arithmetic The arithmetic type of the random numbers.
@@ -5,6 +5,7 @@
 
 #include <Lz/procs/chain.hpp>
 #include <Lz/detail/adaptors/regex_split.hpp>
+#include <Lz/util/dfa_regex.hpp>
 
 LZ_MODULE_EXPORT namespace lz {
 
@@ -24,6 +25,9 @@ LZ_MODULE_EXPORT namespace lz {
  * // exactly what we want), rather than returning the matches
  * auto end = std::sregex_token_iterator<>();
  * auto splitter = lz::regex_split(begin, end); // { "Hello,", "world!", "How", "are", "you?" }
+ * // or use a matcher, such as lz::dfa_regex, which is a lot faster than std::regex
+ * lz::dfa_regex r2(R"(\s+)");
+ * auto splitter = lz::regex_split(s, r2); // { "Hello,", "world!", "How", "are", "you?" }
  * ```
  */
 LZ_INLINE_VAR constexpr detail::regex_split_adaptor regex_split{};
@@ -42,6 +46,19 @@ LZ_INLINE_VAR constexpr detail::regex_split_adaptor regex_split{};
 template<class RegexTokenIter, class RegexTokenSentinel = RegexTokenIter>
 using regex_split_iterable = detail::regex_split_iterable<RegexTokenIter, RegexTokenSentinel>;
 
+/**
+ * @brief Matcher split iterable helper alias.
+ *
+ * @tparam Matcher Type of the matcher, for instance lz::dfa_regex.
+ * ```cpp
+ * lz::dfa_regex r(R"(\s+)");
+ * std::string s = "    Hello, world! How are you?";
+ * lz::matcher_split_iterable<lz::dfa_regex> splitter = lz::regex_split(s, r);
+ * ```
+ */
+template<class Matcher>
+using matcher_split_iterable = detail::matcher_split_iterable<Matcher>;
+
 } // namespace lz
 
 #endif
@@ -0,0 +1,39 @@
+#pragma once
+
+#ifndef LZ_SAMPLE_HPP
+#define LZ_SAMPLE_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/sample.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Picks k random elements of the input iterable, using reservoir sampling. The input iterable is traversed once, when this
+ * function is called, and may be an input iterable of unknown size. Elements that are not picked are skipped without
+ * dereferencing them, in O(1) for random access iterables. The picked elements are copied into a vector that is shared by all
+ * copies of the result, in an unspecified order. If the input iterable has less than k elements, all of them are picked. If no
+ * seed is given, std::random_device is used. The result is random access and contains a .size() method. Example:
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * auto sample = lz::sample(vec, 2, 42); // sample = { 1, 5 } (2 random elements, always the same for seed 42)
+ * auto sample = vec | lz::sample(2, 42); // sample = { 1, 5 }
+ * auto sample = lz::sample(vec, 2); // sample = { 5, 2 } (2 random elements)
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::sample_adaptor sample{};
+
+/**
+ * @brief Sample iterable helper alias.
+ * @tparam Iterable Type of the iterable to pick the elements from.
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * lz::sample_iterable<std::vector<int>> sample = lz::sample(vec, 2, 42);
+ * ```
+ */
+template<class Iterable>
+using sample_iterable = detail::sample_iterable<Iterable>;
+
+} // namespace lz
+
+#endif // LZ_SAMPLE_HPP
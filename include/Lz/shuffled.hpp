@@ -0,0 +1,38 @@
+#pragma once
+
+#ifndef LZ_SHUFFLED_HPP
+#define LZ_SHUFFLED_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/shuffled.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Iterates over the input iterable in a random order, without copying or modifying it. The i-th element is the element at
+ * a position that a keyed bijection (a Feistel network) maps i to, so it uses O(1) extra memory, even for huge iterables. The
+ * same seed and size always give the same order. The input iterable must be random access and sized. The result is random
+ * access, contains a .size() method and does not have a sentinel. Example:
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * auto shuffled = lz::shuffled(vec, 42); // shuffled = { 2, 1, 5, 3, 4 } (a permutation of vec, always the same for 42)
+ * auto shuffled = vec | lz::shuffled(42); // shuffled = { 2, 1, 5, 3, 4 }
+ * auto shuffled = lz::range(std::int64_t{ 1000000000 }) | lz::shuffled(42); // Only O(1) memory
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::shuffled_adaptor shuffled{};
+
+/**
+ * @brief Shuffled iterable helper alias.
+ * @tparam Iterable Type of the iterable to shuffle.
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * lz::shuffled_iterable<std::vector<int>> shuffled = lz::shuffled(vec, 42);
+ * ```
+ */
+template<class Iterable>
+using shuffled_iterable = detail::shuffled_iterable<Iterable>;
+
+} // namespace lz
+
+#endif // LZ_SHUFFLED_HPP
@@ -122,6 +122,48 @@ LZ_INLINE_VAR constexpr detail::split_adaptor<std::string> s_split{};
  */
 LZ_INLINE_VAR constexpr detail::split_adaptor<lz::string_view> sv_split{};
 
+#ifdef LZ_HAS_CXX_11
+
+/**
+ * @brief Splits a contiguous string on any of the delimiters, which are known at compile time. Characters are classified using a
+ * mask that is computed at compile time, so multiple delimiters are handled in a single pass, at the same cost as one. Like
+ * lz::sv_split, consecutive delimiters result in empty strings. It returns a forward iterable of string views, its end() method
+ * returns a default_sentinel_t and the iterable does not contain a .size() method. Example:
+ * ```cpp
+ * std::string str = "a b\tc\n\nd";
+ * auto splitted = lz::split_any<' ', '\t', '\n'>{}(str); // {"a", "b", "c", "", "d"}
+ * // or
+ * auto splitted = str | lz::split_any<' ', '\t', '\n'>{}; // {"a", "b", "c", "", "d"}
+ * // Single delimiters are also supported
+ * auto splitted = str | lz::split_any<'\n'>{}; // {"a b\tc", "", "d"}
+ * ```
+ * @tparam Delimiters The characters to split on.
+ */
+template<char... Delimiters>
+using split_any = detail::split_any_adaptor<detail::char_set<char, Delimiters...>>;
+
+#else
+
+/**
+ * @brief Splits a contiguous string on any of the delimiters, which are known at compile time. Characters are classified using a
+ * mask that is computed at compile time, so multiple delimiters are handled in a single pass, at the same cost as one. Like
+ * lz::sv_split, consecutive delimiters result in empty strings. It returns a forward iterable of string views, its end() method
+ * returns a default_sentinel_t and the iterable does not contain a .size() method. Example:
+ * ```cpp
+ * std::string str = "a b\tc\n\nd";
+ * auto splitted = lz::split_any<' ', '\t', '\n'>(str); // {"a", "b", "c", "", "d"}
+ * // or
+ * auto splitted = str | lz::split_any<' ', '\t', '\n'>; // {"a", "b", "c", "", "d"}
+ * // Single delimiters are also supported
+ * auto splitted = str | lz::split_any<'\n'>; // {"a b\tc", "", "d"}
+ * ```
+ * @tparam Delimiters The characters to split on.
+ */
+template<char... Delimiters>
+LZ_INLINE_VAR constexpr detail::split_any_adaptor<detail::char_set<char, Delimiters...>> split_any{};
+
+#endif
+
 /**
  * @brief Split iterable helper alias.
  *
@@ -188,6 +230,19 @@ template<class Iterable>
 using sv_multiple_split_iterable = split_iterable<lz::basic_string_view<detail::val_iterable_t<Iterable>>, Iterable,
                                                   lz::copied<lz::basic_string_view<detail::val_iterable_t<Iterable>>>>;
 
+/**
+ * @brief Split iterable helper alias for lz::split_any. Returns lz::basic_string_view as value type.
+ * @tparam Iterable The input iterable type to split.
+ * @tparam Delimiters The characters to split on.
+ * ```cpp
+ * std::string to_split = "H d";
+ * lz::split_any_iterable<std::string, ' ', '\t'> splitter = lz::split_any<' ', '\t'>(to_split);
+ * ```
+ */
+template<class Iterable, char... Delimiters>
+using split_any_iterable =
+    split_iterable<lz::basic_string_view<detail::val_iterable_t<Iterable>>, Iterable, detail::char_set<char, Delimiters...>>;
+
 } // namespace lz
 
 #endif // LZ_STRING_SPLITTER_HPP
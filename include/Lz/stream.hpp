@@ -5,14 +5,17 @@
 
 #include <Lz/detail/adaptors/fn_args_holder.hpp>
 #include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/procs/begin_end.hpp>
+#include <Lz/detail/traits/is_iterable.hpp>
 #include <Lz/procs/chain.hpp> // for operator|
 #include <Lz/traits/lazy_view.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
 #include <ostream>
 #include <string>
 
-#if FMT_VERSION >= 80000
-#endif
-
 // clang-format off
 #if !defined(LZ_STANDALONE)
   #ifdef __GNUC__
@@ -23,6 +26,7 @@
     #pragma GCC diagnostic ignored "-Wctor-dtor-privacy"
     #pragma GCC diagnostic ignored "-Weffc++"
   #endif
+  #include <fmt/compile.h>
   #include <fmt/format.h>
   #include <fmt/ostream.h>
   #include <fmt/ranges.h>
@@ -40,6 +44,75 @@
 namespace lz {
 namespace detail {
 
+#if !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
+
+#ifndef LZ_STANDALONE
+using format_buffer = fmt::memory_buffer;
+#else
+using format_buffer = std::string;
+#endif
+
+// "{}" is by far the most used format. It is parsed at compile time, instead of once for every element
+inline bool is_default_format(const char* format) noexcept {
+    return std::strcmp(format, "{}") == 0;
+}
+
+template<class OutputIterator, class T>
+OutputIterator format_element(OutputIterator out, T&& value, const bool default_format, const char* format) {
+#ifndef LZ_STANDALONE
+
+    if (default_format) {
+#ifdef FMT_COMPILE
+        return fmt::format_to(std::move(out), FMT_COMPILE("{}"), value);
+#else
+        return fmt::format_to(std::move(out), "{}", value);
+#endif // FMT_COMPILE
+    }
+
+#if FMT_VERSION >= 80000
+    return fmt::format_to(std::move(out), fmt::runtime(format), value);
+#else
+    return fmt::format_to(std::move(out), format, value);
+#endif // FMT_VERSION >= 80000
+
+#else // ^^ !LZ_STANDALONE - vv LZ_STANDALONE
+
+    if (default_format) {
+        return std::format_to(std::move(out), "{}", value);
+    }
+    return std::vformat_to(std::move(out), format, std::make_format_args(value));
+
+#endif // !LZ_STANDALONE
+}
+
+// Formats every element to `out`. The separator is copied as is, instead of being formatted
+template<class Iterator, class S, class OutputIterator>
+OutputIterator
+format_joined(Iterator first, S last, OutputIterator out, const char* separator, const char* format) {
+    if (first == last) {
+        return out;
+    }
+
+    const bool default_format = is_default_format(format);
+    const auto separator_length = std::strlen(separator);
+
+    out = format_element(std::move(out), *first, default_format, format);
+    for (++first; first != last; ++first) {
+        out = std::copy(separator, separator + separator_length, std::move(out));
+        out = format_element(std::move(out), *first, default_format, format);
+    }
+    return out;
+}
+
+template<class Iterable>
+format_buffer format_to_buffer(const Iterable& iterable, const char* separator, const char* format) {
+    format_buffer buffer;
+    format_joined(detail::begin(iterable), detail::end(iterable), std::back_inserter(buffer), separator, format);
+    return buffer;
+}
+
+#endif // !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
+
 struct iterable_formatter {
     using adaptor = iterable_formatter;
 
@@ -47,7 +120,8 @@ struct iterable_formatter {
 
     /**
      * @brief Function that can be used to format an iterable to an output
-     * stream. Only defined if c++ 20 or if using `{fmt}`. Example:
+     * stream. Only defined if c++ 20 or if using `{fmt}`. The iterable is formatted to a buffer first, which is written to
+     * the stream at once. Example:
      * ```cpp
      * std::vector<int> vec = { 2, 4 };
      * lz::format(vec, std::cout, ", ", "{}"); // prints: 2, 4
@@ -64,43 +138,28 @@ struct iterable_formatter {
     template<class Iterable>
     void
     operator()(const Iterable& iterable, std::ostream& stream, const char* separator = ", ", const char* format = "{}") const {
-        auto it = iterable.begin();
-        auto end = iterable.end();
-        if (it == end) {
-            return;
-        }
-
-#ifndef LZ_STANDALONE
-
-#if FMT_VERSION >= 80000
-
-        fmt::print(stream, fmt::runtime(format), *it);
-        for (++it; it != end; ++it) {
-            fmt::print(stream, "{}", separator);
-            fmt::print(stream, fmt::runtime(format), *it);
-        }
-
-#else
-
-        fmt::print(stream, format, *it);
-        for (++it; it != end; ++it) {
-            fmt::print(stream, "{}", separator);
-            fmt::print(stream, format, *it);
-        }
-
-#endif // FMT_VERSION >= 80000
-
-#else // ^^ LZ_STANDALONE - vv !LZ_STANDALONE
-
-        std::ostreambuf_iterator<char> out_it(stream);
-        std::vformat_to(out_it, format, std::make_format_args(*it));
-
-        for (++it; it != end; ++it) {
-            std::vformat_to(out_it, "{}", std::make_format_args(separator));
-            std::vformat_to(out_it, format, std::make_format_args(*it));
-        }
+        const auto buffer = format_to_buffer(iterable, separator, format);
+        stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
 
-#endif // !LZ_STANDALONE
+    /**
+     * @brief Function that can be used to format an iterable to a file, such as `stdout`. Only defined if c++ 20 or if using
+     * `{fmt}`. The iterable is formatted to a buffer first, which is written to the file at once. Example:
+     * ```cpp
+     * std::vector<int> vec = { 2, 4 };
+     * lz::format(vec, stdout, ", ", "{}"); // prints: 2, 4
+     * lz::format(vec, stdout, ","); // prints: 2,4
+     * ```
+     *
+     * @param iterable Any iterable. May be a container or another iterable.
+     * @param file The file to write to
+     * @param separator The separator to use between elements. Default is ", "
+     * @param format The format to use for each element. Default is "{}"
+     */
+    template<class Iterable>
+    void operator()(const Iterable& iterable, std::FILE* file, const char* separator = ", ", const char* format = "{}") const {
+        const auto buffer = format_to_buffer(iterable, separator, format);
+        std::fwrite(buffer.data(), 1, buffer.size(), file);
     }
 
 #else
@@ -164,6 +223,25 @@ struct iterable_formatter {
         return { stream, separator, format };
     }
 
+    /**
+     * @brief Function that can be used with the pipe operator. This overload can be used with C++20's std::format or {fmt}.
+     * Example:
+     * ```cpp
+     * std::vector<int> vec = { 2, 4 };
+     * vec | lz::format(stdout, ", ", "{}"); // prints: 2, 4
+     * vec | lz::format(stdout); // prints: 2, 4
+     * ```
+     *
+     * @param file The file to write to
+     * @param separator The separator to use between elements. Default is ", "
+     * @param format The format to use for each element. Default is "{}"
+     * @return A function object that can be used with the pipe operator
+     */
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 fn_args_holder<adaptor, std::FILE*, const char*, const char*>
+    operator()(std::FILE* file, const char* separator = ", ", const char* format = "{}") const {
+        return { file, separator, format };
+    }
+
 #else
 
     /**
@@ -202,7 +280,7 @@ struct iterable_formatter {
 
 #endif // !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
 
-#if !defined(LZ_STANDALONE)
+#if !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
 
     /**
      * @brief Converts an iterable to a string, using the given separator and format. This overload can be used with C++20's
@@ -221,80 +299,88 @@ struct iterable_formatter {
      */
     template<class Iterable>
     LZ_NODISCARD std::string operator()(const Iterable& iterable, const char* separator = ", ", const char* format = "{}") const {
-#if FMT_VERSION >= 80000
-
-        return fmt::format(fmt::runtime(format), fmt::join(iterable, separator));
-
-#else
-
-        return fmt::format(format, fmt::join(iterable, separator));
-
-#endif // FMT_VERSION >= 80000
+        std::string result;
+        format_joined(detail::begin(iterable), detail::end(iterable), std::back_inserter(result), separator, format);
+        return result;
     }
 
-#elif defined(LZ_HAS_FORMAT)
+#else
 
     /**
-     * @brief Converts an iterable to a string, using the given separator and format. This overload can be used with C++20's
-     * std::format or {fmt}. Example:
+     * @brief Converts an iterable to a string, using the given separator, using std::stringstream if c++ 20 is not defined or not
+     * using `{fmt}`. Example:
      * ```cpp
      * std::vector<int> vec = { 2, 4 };
-     * std::string output = lz::format(vec, ", ", "{}"); // 2, 4
      * std::string output = lz::format(vec, ","); // 2,4
      * std::string output = lz::format(vec); // 2, 4
      * ```
      *
      * @param iterable Any iterable. May be a container or another iterable.
      * @param separator The separator to use between elements. Default is ", "
-     * @param format The format to use for each element. Default is "{}"
-     * @return The string representation of the iterable, with the given separator and format.
+     * @return The string representation of the iterable, with the given separator.
      */
     template<class Iterable>
-    LZ_NODISCARD std::string operator()(const Iterable& iterable, const char* separator = ", ", const char* format = "{}") const {
-        auto it = iterable.begin();
-        auto end = iterable.end();
-        if (it == end) {
-            return "";
-        }
-
-        std::string result;
-        auto back_inserter = std::back_inserter(result);
-
-        std::vformat_to(back_inserter, format, std::make_format_args(*it));
-        auto sep = std::make_format_args(separator);
+    LZ_NODISCARD std::string operator()(const Iterable& iterable, const char* separator = ", ") const {
+        std::ostringstream oss;
+        (*this)(iterable, oss, separator);
+        return oss.str();
+    }
 
-        for (++it; it != end; ++it) {
-            std::vformat_to(back_inserter, "{}", sep);
-            std::vformat_to(back_inserter, format, std::make_format_args(*it));
-        }
+#endif // !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
+};
 
-        return result;
-    }
+#if !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
 
-#else
+struct iterable_format_to {
+    using adaptor = iterable_format_to;
 
     /**
-     * @brief Converts an iterable to a string, using the given separator, using std::stringstream if c++ 20 is not defined or not
-     * using `{fmt}`. Example:
+     * @brief Formats an iterable to an output iterator, using the given separator and format. Only defined if c++ 20 or if using
+     * `{fmt}`. Formatting to a `fmt::memory_buffer`, a std::string or a contiguous buffer does not go through a stream. The
+     * buffer must be large enough. Example:
      * ```cpp
      * std::vector<int> vec = { 2, 4 };
-     * std::string output = lz::format(vec, ","); // 2,4
-     * std::string output = lz::format(vec); // 2, 4
+     * fmt::memory_buffer buffer;
+     * lz::format_to(vec, std::back_inserter(buffer), ", ", "{:02}"); // buffer contains: 02, 04
+     * char chars[16];
+     * char* end = lz::format_to(vec, chars, ","); // chars contains: 2,4, end = chars + 3
      * ```
      *
      * @param iterable Any iterable. May be a container or another iterable.
+     * @param out The output iterator to write to
      * @param separator The separator to use between elements. Default is ", "
-     * @return The string representation of the iterable, with the given separator.
+     * @param format The format to use for each element. Default is "{}"
+     * @return The output iterator past the last character written
      */
-    template<class Iterable>
-    LZ_NODISCARD std::string operator()(const Iterable& iterable, const char* separator = ", ") const {
-        std::ostringstream oss;
-        (*this)(iterable, oss, separator);
-        return oss.str();
+    template<class Iterable, class OutputIterator>
+    enable_if_t<is_iterable<Iterable>::value, OutputIterator>
+    operator()(const Iterable& iterable, OutputIterator out, const char* separator = ", ", const char* format = "{}") const {
+        return format_joined(detail::begin(iterable), detail::end(iterable), std::move(out), separator, format);
     }
 
-#endif // !defined(LZ_STANDALONE)
+    /**
+     * @brief Function that can be used with the pipe operator. Only defined if c++ 20 or if using `{fmt}`. Example:
+     * ```cpp
+     * std::vector<int> vec = { 2, 4 };
+     * char chars[16];
+     * char* end = vec | lz::format_to(chars, ", ", "{:02}"); // chars contains: 02, 04, end = chars + 6
+     * ```
+     *
+     * @param out The output iterator to write to
+     * @param separator The separator to use between elements. Default is ", "
+     * @param format The format to use for each element. Default is "{}"
+     * @return A function object that can be used with the pipe operator
+     */
+    template<class OutputIterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14
+        enable_if_t<!is_iterable<OutputIterator>::value, fn_args_holder<adaptor, OutputIterator, const char*, const char*>>
+        operator()(OutputIterator out, const char* separator = ", ", const char* format = "{}") const {
+        return { std::move(out), separator, format };
+    }
 };
+
+#endif // !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
+
 } // namespace detail
 } // namespace lz
 
@@ -309,6 +395,7 @@ LZ_MODULE_EXPORT namespace lz {
  * lz::format(vec, std::cout, ", ", "{}"); // prints: 2, 4
  * lz::format(vec, std::cout, ","); // prints: 2,4
  * lz::format(vec, std::cout); // prints: 2, 4
+ * lz::format(vec, stdout, ", ", "{:02}"); // prints: 02, 04
  *
  * std::string output = lz::format(vec, ", ", "{}"); // 2, 4
  * std::string output = lz::format(vec, ","); // 2,4
@@ -336,6 +423,27 @@ LZ_MODULE_EXPORT namespace lz {
  */
 LZ_INLINE_VAR constexpr detail::iterable_formatter format{};
 
+#if !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
+
+/**
+ * @brief Formats any iterable to an output iterator, such as `std::back_inserter` of a `fmt::memory_buffer` or std::string, or
+ * a pointer to a large enough contiguous buffer. Every element is formatted directly to the output, without the overhead of
+ * a stream. Only defined if C++20 or {fmt} is used. If using {fmt}, LZ_STANDALONE must *not* be defined. Example:
+ * ```cpp
+ * std::vector<int> vec = { 2, 4 };
+ * fmt::memory_buffer buffer;
+ * lz::format_to(vec, std::back_inserter(buffer), ", ", "{:02}"); // buffer contains: 02, 04
+ * lz::format_to(vec, std::back_inserter(buffer)); // buffer contains: 02, 042, 4
+ *
+ * char chars[16];
+ * char* end = lz::format_to(vec, chars, ","); // chars contains: 2,4, end = chars + 3
+ * end = vec | lz::format_to(chars, ", ", "{:02}"); // chars contains: 02, 04, end = chars + 6
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::iterable_format_to format_to{};
+
+#endif // !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
+
 } // namespace lz
 
 #ifdef LZ_HAS_CONCEPTS
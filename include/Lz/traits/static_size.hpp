@@ -0,0 +1,61 @@
+#pragma once
+
+#ifndef LZ_TRAITS_STATIC_SIZE_HPP
+#define LZ_TRAITS_STATIC_SIZE_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/traits/static_size.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Gets the size of an iterable that is known at compile time, such as `std::array` and C arrays. Iterables that have the
+ * same size as their input (such as `lz::map`, `lz::enumerate`, `lz::reverse`, `lz::inclusive_scan` and `lz::memoize_map`)
+ * propagate the static size of their input, `lz::zip` has the smallest static size of its inputs and `lz::static_chunks<N>`
+ * has the static size of its input divided by N. Has no `value` member if the size is not known at compile time. Example:
+ * ```cpp
+ * std::array<int, 4> arr = { 1, 2, 3, 4 };
+ * auto mapped = lz::map(arr, [](int i) { return i * 2; });
+ * static_assert(lz::static_size<decltype(mapped)>::value == 4, "Size is known at compile time");
+ * ```
+ */
+using detail::static_size;
+
+/**
+ * @brief Helper to check whether the size of an iterable is known at compile time i.e. whether `lz::static_size` has a
+ * `value` member. Example:
+ * ```cpp
+ * std::array<int, 4> arr = { 1, 2, 3, 4 };
+ * static_assert(lz::has_static_size<decltype(arr)>::value, "Size is known at compile time");
+ *
+ * std::vector<int> vec = { 1, 2, 3, 4 };
+ * static_assert(!lz::has_static_size<decltype(vec)>::value, "Size is not known at compile time");
+ * ```
+ */
+using detail::has_static_size;
+
+#ifdef LZ_HAS_CXX_17
+
+/**
+ * @brief Gets the size of an iterable that is known at compile time. Example:
+ * ```cpp
+ * std::array<int, 4> arr = { 1, 2, 3, 4 };
+ * static_assert(lz::static_size_v<decltype(lz::map(arr, [](int i) { return i * 2; }))> == 4);
+ * ```
+ */
+using detail::static_size_v;
+
+/**
+ * @brief Helper to check whether the size of an iterable is known at compile time. Example:
+ * ```cpp
+ * std::array<int, 4> arr = { 1, 2, 3, 4 };
+ * static_assert(lz::has_static_size_v<decltype(arr)>);
+ * ```
+ */
+using detail::has_static_size_v;
+
+#endif
+
+} // namespace lz
+
+#endif
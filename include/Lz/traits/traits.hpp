@@ -3,6 +3,7 @@
 #include "is_sized.hpp"
 #include "iter_type.hpp"
 #include "lazy_view.hpp"
+#include "static_size.hpp"
 
 #ifdef LZ_HAS_CXX_20
 #include "concepts.hpp"
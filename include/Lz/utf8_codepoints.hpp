@@ -0,0 +1,43 @@
+#pragma once
+
+#ifndef LZ_UTF8_CODEPOINTS_HPP
+#define LZ_UTF8_CODEPOINTS_HPP
+
+#include <Lz/procs/chain.hpp>
+#include <Lz/detail/adaptors/utf8_codepoints.hpp>
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief Decodes a UTF-8 string to its code points (char32_t). Ill formed sequences are decoded as U+FFFD, one for every maximal
+ * ill formed subpart, as recommended by the Unicode standard. ASCII characters take a fast path. Strings with a `data()` and
+ * `size()` member, such as `std::string` and `lz::string_view`, result in an iterable without a sentinel. Null terminated strings
+ * and lz::c_string iterables are decoded without calculating their length first, and result in an iterable whose end() method
+ * returns a default_sentinel_t. The string must outlive the iterable. The result is a forward iterable and does not contain a
+ * .size() method. Use lz::utf8_validate to check whether a string is well formed. Example:
+ * ```cpp
+ * std::string str = "h\xC3\xA9!"; // "h\u00E9!"
+ * auto codepoints = lz::utf8_codepoints(str); // { U'h', U'\u00E9', U'!' }
+ * // or
+ * auto codepoints = str | lz::utf8_codepoints; // { U'h', U'\u00E9', U'!' }
+ * auto codepoints = lz::utf8_codepoints("h\xC3\xA9!"); // { U'h', U'\u00E9', U'!' }, null terminated
+ * auto codepoints = lz::utf8_codepoints("\xC3("); // { U'\uFFFD', U'(' }, ill formed
+ * ```
+ */
+LZ_INLINE_VAR constexpr detail::utf8_codepoints_adaptor utf8_codepoints{};
+
+/**
+ * @brief Utf8 codepoints iterable helper alias.
+ * @tparam End `const char*` for strings with a size, or `lz::default_sentinel_t` for null terminated strings.
+ * ```cpp
+ * std::string str = "h\xC3\xA9!";
+ * lz::utf8_codepoints_iterable<const char*> codepoints = lz::utf8_codepoints(str);
+ * lz::utf8_codepoints_iterable<lz::default_sentinel_t> c_codepoints = lz::utf8_codepoints("h\xC3\xA9!");
+ * ```
+ */
+template<class End>
+using utf8_codepoints_iterable = detail::utf8_codepoints_iterable<End>;
+
+} // namespace lz
+
+#endif // LZ_UTF8_CODEPOINTS_HPP
@@ -0,0 +1,590 @@
+#pragma once
+
+#ifndef LZ_DFA_REGEX_HPP
+#define LZ_DFA_REGEX_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lz {
+namespace detail {
+
+using byte_set = std::bitset<256>;
+
+struct regex_node {
+    enum class kind { set, concat, alternation, repeat };
+
+    kind type{ kind::set };
+    byte_set bytes{};
+    std::vector<size_t> children{};
+    // Only used for repeat, max_count == -1 means unbounded
+    int min_count{};
+    int max_count{};
+};
+
+// Recursive descent parser for the subset of the regex syntax that dfa_regex supports. Produces a tree of regex_nodes, stored in
+// a flat vector
+class regex_parser {
+    static constexpr int max_repetitions = 1000;
+
+    const char* _pos;
+    const char* _end;
+    std::vector<regex_node> _nodes{};
+
+    size_t add(regex_node node) {
+        _nodes.push_back(std::move(node));
+        return _nodes.size() - 1;
+    }
+
+    size_t add_set(const byte_set& bytes) {
+        regex_node node;
+        node.bytes = bytes;
+        return add(std::move(node));
+    }
+
+    static byte_set range(const unsigned char first, const unsigned char last) {
+        byte_set bytes;
+        for (unsigned c = first; c <= last; ++c) {
+            bytes.set(c);
+        }
+        return bytes;
+    }
+
+    static byte_set word_bytes() {
+        auto bytes = range('a', 'z') | range('A', 'Z') | range('0', '9');
+        bytes.set('_');
+        return bytes;
+    }
+
+    static byte_set space_bytes() {
+        byte_set bytes;
+        for (const char c : { ' ', '\t', '\n', '\r', '\f', '\v' }) {
+            bytes.set(static_cast<unsigned char>(c));
+        }
+        return bytes;
+    }
+
+    static byte_set single(const char c) {
+        byte_set bytes;
+        bytes.set(static_cast<unsigned char>(c));
+        return bytes;
+    }
+
+    bool at_end() const noexcept {
+        return _pos == _end;
+    }
+
+    // Parses the character after a backslash
+    byte_set parse_escape() {
+        if (at_end()) {
+            throw std::regex_error(std::regex_constants::error_escape);
+        }
+        const char c = *_pos++;
+        switch (c) {
+        case 'd':
+            return range('0', '9');
+        case 'D':
+            return ~range('0', '9');
+        case 'w':
+            return word_bytes();
+        case 'W':
+            return ~word_bytes();
+        case 's':
+            return space_bytes();
+        case 'S':
+            return ~space_bytes();
+        case 't':
+            return single('\t');
+        case 'n':
+            return single('\n');
+        case 'r':
+            return single('\r');
+        case 'f':
+            return single('\f');
+        case 'v':
+            return single('\v');
+        default:
+            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+                throw std::invalid_argument("dfa_regex does not support this escape sequence");
+            }
+            return single(c);
+        }
+    }
+
+    byte_set parse_class() {
+        const bool negate = !at_end() && *_pos == '^';
+        if (negate) {
+            ++_pos;
+        }
+        byte_set bytes;
+        while (true) {
+            if (at_end()) {
+                throw std::regex_error(std::regex_constants::error_brack);
+            }
+            if (*_pos == ']') {
+                ++_pos;
+                break;
+            }
+            if (*_pos == '\\') {
+                ++_pos;
+                bytes |= parse_escape();
+                continue;
+            }
+            const auto first = static_cast<unsigned char>(*_pos++);
+            if (_end - _pos >= 2 && *_pos == '-' && _pos[1] != ']') {
+                ++_pos;
+                const auto last = static_cast<unsigned char>(*_pos++);
+                if (last < first) {
+                    throw std::regex_error(std::regex_constants::error_range);
+                }
+                bytes |= range(first, last);
+            }
+            else {
+                bytes.set(first);
+            }
+        }
+        return negate ? ~bytes : bytes;
+    }
+
+    int parse_count() {
+        if (at_end() || *_pos < '0' || *_pos > '9') {
+            throw std::regex_error(std::regex_constants::error_badbrace);
+        }
+        int count = 0;
+        for (; !at_end() && *_pos >= '0' && *_pos <= '9'; ++_pos) {
+            count = count * 10 + (*_pos - '0');
+            if (count > max_repetitions) {
+                throw std::regex_error(std::regex_constants::error_complexity);
+            }
+        }
+        return count;
+    }
+
+    size_t parse_atom() {
+        const char c = *_pos++;
+        switch (c) {
+        case '(': {
+            if (_end - _pos >= 2 && _pos[0] == '?' && _pos[1] == ':') {
+                _pos += 2;
+            }
+            const auto inner = parse_alternation();
+            if (at_end() || *_pos != ')') {
+                throw std::regex_error(std::regex_constants::error_paren);
+            }
+            ++_pos;
+            return inner;
+        }
+        case ')':
+            throw std::regex_error(std::regex_constants::error_paren);
+        case '[':
+            return add_set(parse_class());
+        case '.':
+            return add_set(~single('\n'));
+        case '\\':
+            return add_set(parse_escape());
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+            throw std::regex_error(std::regex_constants::error_badrepeat);
+        case '^':
+        case '$':
+            throw std::invalid_argument("dfa_regex does not support anchors");
+        default:
+            return add_set(single(c));
+        }
+    }
+
+    size_t parse_repeat() {
+        auto atom = parse_atom();
+        while (!at_end()) {
+            regex_node node;
+            node.type = regex_node::kind::repeat;
+            switch (*_pos) {
+            case '*':
+                node.min_count = 0, node.max_count = -1;
+                break;
+            case '+':
+                node.min_count = 1, node.max_count = -1;
+                break;
+            case '?':
+                node.min_count = 0, node.max_count = 1;
+                break;
+            case '{':
+                ++_pos;
+                node.min_count = parse_count();
+                node.max_count = node.min_count;
+                if (!at_end() && *_pos == ',') {
+                    ++_pos;
+                    node.max_count = !at_end() && *_pos == '}' ? -1 : parse_count();
+                }
+                if (at_end() || *_pos != '}' || (node.max_count != -1 && node.max_count < node.min_count)) {
+                    throw std::regex_error(std::regex_constants::error_badbrace);
+                }
+                break;
+            default:
+                return atom;
+            }
+            ++_pos;
+            node.children.push_back(atom);
+            atom = add(std::move(node));
+        }
+        return atom;
+    }
+
+    size_t parse_concat() {
+        regex_node node;
+        node.type = regex_node::kind::concat;
+        while (!at_end() && *_pos != '|' && *_pos != ')') {
+            node.children.push_back(parse_repeat());
+        }
+        return add(std::move(node));
+    }
+
+    size_t parse_alternation() {
+        regex_node node;
+        node.type = regex_node::kind::alternation;
+        node.children.push_back(parse_concat());
+        while (!at_end() && *_pos == '|') {
+            ++_pos;
+            node.children.push_back(parse_concat());
+        }
+        return add(std::move(node));
+    }
+
+public:
+    regex_parser(const regex_parser&) = delete;
+    regex_parser& operator=(const regex_parser&) = delete;
+
+    regex_parser(const char* first, const char* last) : _pos{ first }, _end{ last } {
+    }
+
+    /**
+     * @return The nodes of the tree, and the index of its root.
+     */
+    std::pair<std::vector<regex_node>, size_t> parse() {
+        const auto root = parse_alternation();
+        if (!at_end()) {
+            throw std::regex_error(std::regex_constants::error_paren);
+        }
+        return { std::move(_nodes), root };
+    }
+};
+
+// Thompson construction of a nondeterministic automaton from a regex tree
+class regex_nfa {
+public:
+    struct state {
+        byte_set bytes{};
+        // The state after consuming a byte in bytes, or -1
+        int target{ -1 };
+        std::vector<int> epsilon{};
+    };
+
+private:
+    struct fragment {
+        int start;
+        int accept;
+    };
+
+    const std::vector<regex_node>& _nodes;
+    std::vector<state> _states{};
+
+    int add_state() {
+        _states.emplace_back();
+        return static_cast<int>(_states.size() - 1);
+    }
+
+    void link(const int from, const int to) {
+        _states[static_cast<size_t>(from)].epsilon.push_back(to);
+    }
+
+    fragment build_concat(const std::vector<size_t>& children, const size_t count) {
+        if (count == 0) {
+            const auto s = add_state();
+            return { s, s };
+        }
+        auto result = build(children[0]);
+        for (size_t i = 1; i < count; ++i) {
+            const auto next = build(children[i]);
+            link(result.accept, next.start);
+            result.accept = next.accept;
+        }
+        return result;
+    }
+
+    fragment build_repeat(const regex_node& node) {
+        const std::vector<size_t> copies(static_cast<size_t>(node.min_count), node.children.front());
+        auto result = build_concat(copies, copies.size());
+        if (node.max_count == -1) {
+            const auto loop = build(node.children.front());
+            const auto accept = add_state();
+            link(result.accept, loop.start);
+            link(result.accept, accept);
+            link(loop.accept, loop.start);
+            link(loop.accept, accept);
+            result.accept = accept;
+            return result;
+        }
+        // Nested optional copies: (x(x(x)?)?)?
+        const auto accept = add_state();
+        for (int i = node.min_count; i < node.max_count; ++i) {
+            const auto optional = build(node.children.front());
+            link(result.accept, optional.start);
+            link(result.accept, accept);
+            result.accept = optional.accept;
+        }
+        link(result.accept, accept);
+        result.accept = accept;
+        return result;
+    }
+
+    fragment build(const size_t index) {
+        const auto& node = _nodes[index];
+        switch (node.type) {
+        case regex_node::kind::set: {
+            const auto start = add_state();
+            const auto accept = add_state();
+            _states[static_cast<size_t>(start)].bytes = node.bytes;
+            _states[static_cast<size_t>(start)].target = accept;
+            return { start, accept };
+        }
+        case regex_node::kind::concat:
+            return build_concat(node.children, node.children.size());
+        case regex_node::kind::alternation: {
+            const auto start = add_state();
+            const auto accept = add_state();
+            for (const auto child : node.children) {
+                const auto alternative = build(child);
+                link(start, alternative.start);
+                link(alternative.accept, accept);
+            }
+            return { start, accept };
+        }
+        default:
+            return build_repeat(node);
+        }
+    }
+
+public:
+    int start_state{};
+    int accept_state{};
+
+    regex_nfa(const std::vector<regex_node>& nodes, const size_t root) : _nodes{ nodes } {
+        const auto result = build(root);
+        start_state = result.start;
+        accept_state = result.accept;
+    }
+
+    const std::vector<state>& states() const noexcept {
+        return _states;
+    }
+};
+
+} // namespace detail
+} // namespace lz
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief A regex that is compiled into a deterministic finite automaton, for the common subset of the regex syntax: literals,
+ * `.`, character classes (`[a-z_]`, `[^,;]`, `\d`, `\w`, `\s` and their negations), groups (`(...)` and `(?:...)`), alternation
+ * (`|`) and repetition (`*`, `+`, `?`, `{n}`, `{n,}` and `{n,m}`). Anchors, back references and lookarounds are not supported.
+ * Patterns that can match the empty string are not allowed either. Matching never backtracks and never allocates: every
+ * attempt is a single table lookup per character. Matches are leftmost-longest (POSIX), so `a|ab` matches `ab` rather than `a`.
+ * Can be used as matcher for `lz::regex_split`. Only supports `char` strings, which are matched byte by byte. Example:
+ * ```cpp
+ * lz::dfa_regex regex(R"(\s*[,;]\s*)");
+ * std::string s = "a, b ;c";
+ * auto splitter = lz::regex_split(s, regex); // { "a", "b", "c" }
+ * ```
+ * @throw std::regex_error if the pattern is not a valid regex or if it's too complex.
+ * @throw std::invalid_argument if the pattern uses unsupported syntax or if it can match the empty string.
+ */
+class dfa_regex {
+    static constexpr size_t max_states = 10000;
+
+    // Maps every byte to its equivalence class: bytes in the same class have the same transitions in every state
+    unsigned char _classes[256]{};
+    size_t _class_count{};
+    // _transitions[state * _class_count + class] is the next state, or -1 if no match is possible anymore
+    std::vector<int> _transitions{};
+    std::vector<char> _accepting{};
+    detail::byte_set _can_start{};
+
+    void compute_classes(const std::vector<detail::regex_nfa::state>& states) {
+        std::map<std::vector<bool>, unsigned char> signatures;
+        for (unsigned byte = 0; byte < 256; ++byte) {
+            std::vector<bool> signature;
+            signature.reserve(states.size());
+            for (const auto& state : states) {
+                signature.push_back(state.target != -1 && state.bytes.test(byte));
+            }
+            const auto it = signatures.insert({ std::move(signature), static_cast<unsigned char>(signatures.size()) }).first;
+            _classes[byte] = it->second;
+        }
+        _class_count = signatures.size();
+    }
+
+    static void close(const std::vector<detail::regex_nfa::state>& states, std::vector<int>& set) {
+        std::vector<char> seen(states.size());
+        std::vector<int> stack(set);
+        set.clear();
+        while (!stack.empty()) {
+            const auto s = stack.back();
+            stack.pop_back();
+            if (seen[static_cast<size_t>(s)]) {
+                continue;
+            }
+            seen[static_cast<size_t>(s)] = 1;
+            set.push_back(s);
+            for (const auto next : states[static_cast<size_t>(s)].epsilon) {
+                stack.push_back(next);
+            }
+        }
+        std::sort(set.begin(), set.end());
+    }
+
+    // Subset construction
+    void compile(const char* first, const char* last) {
+        auto tree = detail::regex_parser(first, last).parse();
+        const detail::regex_nfa nfa(tree.first, tree.second);
+        const auto& states = nfa.states();
+        compute_classes(states);
+
+        std::vector<unsigned char> representatives(_class_count);
+        for (unsigned byte = 256; byte-- > 0;) {
+            representatives[_classes[byte]] = static_cast<unsigned char>(byte);
+        }
+
+        std::map<std::vector<int>, int> ids;
+        std::vector<std::vector<int>> sets;
+        auto id_of = [&](std::vector<int> set) {
+            const auto it = ids.find(set);
+            if (it != ids.end()) {
+                return it->second;
+            }
+            if (sets.size() == max_states) {
+                throw std::regex_error(std::regex_constants::error_complexity);
+            }
+            const auto id = static_cast<int>(sets.size());
+            _accepting.push_back(std::binary_search(set.begin(), set.end(), nfa.accept_state) ? 1 : 0);
+            ids.emplace(set, id);
+            sets.push_back(std::move(set));
+            return id;
+        };
+
+        std::vector<int> start{ nfa.start_state };
+        close(states, start);
+        id_of(std::move(start));
+        if (_accepting.front()) {
+            throw std::invalid_argument("dfa_regex patterns must not match the empty string");
+        }
+
+        for (size_t current = 0; current < sets.size(); ++current) {
+            _transitions.resize(sets.size() * _class_count, -1);
+            for (size_t cls = 0; cls < _class_count; ++cls) {
+                std::vector<int> next;
+                for (const auto s : sets[current]) {
+                    const auto& state = states[static_cast<size_t>(s)];
+                    if (state.target != -1 && state.bytes.test(representatives[cls])) {
+                        next.push_back(state.target);
+                    }
+                }
+                if (next.empty()) {
+                    continue;
+                }
+                close(states, next);
+                const auto id = id_of(std::move(next));
+                _transitions[current * _class_count + cls] = id;
+            }
+        }
+        _transitions.resize(sets.size() * _class_count, -1);
+
+        for (unsigned byte = 0; byte < 256; ++byte) {
+            _can_start.set(byte, _transitions[_classes[byte]] != -1);
+        }
+    }
+
+public:
+    using char_type = char;
+
+    /**
+     * @brief Compiles @p pattern.
+     */
+    explicit dfa_regex(const std::string& pattern) {
+        compile(pattern.data(), pattern.data() + pattern.size());
+    }
+
+    /**
+     * @brief Compiles the null terminated @p pattern.
+     */
+    explicit dfa_regex(const char* pattern) {
+        compile(pattern, pattern + std::strlen(pattern));
+    }
+
+    /**
+     * @brief Compiles the pattern [@p pattern, @p pattern + @p length).
+     */
+    dfa_regex(const char* pattern, const size_t length) {
+        compile(pattern, pattern + length);
+    }
+
+    /**
+     * @brief Finds the leftmost-longest match in [@p first, @p last).
+     * @return The match, or {last, last} if there is no match. Matches are never empty.
+     */
+    std::pair<const char*, const char*> find(const char* first, const char* last) const noexcept {
+        for (; first != last; ++first) {
+            if (!_can_start.test(static_cast<unsigned char>(*first))) {
+                continue;
+            }
+            const char* match_end = nullptr;
+            int state = 0;
+            for (const char* it = first; it != last; ++it) {
+                state = _transitions[static_cast<size_t>(state) * _class_count + _classes[static_cast<unsigned char>(*it)]];
+                if (state == -1) {
+                    break;
+                }
+                if (_accepting[static_cast<size_t>(state)]) {
+                    match_end = it + 1;
+                }
+            }
+            if (match_end != nullptr) {
+                return { first, match_end };
+            }
+        }
+        return { last, last };
+    }
+
+    /**
+     * @return true if all of [@p first, @p last) matches the regex.
+     */
+    LZ_NODISCARD bool matches(const char* first, const char* last) const noexcept {
+        int state = 0;
+        for (; first != last && state != -1; ++first) {
+            state = _transitions[static_cast<size_t>(state) * _class_count + _classes[static_cast<unsigned char>(*first)]];
+        }
+        return state != -1 && _accepting[static_cast<size_t>(state)];
+    }
+
+    /**
+     * @return The amount of states of the automaton.
+     */
+    LZ_NODISCARD size_t state_count() const noexcept {
+        return _accepting.size();
+    }
+};
+
+} // namespace lz
+
+#endif // LZ_DFA_REGEX_HPP
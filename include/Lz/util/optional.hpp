@@ -156,6 +156,13 @@ public:
         return *this;
     }
 
+    LZ_CONSTEXPR_CXX_14 void reset() noexcept {
+        if (_has_value) {
+            _value.~T();
+            _has_value = false;
+        }
+    }
+
     LZ_NODISCARD constexpr bool has_value() const noexcept {
         return _has_value;
     }
@@ -0,0 +1,483 @@
+#pragma once
+
+#ifndef LZ_RANDOM_ENGINES_HPP
+#define LZ_RANDOM_ENGINES_HPP
+
+#include <Lz/detail/compiler_config.hpp>
+#include <Lz/detail/traits/enable_if.hpp>
+#include <Lz/detail/traits/remove_ref.hpp>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace lz {
+namespace detail {
+
+constexpr std::uint64_t rotl64(const std::uint64_t x, const unsigned k) noexcept {
+    return (x << k) | (x >> ((64u - k) & 63u));
+}
+
+constexpr std::uint64_t rotr64(const std::uint64_t x, const unsigned k) noexcept {
+    return (x >> k) | (x << ((64u - k) & 63u));
+}
+
+// Advances @p state and returns the next output of splitmix64, used to expand a single seed into a full engine state
+inline std::uint64_t splitmix64(std::uint64_t& state) noexcept {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27u)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31u);
+}
+
+// Returns the high 64 bits of the 128 bit product of a and b, the low 64 bits are simply a * b
+inline std::uint64_t mul_hi64(const std::uint64_t a, const std::uint64_t b) noexcept {
+#ifdef __SIZEOF_INT128__
+    __extension__ using uint128 = unsigned __int128;
+    return static_cast<std::uint64_t>((static_cast<uint128>(a) * b) >> 64u);
+#else
+    const std::uint64_t a_lo = a & 0xFFFFFFFFull, a_hi = a >> 32u;
+    const std::uint64_t b_lo = b & 0xFFFFFFFFull, b_hi = b >> 32u;
+    const std::uint64_t lo_lo = a_lo * b_lo;
+    const std::uint64_t hi_lo = a_hi * b_lo;
+    const std::uint64_t cross = (lo_lo >> 32u) + (hi_lo & 0xFFFFFFFFull) + a_lo * b_hi;
+    return (hi_lo >> 32u) + (cross >> 32u) + a_hi * b_hi;
+#endif
+}
+
+struct uint128_parts {
+    std::uint64_t hi;
+    std::uint64_t lo;
+};
+
+inline uint128_parts mul128(const uint128_parts a, const uint128_parts b) noexcept {
+    return { mul_hi64(a.lo, b.lo) + a.hi * b.lo + a.lo * b.hi, a.lo * b.lo };
+}
+
+inline uint128_parts add128(const uint128_parts a, const uint128_parts b) noexcept {
+    const std::uint64_t lo = a.lo + b.lo;
+    return { a.hi + b.hi + (lo < a.lo ? 1u : 0u), lo };
+}
+
+template<class SeedSeq, class Engine>
+using enable_if_seed_seq = enable_if_t<!std::is_convertible<SeedSeq, std::uint64_t>::value &&
+                                       !std::is_same<remove_cvref_t<SeedSeq>, Engine>::value>;
+
+// Draws a 64 bit seed from a seed sequence (such as std::seed_seq)
+template<class SeedSeq>
+std::uint64_t seed_from_seq(SeedSeq& seq) {
+    std::uint32_t words[2];
+    seq.generate(words, words + 2);
+    return (static_cast<std::uint64_t>(words[1]) << 32u) | words[0];
+}
+
+} // namespace detail
+} // namespace lz
+
+LZ_MODULE_EXPORT namespace lz {
+
+/**
+ * @brief The xoshiro256** engine by Blackman and Vigna: a small (32 bytes) and very fast engine with 64 bit output and a period
+ * of 2^256 - 1. Meets the UniformRandomBitGenerator requirements, so it can be used with the distributions of <random> and with
+ * `lz::random`. The state is initialized from a single seed using splitmix64. Example:
+ * ```cpp
+ * lz::xoshiro256ss engine(42);
+ * std::uniform_real_distribution<double> dist(0., 1.);
+ * auto random = lz::random(dist, engine, 1000) | lz::to<std::vector>(); // Generated in a tight loop, see lz::random
+ * ```
+ */
+class xoshiro256ss {
+    std::uint64_t _state[4];
+
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr result_type default_seed = 0x853C49E6748FEA9Bull;
+
+    explicit xoshiro256ss(const result_type value = default_seed) noexcept {
+        seed(value);
+    }
+
+    template<class SeedSeq, class = detail::enable_if_seed_seq<SeedSeq, xoshiro256ss>>
+    explicit xoshiro256ss(SeedSeq& seq) {
+        seed(seq);
+    }
+
+    void seed(result_type value = default_seed) noexcept {
+        for (auto& word : _state) {
+            word = detail::splitmix64(value);
+        }
+    }
+
+    template<class SeedSeq, class = detail::enable_if_seed_seq<SeedSeq, xoshiro256ss>>
+    void seed(SeedSeq& seq) {
+        seed(detail::seed_from_seq(seq));
+    }
+
+    static constexpr result_type(min)() noexcept {
+        return 0;
+    }
+
+    static constexpr result_type(max)() noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()() noexcept {
+        const result_type result = detail::rotl64(_state[1] * 5, 7) * 9;
+        const result_type t = _state[1] << 17u;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = detail::rotl64(_state[3], 45);
+        return result;
+    }
+
+    /**
+     * Fills [first, last) with the next outputs of the engine. Equivalent to calling operator() for every element, but keeps the
+     * state in registers for the whole block.
+     */
+    template<class Iterator>
+    void generate(Iterator first, Iterator last) noexcept {
+        std::uint64_t s0 = _state[0], s1 = _state[1], s2 = _state[2], s3 = _state[3];
+        for (; first != last; ++first) {
+            *first = static_cast<detail::remove_cvref_t<decltype(*first)>>(detail::rotl64(s1 * 5, 7) * 9);
+            const std::uint64_t t = s1 << 17u;
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            s3 = detail::rotl64(s3, 45);
+        }
+        _state[0] = s0, _state[1] = s1, _state[2] = s2, _state[3] = s3;
+    }
+
+    void discard(unsigned long long n) noexcept {
+        for (; n != 0; --n) {
+            (*this)();
+        }
+    }
+
+    /**
+     * Advances the engine by 2^128 steps. Can be used to create up to 2^128 non overlapping sequences, for instance one per
+     * thread.
+     */
+    void jump() noexcept {
+        static constexpr std::uint64_t polynomial[] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull,
+                                                        0x39ABDC4529B1661Cull };
+        std::uint64_t s[4] = { 0, 0, 0, 0 };
+        for (const auto word : polynomial) {
+            for (unsigned bit = 0; bit < 64; ++bit) {
+                if (word & (std::uint64_t{ 1 } << bit)) {
+                    for (int i = 0; i < 4; ++i) {
+                        s[i] ^= _state[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        for (int i = 0; i < 4; ++i) {
+            _state[i] = s[i];
+        }
+    }
+
+    friend bool operator==(const xoshiro256ss& lhs, const xoshiro256ss& rhs) noexcept {
+        return lhs._state[0] == rhs._state[0] && lhs._state[1] == rhs._state[1] && lhs._state[2] == rhs._state[2] &&
+               lhs._state[3] == rhs._state[3];
+    }
+
+    friend bool operator!=(const xoshiro256ss& lhs, const xoshiro256ss& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+};
+
+/**
+ * @brief The PCG64 engine (PCG XSL RR 128/64) by O'Neill: a 128 bit linear congruential generator with a permuted 64 bit output
+ * and a period of 2^128. Besides a seed, a stream can be selected, which gives 2^127 distinct sequences. Can be advanced by
+ * any amount of steps in O(log n) using `discard`. Meets the UniformRandomBitGenerator requirements. Example:
+ * ```cpp
+ * lz::pcg64 engine(42, 7); // seed 42, stream 7
+ * std::uniform_int_distribution<int> dist(0, 10);
+ * auto random = lz::random(dist, engine, 1000);
+ * ```
+ */
+class pcg64 {
+    detail::uint128_parts _state;
+    detail::uint128_parts _increment;
+
+    static constexpr detail::uint128_parts multiplier() noexcept {
+        return { 0x2360ED051FC65DA4ull, 0x4385DF649FCCF645ull };
+    }
+
+    void step() noexcept {
+        _state = detail::add128(detail::mul128(_state, multiplier()), _increment);
+    }
+
+    static std::uint64_t output(const detail::uint128_parts state) noexcept {
+        return detail::rotr64(state.hi ^ state.lo, static_cast<unsigned>(state.hi >> 58u));
+    }
+
+    void init(const std::uint64_t value) noexcept {
+        _state = { 0, value };
+        _state = detail::add128(_state, _increment);
+        step();
+    }
+
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr result_type default_seed = 0xCAFEF00DD15EA5E5ull;
+
+    explicit pcg64(const result_type value = default_seed) noexcept :
+        _state{ 0, 0 },
+        _increment{ 0x5851F42D4C957F2Dull, 0x14057B7EF767814Full } {
+        init(value);
+    }
+
+    pcg64(const result_type value, const result_type stream) noexcept :
+        _state{ 0, 0 },
+        _increment{ stream >> 63u, (stream << 1u) | 1u } {
+        init(value);
+    }
+
+    template<class SeedSeq, class = detail::enable_if_seed_seq<SeedSeq, pcg64>>
+    explicit pcg64(SeedSeq& seq) : pcg64{} {
+        seed(seq);
+    }
+
+    void seed(const result_type value = default_seed) noexcept {
+        init(value);
+    }
+
+    template<class SeedSeq, class = detail::enable_if_seed_seq<SeedSeq, pcg64>>
+    void seed(SeedSeq& seq) {
+        init(detail::seed_from_seq(seq));
+    }
+
+    static constexpr result_type(min)() noexcept {
+        return 0;
+    }
+
+    static constexpr result_type(max)() noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()() noexcept {
+        step();
+        return output(_state);
+    }
+
+    /**
+     * Fills [first, last) with the next outputs of the engine. Equivalent to calling operator() for every element.
+     */
+    template<class Iterator>
+    void generate(Iterator first, Iterator last) noexcept {
+        auto state = _state;
+        for (; first != last; ++first) {
+            state = detail::add128(detail::mul128(state, multiplier()), _increment);
+            *first = static_cast<detail::remove_cvref_t<decltype(*first)>>(output(state));
+        }
+        _state = state;
+    }
+
+    /**
+     * Advances the engine by @p n steps in O(log n).
+     */
+    void discard(unsigned long long n) noexcept {
+        detail::uint128_parts current_multiplier = multiplier();
+        detail::uint128_parts current_increment = _increment;
+        detail::uint128_parts total_multiplier{ 0, 1 };
+        detail::uint128_parts total_increment{ 0, 0 };
+        for (; n != 0; n >>= 1u) {
+            if (n & 1u) {
+                total_multiplier = detail::mul128(total_multiplier, current_multiplier);
+                total_increment = detail::add128(detail::mul128(total_increment, current_multiplier), current_increment);
+            }
+            current_increment = detail::mul128(detail::add128(current_multiplier, { 0, 1 }), current_increment);
+            current_multiplier = detail::mul128(current_multiplier, current_multiplier);
+        }
+        _state = detail::add128(detail::mul128(total_multiplier, _state), total_increment);
+    }
+
+    friend bool operator==(const pcg64& lhs, const pcg64& rhs) noexcept {
+        return lhs._state.hi == rhs._state.hi && lhs._state.lo == rhs._state.lo && lhs._increment.hi == rhs._increment.hi &&
+               lhs._increment.lo == rhs._increment.lo;
+    }
+
+    friend bool operator!=(const pcg64& lhs, const pcg64& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+};
+
+/**
+ * @brief The Philox4x32-10 engine by Salmon et al.: a counter based engine, which computes every block of four 32 bit outputs
+ * from a 64 bit key and a 128 bit counter only. Blocks are independent of each other, so the engine can be advanced by any
+ * amount in O(1) and a block can be computed directly using `philox4x32::block`. Meets the UniformRandomBitGenerator
+ * requirements. Example:
+ * ```cpp
+ * lz::philox4x32 engine(42);
+ * engine.discard(1000000); // O(1)
+ * std::uniform_real_distribution<float> dist(0.f, 1.f);
+ * auto random = lz::random(dist, engine, 1000);
+ * ```
+ */
+class philox4x32 {
+public:
+    using result_type = std::uint32_t;
+    using key_type = std::uint64_t;
+
+    /**
+     * The four outputs of a single counter.
+     */
+    struct block_type {
+        result_type words[4];
+    };
+
+private:
+    key_type _key;
+    // The counter of the block that is currently buffered
+    std::uint64_t _counter_lo{};
+    std::uint64_t _counter_hi{};
+    block_type _buffer{};
+    // Index of the next output in _buffer, 4 if the buffer must be refilled first
+    unsigned _index{ 4 };
+
+    void refill() noexcept {
+        _buffer = block(_key, _counter_lo, _counter_hi);
+        if (++_counter_lo == 0) {
+            ++_counter_hi;
+        }
+        _index = 0;
+    }
+
+public:
+    static constexpr key_type default_seed = 20111115ull;
+
+    explicit philox4x32(const key_type key = default_seed) noexcept : _key{ key } {
+    }
+
+    /**
+     * Creates an engine whose first outputs are the block of @p key at counter (@p counter_hi, @p counter_lo).
+     */
+    philox4x32(const key_type key, const std::uint64_t counter_lo, const std::uint64_t counter_hi) noexcept :
+        _key{ key },
+        _counter_lo{ counter_lo },
+        _counter_hi{ counter_hi } {
+    }
+
+    template<class SeedSeq, class = detail::enable_if_seed_seq<SeedSeq, philox4x32>>
+    explicit philox4x32(SeedSeq& seq) : _key{ detail::seed_from_seq(seq) } {
+    }
+
+    void seed(const key_type key = default_seed) noexcept {
+        *this = philox4x32{ key };
+    }
+
+    template<class SeedSeq, class = detail::enable_if_seed_seq<SeedSeq, philox4x32>>
+    void seed(SeedSeq& seq) {
+        *this = philox4x32{ detail::seed_from_seq(seq) };
+    }
+
+    /**
+     * Computes the four outputs of @p key at counter (@p counter_hi, @p counter_lo), without any state.
+     */
+    static block_type block(const key_type key, const std::uint64_t counter_lo, const std::uint64_t counter_hi = 0) noexcept {
+        std::uint32_t k0 = static_cast<std::uint32_t>(key), k1 = static_cast<std::uint32_t>(key >> 32u);
+        std::uint32_t c0 = static_cast<std::uint32_t>(counter_lo), c1 = static_cast<std::uint32_t>(counter_lo >> 32u);
+        std::uint32_t c2 = static_cast<std::uint32_t>(counter_hi), c3 = static_cast<std::uint32_t>(counter_hi >> 32u);
+        for (int round = 0; round < 10; ++round) {
+            const std::uint64_t p0 = std::uint64_t{ 0xD2511F53u } * c0;
+            const std::uint64_t p1 = std::uint64_t{ 0xCD9E8D57u } * c2;
+            const auto hi0 = static_cast<std::uint32_t>(p0 >> 32u), lo0 = static_cast<std::uint32_t>(p0);
+            const auto hi1 = static_cast<std::uint32_t>(p1 >> 32u), lo1 = static_cast<std::uint32_t>(p1);
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        return { { c0, c1, c2, c3 } };
+    }
+
+    static constexpr result_type(min)() noexcept {
+        return 0;
+    }
+
+    static constexpr result_type(max)() noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    result_type operator()() noexcept {
+        if (_index == 4) {
+            refill();
+        }
+        return _buffer.words[_index++];
+    }
+
+    /**
+     * Fills [first, last) with the next outputs of the engine. Equivalent to calling operator() for every element, but computes
+     * whole blocks at once, which are independent of each other.
+     */
+    template<class Iterator>
+    void generate(Iterator first, Iterator last) {
+        using value_type = detail::remove_cvref_t<decltype(*first)>;
+        for (; _index != 4 && first != last; ++first) {
+            *first = static_cast<value_type>(_buffer.words[_index++]);
+        }
+        while (first != last) {
+            refill();
+            for (; _index != 4 && first != last; ++first) {
+                *first = static_cast<value_type>(_buffer.words[_index++]);
+            }
+        }
+    }
+
+    /**
+     * Advances the engine by @p n outputs in O(1).
+     */
+    void discard(unsigned long long n) noexcept {
+        const unsigned long long buffered = 4 - _index;
+        if (n <= buffered) {
+            _index += static_cast<unsigned>(n);
+            return;
+        }
+        n -= buffered;
+        const auto blocks = static_cast<std::uint64_t>((n - 1) / 4);
+        const std::uint64_t lo = _counter_lo + blocks;
+        _counter_hi += lo < _counter_lo ? 1u : 0u;
+        _counter_lo = lo;
+        refill();
+        _index = static_cast<unsigned>((n - 1) % 4 + 1);
+    }
+
+    /**
+     * @return The key of the engine.
+     */
+    LZ_NODISCARD key_type key() const noexcept {
+        return _key;
+    }
+
+    friend bool operator==(const philox4x32& lhs, const philox4x32& rhs) noexcept {
+        // Engines are equal if they produce the same outputs from now on, regardless of what is buffered
+        const auto lhs_position = lhs.position(), rhs_position = rhs.position();
+        return lhs._key == rhs._key && lhs_position.hi == rhs_position.hi && lhs_position.lo == rhs_position.lo;
+    }
+
+    friend bool operator!=(const philox4x32& lhs, const philox4x32& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+private:
+    // The index of the next output in the sequence of all outputs (modulo 2^128)
+    detail::uint128_parts position() const noexcept {
+        const detail::uint128_parts next_block{ _counter_hi << 2u | _counter_lo >> 62u, _counter_lo << 2u };
+        const std::uint64_t buffered = 4 - _index;
+        return { next_block.hi - (next_block.lo < buffered ? 1u : 0u), next_block.lo - buffered };
+    }
+};
+
+} // namespace lz
+
+#endif // LZ_RANDOM_ENGINES_HPP
@@ -3,5 +3,7 @@
 #include "string_view.hpp"
 #include "default_sentinel.hpp"
 #include "optional.hpp"
+#include "dfa_regex.hpp"
+#include "random_engines.hpp"
 #include "default_sentinel.hpp"
 
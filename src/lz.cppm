@@ -1,26 +1,48 @@
 module;
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <coroutine>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
 #include <format>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <map>
+#include <mutex>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <ostream>
 #include <random>
 #include <regex>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 // clang-format off
 
 #ifndef LZ_STANDALONE
+  #include <fmt/compile.h>
   #include <fmt/format.h>
   #include <fmt/ostream.h>
 #endif
@@ -38,12 +60,16 @@ export module lz;
 #include "Lz/algorithm/algorithm.hpp"
 #include "Lz/any_iterable.hpp"
 #include "Lz/c_string.hpp"
+#include "Lz/cached_begin.hpp"
 #include "Lz/cached_size.hpp"
 #include "Lz/cartesian_product.hpp"
+#include "Lz/channel.hpp"
 #include "Lz/chunk_if.hpp"
 #include "Lz/chunks.hpp"
 #include "Lz/common.hpp"
 #include "Lz/concatenate.hpp"
+#include "Lz/concatenate_dynamic.hpp"
+#include "Lz/csv.hpp"
 #include "Lz/drop.hpp"
 #include "Lz/drop_while.hpp"
 #include "Lz/enumerate.hpp"
@@ -54,15 +80,23 @@ export module lz;
 #include "Lz/flatten.hpp"
 #include "Lz/generate.hpp"
 #include "Lz/generate_while.hpp"
+#include "Lz/generator.hpp"
 #include "Lz/group_by.hpp"
+#include "Lz/group_by_hashed.hpp"
 #include "Lz/inclusive_scan.hpp"
+#include "Lz/indexed_flatten.hpp"
 #include "Lz/interleave.hpp"
 #include "Lz/intersection.hpp"
 #include "Lz/iter_tools.hpp"
+#include "Lz/join_to_string.hpp"
 #include "Lz/join_where.hpp"
 #include "Lz/loop.hpp"
 #include "Lz/map.hpp"
+#include "Lz/memoize_map.hpp"
 #include "Lz/pairwise.hpp"
+#include "Lz/parallel_map.hpp"
+#include "Lz/parse.hpp"
+#include "Lz/prefetch_async.hpp"
 #include "Lz/procs/procs.hpp"
 #include "Lz/random.hpp"
 #include "Lz/range.hpp"
@@ -70,6 +104,8 @@ export module lz;
 #include "Lz/repeat.hpp"
 #include "Lz/reverse.hpp"
 #include "Lz/rotate.hpp"
+#include "Lz/sample.hpp"
+#include "Lz/shuffled.hpp"
 #include "Lz/slice.hpp"
 #include "Lz/split.hpp"
 #include "Lz/stream.hpp"
@@ -78,5 +114,6 @@ export module lz;
 #include "Lz/take_while.hpp"
 #include "Lz/traits/traits.hpp"
 #include "Lz/unique.hpp"
+#include "Lz/utf8_codepoints.hpp"
 #include "Lz/util/util.hpp"
 #include "Lz/zip_longest.hpp"
@@ -1,10 +1,12 @@
 #include <Lz/algorithm/algorithm.hpp>
 #include <Lz/c_string.hpp>
+#include <Lz/filter.hpp>
 #include <Lz/map.hpp>
 #include <Lz/procs/to.hpp>
 #include <Lz/range.hpp>
 #include <Lz/repeat.hpp>
 #include <Lz/stream.hpp>
+#include <Lz/util/string_view.hpp>
 #include <cpp-lazy-ut-helper/pch.hpp>
 #include <cpp-lazy-ut-helper/ut_helper.hpp>
 #include <doctest/doctest.h>
@@ -116,6 +118,46 @@ TEST_CASE("Formatting") {
         REQUIRE(lz::format(arr, ", ", "{:02}") == "01");
     }
 
+    SUBCASE("format_to fmt") {
+        std::array<int, 3> arr = { 1, 2, 3 };
+
+        fmt::memory_buffer buffer;
+        lz::format_to(arr, std::back_inserter(buffer), ", ", "{:02}");
+        REQUIRE(fmt::to_string(buffer) == "01, 02, 03");
+
+        std::string str = "numbers: ";
+        lz::format_to(arr, std::back_inserter(str));
+        REQUIRE(str == "numbers: 1, 2, 3");
+
+        char chars[16];
+        char* end = lz::format_to(arr, chars, ",");
+        REQUIRE(lz::string_view(chars, static_cast<std::size_t>(end - chars)) == "1,2,3");
+        end = arr | lz::format_to(chars, "", "[{}]");
+        REQUIRE(lz::string_view(chars, static_cast<std::size_t>(end - chars)) == "[1][2][3]");
+
+        std::array<int, 0> empty = {};
+        REQUIRE(lz::format_to(empty, chars) == chars);
+    }
+
+    SUBCASE("Sentinels and temporaries fmt") {
+        auto mapped = lz::c_string("abc") | lz::map([](char c) { return std::string(2, c); });
+        REQUIRE(lz::format(mapped, "-") == "aa-bb-cc");
+        REQUIRE(lz::format(mapped, " ", "<{}>") == "<aa> <bb> <cc>");
+    }
+
+    SUBCASE("File fmt") {
+        std::array<int, 3> arr = { 1, 2, 3 };
+        std::FILE* file = std::tmpfile();
+        REQUIRE(file != nullptr);
+        lz::format(arr, file, ", ", "{:02}");
+        arr | lz::format(file, ";");
+        std::rewind(file);
+        char chars[32] = {};
+        const auto read = std::fread(chars, 1, sizeof chars, file);
+        std::fclose(file);
+        REQUIRE(lz::string_view(chars, read) == "01, 02, 031;2;3");
+    }
+
     SUBCASE("Non empty ostream") {
         std::array<int, 5> arr = { 1, 2, 3, 4, 5 };
         lz::basic_iterable<std::array<int, 5>::iterator> iterable(arr);
@@ -328,6 +370,41 @@ TEST_CASE("To container") {
         REQUIRE(lz::equal(vec, c_str));
     }
 
+    SUBCASE("To vector sized non random access") {
+        std::list<int> lst = { 1, 2, 3, 4, 5 };
+        auto mapped = lz::map(lst, [](int i) { return i * 2; });
+        static_assert(lz::detail::is_bulk_writable<decltype(mapped), std::vector<int>>::value, "Should write in place");
+        auto vec = mapped | lz::to<std::vector>();
+        REQUIRE(vec == std::vector<int>{ 2, 4, 6, 8, 10 });
+        vec = lz::to<std::vector<int>>(mapped, std::allocator<int>{});
+        REQUIRE(vec == std::vector<int>{ 2, 4, 6, 8, 10 });
+
+        auto strings = lz::map(lst, [](int i) { return std::to_string(i); });
+        static_assert(!lz::detail::is_bulk_writable<decltype(strings), std::vector<std::string>>::value,
+                      "Non trivial types should use push_back");
+        std::vector<std::string> expected = { "1", "2", "3", "4", "5" };
+        REQUIRE(lz::to<std::vector<std::string>>(strings) == expected);
+    }
+
+    SUBCASE("To vector unsized") {
+        std::list<int> lst = { 1, 2, 3, 4, 5 };
+        auto filtered = lz::filter(lst, [](int i) { return i % 2 == 1; });
+        static_assert(!lz::detail::is_bulk_writable<decltype(filtered), std::vector<int>>::value, "Should not be sized");
+        REQUIRE((filtered | lz::to<std::vector>()) == std::vector<int>{ 1, 3, 5 });
+    }
+
+#ifdef LZ_HAS_CXX_17
+
+    SUBCASE("To string sized non random access") {
+        std::list<char> lst = { 'a', 'b', 'c' };
+        auto upper = lz::map(lst, [](char c) { return static_cast<char>(c - 'a' + 'A'); });
+        static_assert(lz::detail::is_bulk_writable<decltype(upper), std::string>::value, "Should write in place");
+        REQUIRE(lz::to<std::string>(upper) == "ABC");
+        REQUIRE(lz::to<std::string>(lst) == "abc");
+    }
+
+#endif
+
     SUBCASE("To forward list sentinel iterator pair") {
         auto c_str = lz::c_string("Hello");
         auto flst = lz::to<std::forward_list<char>>(c_str);
@@ -387,6 +464,97 @@ TEST_CASE("To container") {
     }
 }
 
+namespace {
+std::size_t chunk_allocations = 0;
+
+template<class T>
+struct chunk_counting_allocator {
+    using value_type = T;
+
+    chunk_counting_allocator() = default;
+
+    template<class U>
+    chunk_counting_allocator(const chunk_counting_allocator<U>&) noexcept {
+    }
+
+    T* allocate(std::size_t n) {
+        ++chunk_allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template<class U>
+    bool operator==(const chunk_counting_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template<class U>
+    bool operator!=(const chunk_counting_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+} // namespace
+
+TEST_CASE("To container with strategy") {
+    auto range = lz::range(1000);
+    auto odd = lz::filter(range, [](int i) { return i % 2 == 1; });
+    const std::vector<int> expected = odd | lz::to<std::vector>();
+
+    SUBCASE("Chunked") {
+        auto vec = odd | lz::to<std::vector>(lz::chunked);
+        REQUIRE(vec == expected);
+        REQUIRE(vec.capacity() == vec.size());
+        vec = lz::to<std::vector<int>>(odd, lz::chunked_buffering<>(7));
+        REQUIRE(vec == expected);
+        REQUIRE(vec.capacity() == vec.size());
+        vec = lz::to<std::vector>(odd, lz::chunked, std::allocator<int>{});
+        REQUIRE(vec == expected);
+    }
+
+    SUBCASE("Chunked with allocator") {
+        chunk_allocations = 0;
+        auto vec = odd | lz::to<std::vector>(lz::chunked_buffering<chunk_counting_allocator<int>>(100, {}));
+        REQUIRE(vec == expected);
+        REQUIRE(chunk_allocations == 5);
+    }
+
+    SUBCASE("Chunked non trivial") {
+        auto strings = lz::map(odd, [](int i) { return std::to_string(i); });
+        auto vec = strings | lz::to<std::vector>(lz::chunked_buffering<>(64));
+        REQUIRE(vec.size() == expected.size());
+        REQUIRE(vec.capacity() == vec.size());
+        REQUIRE(lz::equal(vec, strings));
+    }
+
+    SUBCASE("Exact count") {
+        auto vec = odd | lz::to<std::vector>(lz::exact_count);
+        REQUIRE(vec == expected);
+        REQUIRE(vec.capacity() == vec.size());
+
+        auto strings = lz::map(odd, [](int i) { return std::to_string(i); }) | lz::to<std::vector>(lz::exact_count);
+        REQUIRE(strings.capacity() == strings.size());
+        REQUIRE(strings.size() == expected.size());
+    }
+
+    SUBCASE("Sized or not reservable") {
+        REQUIRE((range | lz::to<std::vector>(lz::chunked)) == (range | lz::to<std::vector>()));
+        REQUIRE((range | lz::to<std::vector>(lz::exact_count)) == (range | lz::to<std::vector>()));
+        auto lst = odd | lz::to<std::list>(lz::chunked);
+        REQUIRE(lz::equal(lst, expected));
+        lst = odd | lz::to<std::list>(lz::exact_count);
+        REQUIRE(lz::equal(lst, expected));
+    }
+
+    SUBCASE("Empty") {
+        auto empty = lz::filter(range, [](int) { return false; });
+        REQUIRE((empty | lz::to<std::vector>(lz::chunked)).empty());
+        REQUIRE((empty | lz::to<std::vector>(lz::exact_count)).empty());
+    }
+}
+
 TEST_CASE("Empty") {
     SUBCASE("With empty c-string") {
         const char* str = "";
@@ -2102,3 +2270,117 @@ TEST_CASE("Is sorted") {
         REQUIRE_FALSE(lz::is_sorted(iterable));
     }
 }
+
+TEST_CASE("Utf8 validate") {
+    SUBCASE("Well formed") {
+        REQUIRE(lz::utf8_validate(std::string()));
+        REQUIRE(lz::utf8_validate(std::string("Hello, world! This is a longer ASCII string")));
+        REQUIRE(lz::utf8_validate(std::string("h\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 \xF4\x8F\xBF\xBF")));
+        REQUIRE(lz::utf8_validate(std::string("\xEF\xBF\xBD")));
+        REQUIRE(lz::utf8_validate(std::string("abcdefgh\xC3\xA9ijklmnop\xC3\xA9")));
+        REQUIRE(lz::utf8_validate(std::string("a\0b", 3)));
+    }
+
+    SUBCASE("Ill formed") {
+        REQUIRE_FALSE(lz::utf8_validate(std::string("\x80")));
+        REQUIRE_FALSE(lz::utf8_validate(std::string("\xC0\xAF")));
+        REQUIRE_FALSE(lz::utf8_validate(std::string("\xE0\x80\xAF")));
+        REQUIRE_FALSE(lz::utf8_validate(std::string("\xED\xA0\x80")));
+        REQUIRE_FALSE(lz::utf8_validate(std::string("\xF4\x90\x80\x80")));
+        REQUIRE_FALSE(lz::utf8_validate(std::string("\xF5\x80\x80\x80")));
+        REQUIRE_FALSE(lz::utf8_validate(std::string("\xFF")));
+        REQUIRE_FALSE(lz::utf8_validate(std::string("abcdefgh\xE2\x82")));
+        REQUIRE_FALSE(lz::utf8_validate(std::string("abcdefghijklmnop\xC3")));
+    }
+
+    SUBCASE("String views and c-strings") {
+        REQUIRE(lz::utf8_validate(lz::string_view("h\xC3\xA9")));
+        REQUIRE_FALSE(lz::utf8_validate(lz::string_view("h\xC3\xA9", 2)));
+        REQUIRE(lz::utf8_validate("h\xC3\xA9"));
+        REQUIRE_FALSE(lz::utf8_validate("h\xC3"));
+        REQUIRE(lz::utf8_validate(lz::c_string("h\xC3\xA9")));
+        REQUIRE_FALSE(lz::utf8_validate(lz::c_string("\xC3")));
+    }
+}
+
+TEST_CASE("To container parallel") {
+    auto range = lz::range(20000);
+    auto squares = lz::map(range, [](int i) { return static_cast<long long>(i) * i; });
+    const auto expected = squares | lz::to<std::vector>();
+
+    SUBCASE("Resizable containers") {
+        static_assert(lz::detail::is_parallel_fillable<decltype(squares), std::vector<long long>>::value, "Should be fillable");
+        auto vec = squares | lz::to<std::vector>(lz::par);
+        REQUIRE(vec == expected);
+        vec = lz::to<std::vector<long long>>(squares, lz::parallel_execution(4, 1));
+        REQUIRE(vec == expected);
+        vec = lz::to<std::vector>(squares, lz::parallel_execution(3, 1), std::allocator<long long>{});
+        REQUIRE(vec == expected);
+
+        auto deque = squares | lz::to<std::deque>(lz::parallel_execution(4, 1));
+        REQUIRE(lz::equal(deque, expected));
+
+        auto strings = lz::map(range, [](int i) { return std::to_string(i); });
+        auto string_vec = strings | lz::to<std::vector>(lz::parallel_execution(4, 1));
+        REQUIRE(lz::equal(string_vec, strings));
+    }
+
+    SUBCASE("Associative containers") {
+        auto mod = lz::map(range, [](int i) { return i % 1000; });
+        auto set = mod | lz::to<std::set>(lz::parallel_execution(4, 1));
+        REQUIRE(lz::equal(set, lz::range(1000)));
+        auto multiset = mod | lz::to<std::multiset>(lz::parallel_execution(4, 1));
+        REQUIRE(multiset.size() == 20000);
+        auto unordered = mod | lz::to<std::unordered_set>(lz::parallel_execution(4, 1));
+        REQUIRE(unordered.size() == 1000);
+
+        auto pairs = lz::map(range, [](int i) { return std::make_pair(i % 10, i); });
+        auto map = pairs | lz::to<std::map<int, int>>(lz::parallel_execution(4, 1));
+        REQUIRE(map.size() == 10);
+        // Same as a serial conversion: the first occurrence of a key is kept
+        REQUIRE(map == (pairs | lz::to<std::map<int, int>>()));
+    }
+
+    SUBCASE("Serial fallback") {
+        static_assert(!lz::detail::is_parallel_fillable<decltype(range), std::vector<bool>>::value, "Should not be fillable");
+        auto bools = lz::map(range, [](int i) { return i % 2 == 0; });
+        REQUIRE((bools | lz::to<std::vector>(lz::par)) == (bools | lz::to<std::vector>()));
+
+        std::list<int> lst = { 1, 2, 3 };
+        REQUIRE((lst | lz::to<std::vector>(lz::par)) == std::vector<int>{ 1, 2, 3 });
+        REQUIRE(lz::equal(lz::range(3) | lz::to<std::list>(lz::par), lz::range(3)));
+    }
+
+    SUBCASE("Exceptions") {
+        auto throwing = lz::map(range, [](int i) {
+            if (i == 15000) {
+                throw std::runtime_error("error");
+            }
+            return i;
+        });
+        bool thrown = false;
+        try {
+            static_cast<void>(throwing | lz::to<std::vector>(lz::parallel_execution(4, 1)));
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        REQUIRE(thrown);
+
+        thrown = false;
+        try {
+            static_cast<void>(throwing | lz::to<std::set>(lz::parallel_execution(4, 1)));
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        REQUIRE(thrown);
+    }
+
+    SUBCASE("Small and empty") {
+        auto empty = lz::range(0);
+        REQUIRE((empty | lz::to<std::vector>(lz::par)).empty());
+        REQUIRE((empty | lz::to<std::set>(lz::par)).empty());
+        REQUIRE((lz::range(3) | lz::to<std::vector>(lz::parallel_execution(8, 1))) == std::vector<int>{ 0, 1, 2 });
+    }
+}
@@ -0,0 +1,117 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/algorithm/front.hpp>
+#include <Lz/cached_begin.hpp>
+#include <Lz/chunk_if.hpp>
+#include <Lz/filter.hpp>
+#include <Lz/traits/is_sized.hpp>
+#include <Lz/zip.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <doctest/doctest.h>
+#include <thread>
+
+TEST_CASE("Begin is only computed once") {
+    std::vector<int> vec = { 1, 3, 5, 6, 7, 8 };
+    size_t calls = 0;
+    auto filtered = vec | lz::filter([&calls](int i) {
+                        ++calls;
+                        return i % 2 == 0;
+                    });
+    lz::cached_begin_iterable<decltype(filtered)> cached = filtered | lz::cache_begin;
+    REQUIRE(calls == 0);
+
+    auto first = cached.begin();
+    REQUIRE(*first == 6);
+    REQUIRE(calls == 4);
+
+    REQUIRE(cached.begin() == first);
+    REQUIRE(!lz::empty(cached));
+    REQUIRE(lz::front(cached) == 6);
+    REQUIRE(calls == 4);
+
+    std::vector<int> expected = { 6, 8 };
+    REQUIRE(lz::equal(cached, expected));
+}
+
+TEST_CASE("Cached begin copies") {
+    std::vector<int> vec = { 1, 3, 5, 6, 7, 8 };
+    size_t calls = 0;
+    auto cached = vec | lz::filter([&calls](int i) {
+                      ++calls;
+                      return i % 2 == 0;
+                  }) |
+                  lz::cache_begin;
+    REQUIRE(*cached.begin() == 6);
+    REQUIRE(calls == 4);
+
+    SUBCASE("Copy constructor does not copy the cache") {
+        auto copy = cached;
+        REQUIRE(*copy.begin() == 6);
+        REQUIRE(calls == 8);
+        REQUIRE(*copy.begin() == 6);
+        REQUIRE(calls == 8);
+    }
+
+    SUBCASE("Assignment resets the cache") {
+        auto other = cached;
+        REQUIRE(*other.begin() == 6);
+        REQUIRE(calls == 8);
+        other = cached;
+        REQUIRE(*other.begin() == 6);
+        REQUIRE(calls == 12);
+    }
+}
+
+TEST_CASE("Cached begin with chunk_if and sized iterables") {
+    SUBCASE("chunk_if") {
+        std::vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+        auto chunked = lz::chunk_if(vec, [](int i) { return i % 2 == 0; }) | lz::cache_begin;
+        using value_type = lz::detail::val_iterable_t<decltype(chunked)>;
+        std::vector<std::vector<int>> expected = { { 1 }, { 3 }, { 5 }, {} };
+        auto eq = [](value_type a, const std::vector<int>& b) {
+            return lz::equal(a, b);
+        };
+        REQUIRE(lz::equal(chunked, expected, eq));
+        REQUIRE(lz::equal(chunked, expected, eq));
+    }
+
+    SUBCASE("Sized") {
+        std::vector<int> vec = { 1, 2, 3 };
+        auto cached = vec | lz::cache_begin;
+        static_assert(lz::is_sized<decltype(cached)>::value, "Should be sized");
+        REQUIRE(cached.size() == 3);
+        auto zipped = lz::zip(cached, vec);
+        REQUIRE(zipped.size() == 3);
+        std::vector<std::tuple<int, int>> expected = { std::make_tuple(1, 1), std::make_tuple(2, 2), std::make_tuple(3, 3) };
+        REQUIRE(lz::equal(zipped, expected));
+    }
+
+    SUBCASE("Not sized") {
+        std::vector<int> vec = { 1, 2, 3 };
+        auto cached = vec | lz::filter([](int i) { return i > 1; }) | lz::cache_begin;
+        static_assert(!lz::is_sized<decltype(cached)>::value, "Should not be sized");
+    }
+
+    SUBCASE("Empty") {
+        std::vector<int> vec = { 1, 3 };
+        auto cached = vec | lz::filter([](int i) { return i % 2 == 0; }) | lz::cache_begin;
+        REQUIRE(lz::empty(cached));
+        REQUIRE(cached.begin() == cached.end());
+    }
+}
+
+TEST_CASE("Cached begin concurrent access") {
+    std::vector<int> vec(1000, 1);
+    vec.back() = 2;
+    const auto cached = vec | lz::filter([](int i) { return i == 2; }) | lz::cache_begin;
+
+    std::vector<int> results(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&cached, &results, i] { results[i] = *cached.begin(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(results == std::vector<int>(4, 2));
+}
@@ -0,0 +1,133 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/algorithm/has_many.hpp>
+#include <Lz/algorithm/has_one.hpp>
+#include <Lz/channel.hpp>
+#include <Lz/filter.hpp>
+#include <Lz/map.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/range.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <doctest/doctest.h>
+#include <thread>
+
+TEST_CASE("channel is a sentinel terminated input iterable") {
+    lz::channel<int> channel(8);
+    static_assert(std::is_same<decltype(channel.end()), lz::default_sentinel_t>::value, "Should be sentinel");
+    static_assert(std::is_same<lz::detail::iter_cat_t<decltype(channel.begin())>, std::input_iterator_tag>::value,
+                  "Should be input iterator");
+    REQUIRE(channel.push(1));
+    REQUIRE(channel.push(2));
+    channel.close();
+    REQUIRE(channel.closed());
+    std::vector<int> expected = { 1, 2 };
+    REQUIRE(lz::equal(channel, expected));
+}
+
+TEST_CASE("Copies of a channel iterator advance together") {
+    lz::channel<int> channel(8);
+    REQUIRE(channel.push(1));
+    REQUIRE(channel.push(2));
+    channel.close();
+
+    auto it = channel.begin();
+    auto copy = it;
+    REQUIRE(*copy == 1);
+    ++it;
+    REQUIRE(*copy == 2);
+    ++it;
+    REQUIRE(it == channel.end());
+    REQUIRE(copy == channel.end());
+    REQUIRE(it == copy);
+}
+
+TEST_CASE("channel push and try_push") {
+    lz::channel<std::string> channel(2);
+    REQUIRE(channel.try_push("a"));
+    std::string b = "b";
+    REQUIRE(channel.try_push(b));
+    REQUIRE_FALSE(channel.try_push("c"));
+
+    std::vector<std::string> batch;
+    REQUIRE(channel.pop_batch(batch, 10) == 2);
+    REQUIRE(batch == std::vector<std::string>{ "a", "b" });
+
+    REQUIRE(channel.push("c"));
+    channel.close();
+    REQUIRE_FALSE(channel.push("d"));
+    REQUIRE_FALSE(channel.try_push("d"));
+
+    batch.clear();
+    REQUIRE(channel.pop_batch(batch, 10) == 1);
+    REQUIRE(batch == std::vector<std::string>{ "c" });
+    REQUIRE(channel.pop_batch(batch, 10) == 0);
+}
+
+namespace {
+constexpr int producer_count = 4;
+constexpr int per_producer = 1000;
+
+std::thread start_producers(lz::channel<int>& channel) {
+    return std::thread([&channel]() {
+        std::vector<std::thread> producers;
+        for (int p = 0; p < producer_count; ++p) {
+            producers.emplace_back([&channel, p]() {
+                for (int i = 0; i < per_producer; ++i) {
+                    channel.push(p * per_producer + i);
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        channel.close();
+    });
+}
+} // namespace
+
+TEST_CASE("channel fed by multiple producers") {
+    SUBCASE("Piped") {
+        lz::channel<int> channel(16, 4);
+        std::thread producers = start_producers(channel);
+        auto result = channel | lz::filter([](int i) { return i % 2 == 0; }) | lz::map([](int i) { return i / 2; }) |
+                      lz::to<std::vector>();
+        producers.join();
+        std::sort(result.begin(), result.end());
+        REQUIRE(lz::equal(result, lz::range(producer_count * per_producer / 2)));
+    }
+
+    SUBCASE("Multiple consumers") {
+        lz::channel<int> channel(16, 4);
+        std::thread producers = start_producers(channel);
+        std::vector<int> first;
+        std::vector<int> second;
+        std::thread consumer([&channel, &first]() { first = channel | lz::to<std::vector>(); });
+        second = channel | lz::to<std::vector>();
+        consumer.join();
+        producers.join();
+
+        first.insert(first.end(), second.begin(), second.end());
+        std::sort(first.begin(), first.end());
+        REQUIRE(lz::equal(first, lz::range(producer_count * per_producer)));
+    }
+}
+
+TEST_CASE("Empty or one element channel") {
+    SUBCASE("Empty") {
+        lz::channel<int> channel;
+        channel.close();
+        REQUIRE(lz::empty(channel));
+        REQUIRE_FALSE(lz::has_one(channel));
+        REQUIRE_FALSE(lz::has_many(channel));
+    }
+
+    SUBCASE("One element") {
+        lz::channel<int> channel;
+        channel.push(1);
+        channel.close();
+        auto it = channel.begin();
+        REQUIRE(*it == 1);
+        ++it;
+        REQUIRE(it == channel.end());
+    }
+}
@@ -9,6 +9,7 @@
 #include <Lz/procs/to.hpp>
 #include <Lz/repeat.hpp>
 #include <Lz/reverse.hpp>
+#include <Lz/traits/static_size.hpp>
 #include <cpp-lazy-ut-helper/pch.hpp>
 #include <cpp-lazy-ut-helper/test_procs.hpp>
 #include <cpp-lazy-ut-helper/ut_helper.hpp>
@@ -306,3 +307,52 @@ TEST_CASE("Chunks to containers") {
         REQUIRE(lists == expected);
     }
 }
+
+TEST_CASE("Static chunks") {
+    std::array<int, 7> arr = { 1, 2, 3, 4, 5, 6, 7 };
+#ifdef LZ_HAS_CXX_11
+    auto chunked = lz::static_chunks<3>{}(arr);
+    auto piped = arr | lz::static_chunks<3>{};
+#else
+    auto chunked = lz::static_chunks<3>(arr);
+    auto piped = arr | lz::static_chunks<3>;
+#endif
+    static_assert(std::is_same<lz::detail::val_iterable_t<decltype(chunked)>, std::array<int, 3>>::value,
+                  "Chunks should be std::arrays");
+    static_assert(lz::detail::is_ra<decltype(chunked.begin())>::value, "Should be random access");
+    static_assert(lz::static_size<decltype(chunked)>::value == 2, "Static size should be propagated");
+
+    std::vector<std::array<int, 3>> expected = { { { 1, 2, 3 } }, { { 4, 5, 6 } } };
+    REQUIRE(chunked.size() == 2);
+    REQUIRE(lz::equal(chunked, expected));
+    REQUIRE(lz::equal(piped, expected));
+    REQUIRE(lz::equal(chunked | lz::reverse, expected | lz::reverse));
+
+    SUBCASE("Operator+ and operator-") {
+        test_procs::test_operator_plus(chunked, expected);
+        test_procs::test_operator_minus(chunked);
+    }
+
+    SUBCASE("Forward iterable") {
+        std::forward_list<int> list = { 1, 2, 3, 4, 5, 6, 7 };
+#ifdef LZ_HAS_CXX_11
+        auto fwd = lz::static_chunks<2>{}(list);
+#else
+        auto fwd = lz::static_chunks<2>(list);
+#endif
+        static_assert(!lz::has_static_size<decltype(fwd)>::value, "Size is not known at compile time");
+        std::vector<std::array<int, 2>> expected_fwd = { { { 1, 2 } }, { { 3, 4 } }, { { 5, 6 } } };
+        REQUIRE(lz::equal(fwd, expected_fwd));
+    }
+
+    SUBCASE("Less elements than chunk size") {
+        std::vector<int> vec = { 1, 2 };
+#ifdef LZ_HAS_CXX_11
+        auto empty = lz::static_chunks<3>{}(vec);
+#else
+        auto empty = lz::static_chunks<3>(vec);
+#endif
+        REQUIRE(lz::empty(empty));
+        REQUIRE(empty.size() == 0);
+    }
+}
@@ -0,0 +1,117 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/concatenate_dynamic.hpp>
+#include <Lz/map.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/range.hpp>
+#include <Lz/reverse.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <cpp-lazy-ut-helper/test_procs.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("Concatenate dynamic basic functionality") {
+    std::vector<std::vector<int>> buffers = { { 1, 2 }, {}, { 3 }, {}, { 4, 5, 6 }, {} };
+    auto stream = buffers | lz::concat_dynamic;
+    static_assert(lz::detail::is_ra<decltype(stream.begin())>::value, "Should be random access");
+    static_assert(std::is_same<decltype(stream.begin()), decltype(stream.end())>::value, "Should not be sentinelled");
+
+    std::vector<int> expected = { 1, 2, 3, 4, 5, 6 };
+    REQUIRE(stream.size() == expected.size());
+    REQUIRE(lz::equal(stream, expected));
+    REQUIRE(lz::equal(stream | lz::reverse, expected | lz::reverse));
+
+    SUBCASE("operator[]") {
+        auto begin = stream.begin();
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            REQUIRE(begin[static_cast<std::ptrdiff_t>(i)] == expected[i]);
+        }
+    }
+
+    SUBCASE("Operator+ and operator-") {
+        test_procs::test_operator_plus(stream, expected);
+        test_procs::test_operator_minus(stream);
+    }
+
+    SUBCASE("Mutable references") {
+        stream.begin()[2] = 30;
+        REQUIRE(buffers[2].front() == 30);
+    }
+
+    SUBCASE("Segments") {
+        REQUIRE(stream.segment_count() == 3);
+        REQUIRE(lz::equal(stream.segment(0), std::vector<int>{ 1, 2 }));
+        REQUIRE(lz::equal(stream.segment(1), std::vector<int>{ 3 }));
+        REQUIRE(lz::equal(stream.segment(2), std::vector<int>{ 4, 5, 6 }));
+    }
+}
+
+TEST_CASE("Empty or one element concatenate dynamic") {
+    SUBCASE("Empty") {
+        std::vector<std::vector<int>> buffers;
+        auto stream = lz::concat_dynamic(buffers);
+        REQUIRE(lz::empty(stream));
+        REQUIRE(stream.size() == 0);
+        REQUIRE(stream.segment_count() == 0);
+    }
+
+    SUBCASE("Only empty iterables") {
+        std::vector<std::vector<int>> buffers(4);
+        auto stream = lz::concat_dynamic(buffers);
+        REQUIRE(lz::empty(stream));
+        REQUIRE(stream.begin() == stream.end());
+        REQUIRE(stream.segment_count() == 0);
+    }
+
+    SUBCASE("Default constructed") {
+        lz::concatenate_dynamic_iterable<std::vector<std::vector<int>>> stream;
+        REQUIRE(lz::empty(stream));
+        REQUIRE(stream.size() == 0);
+    }
+
+    SUBCASE("One element") {
+        std::vector<std::vector<int>> buffers = { {}, { 1 } };
+        auto stream = lz::concat_dynamic(buffers);
+        REQUIRE(stream.size() == 1);
+        REQUIRE(*stream.begin() == 1);
+        REQUIRE(stream.begin() + 1 == stream.end());
+        REQUIRE(--stream.end() == stream.begin());
+    }
+}
+
+namespace {
+struct buffer {
+    const char* data;
+    std::size_t length;
+};
+} // namespace
+
+TEST_CASE("Concatenate dynamic with other iterables") {
+    SUBCASE("Lazy views by value") {
+        std::vector<buffer> buffers = { { "hello", 5 }, { " ", 1 }, { "world", 5 } };
+        auto to_view = [](const buffer& b) {
+            return lz::basic_iterable<const char*>(b.data, b.data + b.length);
+        };
+        auto stream = lz::map(buffers, to_view) | lz::concat_dynamic;
+        REQUIRE(stream.size() == 11);
+        REQUIRE(lz::equal(stream, lz::c_string("hello world")));
+        REQUIRE(stream.begin()[6] == 'w');
+    }
+
+    SUBCASE("Forward iterable of iterables") {
+        std::forward_list<std::vector<int>> lists = { { 1 }, { 2, 3 } };
+        auto stream = lz::concat_dynamic(lists);
+        REQUIRE(lz::equal(stream, std::vector<int>{ 1, 2, 3 }));
+        REQUIRE(stream.end()[-1] == 3);
+    }
+
+    SUBCASE("To vector in parallel") {
+        std::vector<std::vector<int>> buffers;
+        for (int i = 0; i < 50; ++i) {
+            buffers.push_back(lz::range(i * 10, i * 10 + 10) | lz::to<std::vector>());
+        }
+        auto stream = lz::concat_dynamic(buffers);
+        REQUIRE(lz::equal(stream, lz::range(500)));
+        REQUIRE((stream | lz::to<std::vector>(lz::parallel_execution(4, 1))) == (lz::range(500) | lz::to<std::vector>()));
+    }
+}
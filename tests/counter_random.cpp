@@ -0,0 +1,81 @@
+#include <Lz/algorithm/all_of.hpp>
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/random.hpp>
+#include <Lz/reverse.hpp>
+#include <Lz/take.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <cpp-lazy-ut-helper/test_procs.hpp>
+#include <doctest/doctest.h>
+#include <random>
+
+TEST_CASE("Counter random basic functionality") {
+    auto random = lz::counter_random(0, 1000, 42, 100);
+    static_assert(lz::detail::is_ra<decltype(random.begin())>::value, "Should be random access");
+    static_assert(std::is_same<decltype(random.begin()), decltype(random.end())>::value, "Should not be sentinelled");
+
+    const auto expected = random | lz::to<std::vector>();
+    REQUIRE(random.size() == 100);
+    REQUIRE(expected.size() == 100);
+    REQUIRE(lz::all_of(random, [](int i) { return i >= 0 && i <= 1000; }));
+
+    SUBCASE("Same seed, same numbers") {
+        REQUIRE(lz::equal(random, expected));
+        REQUIRE(lz::equal(lz::counter_random(0, 1000, 42, 100), expected));
+        REQUIRE(lz::equal(random | lz::reverse, expected | lz::reverse));
+        REQUIRE_FALSE(lz::equal(lz::counter_random(0, 1000, 43, 100), expected));
+    }
+
+    SUBCASE("Numbers don't depend on the access order") {
+        auto begin = random.begin();
+        for (std::ptrdiff_t i = 99; i >= 0; --i) {
+            REQUIRE(begin[i] == expected[static_cast<std::size_t>(i)]);
+        }
+        REQUIRE(*(random.end() - 1) == expected.back());
+    }
+
+    SUBCASE("Prefix of a larger amount") {
+        REQUIRE(lz::equal(lz::counter_random(0, 1000, 42, 10), expected | lz::take(10)));
+    }
+
+    SUBCASE("Operator+ and operator-") {
+        test_procs::test_operator_plus(random, expected);
+        test_procs::test_operator_minus(random);
+    }
+}
+
+TEST_CASE("Counter random with distributions that keep state") {
+    std::normal_distribution<double> dist(0., 1.);
+    auto random = lz::counter_random(dist, 7, 50);
+    const auto expected = random | lz::to<std::vector>();
+    std::vector<double> reversed;
+    for (auto it = random.end(); it != random.begin();) {
+        reversed.push_back(*--it);
+    }
+    REQUIRE(lz::equal(expected | lz::reverse, reversed));
+    REQUIRE(lz::equal(random, expected));
+}
+
+TEST_CASE("Counter random in parallel") {
+    auto random = lz::counter_random(0., 1., 1234, 10000);
+    const auto sequential = random | lz::to<std::vector>();
+    const auto parallel = random | lz::to<std::vector>(lz::parallel_execution(4, 16));
+    REQUIRE(sequential == parallel);
+    REQUIRE(lz::all_of(parallel, [](double d) { return d >= 0. && d < 1.; }));
+}
+
+TEST_CASE("Empty or one element counter random") {
+    SUBCASE("Empty") {
+        lz::counter_random_iterable<std::uniform_int_distribution<int>> random = lz::counter_random(0, 10, 1, 0);
+        REQUIRE(lz::empty(random));
+        REQUIRE(random.size() == 0);
+        REQUIRE((random | lz::to<std::vector>()).empty());
+    }
+
+    SUBCASE("One element") {
+        auto random = lz::counter_random(5, 5, 1, 1);
+        REQUIRE(random.size() == 1);
+        REQUIRE(*random.begin() == 5);
+    }
+}
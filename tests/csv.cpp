@@ -0,0 +1,180 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/csv.hpp>
+#include <Lz/map.hpp>
+#include <Lz/procs/to.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <cpp-lazy-ut-helper/test_procs.hpp>
+#include <cpp-lazy-ut-helper/ut_helper.hpp>
+#include <doctest/doctest.h>
+
+namespace {
+std::vector<std::vector<std::string>> to_strings(const lz::csv_iterable<char>& records) {
+    return records | lz::map([](const lz::csv_record& record) {
+               return record | lz::map([](const lz::csv_field& field) { return field.str(); }) | lz::to<std::vector>();
+           }) |
+           lz::to<std::vector>();
+}
+} // namespace
+
+TEST_CASE("csv basic functionality") {
+    SUBCASE("Simple records") {
+        std::string buffer = "a,b,c\n1,2,3\n";
+        lz::csv_iterable<char> records = lz::csv(buffer);
+        REQUIRE(records.size() == 2);
+        std::vector<std::vector<std::string>> expected = { { "a", "b", "c" }, { "1", "2", "3" } };
+        REQUIRE(to_strings(records) == expected);
+    }
+
+    SUBCASE("Zero copy") {
+        std::string buffer = "ab,\"cd\"";
+        auto records = buffer | lz::csv;
+        const auto first = records.begin()[0][0];
+        const auto second = records.begin()[0][1];
+        REQUIRE(first.value().data() == buffer.data());
+        REQUIRE(second.value().data() == buffer.data() + 4);
+        REQUIRE_FALSE(second.escaped());
+    }
+
+    SUBCASE("Quoted fields") {
+        std::string buffer = "\"a,b\",\"line\nbreak\",\"say \"\"hi\"\"\"\r\nx,\"\",y";
+        auto records = lz::csv(buffer);
+        std::vector<std::vector<std::string>> expected = { { "a,b", "line\nbreak", "say \"hi\"" }, { "x", "", "y" } };
+        REQUIRE(to_strings(records) == expected);
+        const auto escaped = records.begin()[0][2];
+        REQUIRE(escaped.escaped());
+        REQUIRE(escaped.raw() == lz::string_view("say \"\"hi\"\""));
+        REQUIRE(escaped == lz::string_view("say \"hi\""));
+    }
+
+    SUBCASE("Escaped values outlive the field") {
+        std::string buffer = "name,quote\nAda,\"Hello, \"\"world\"\"\"\nBob,\"\"\"a\"\"\"";
+        auto records = lz::csv(buffer);
+        lz::string_view quote = records.begin()[1][1].value();
+        REQUIRE(quote == lz::string_view("Hello, \"world\""));
+        REQUIRE(records.begin()[1][1].value().data() == quote.data());
+
+        auto quotes = records | lz::map([](const lz::csv_record& record) { return record[1].value(); }) |
+                      lz::to<std::vector<lz::string_view>>();
+        std::vector<lz::string_view> expected = { "quote", "Hello, \"world\"", "\"a\"" };
+        REQUIRE(quotes == expected);
+        static_assert(std::is_trivially_copyable<lz::csv_field>::value, "csv_field should be trivially copyable");
+    }
+
+    SUBCASE("Empty fields and trailing delimiters") {
+        std::string buffer = ",a,,\n,\n";
+        std::vector<std::vector<std::string>> expected = { { "", "a", "", "" }, { "", "" } };
+        REQUIRE(to_strings(lz::csv(buffer)) == expected);
+    }
+
+    SUBCASE("Line endings and empty lines") {
+        std::string buffer = "\r\na,b\r\n\n\r\nc,d\r\n\r\n";
+        std::vector<std::vector<std::string>> expected = { { "a", "b" }, { "c", "d" } };
+        REQUIRE(to_strings(lz::csv(buffer)) == expected);
+    }
+
+    SUBCASE("Unterminated quote and characters after a closing quote") {
+        std::string buffer = "\"a\"b,c\n\"unterminated,\nfield";
+        std::vector<std::vector<std::string>> expected = { { "a", "c" }, { "unterminated,\nfield" } };
+        REQUIRE(to_strings(lz::csv(buffer)) == expected);
+    }
+
+    SUBCASE("Options") {
+        std::string buffer = "a\t'b\tc'\td\n";
+        auto records = buffer | lz::csv(lz::csv_options{ '\t', '\'' });
+        std::vector<std::vector<std::string>> expected = { { "a", "b\tc", "d" } };
+        REQUIRE(to_strings(records) == expected);
+    }
+}
+
+TEST_CASE("Empty or one element csv") {
+    SUBCASE("Empty") {
+        std::string buffer;
+        auto records = lz::csv(buffer);
+        REQUIRE(lz::empty(records));
+        REQUIRE(records.size() == 0);
+        REQUIRE(lz::empty(lz::csv_iterable<char>{}));
+    }
+
+    SUBCASE("Only empty lines") {
+        std::string buffer = "\n\r\n\n";
+        REQUIRE(lz::empty(lz::csv(buffer)));
+    }
+
+    SUBCASE("One element") {
+        std::string buffer = "a";
+        auto records = lz::csv(buffer);
+        REQUIRE(records.size() == 1);
+        REQUIRE(records.begin()[0].size() == 1);
+        REQUIRE(records.begin()[0][0] == lz::string_view("a"));
+    }
+}
+
+TEST_CASE("csv binary operations") {
+    std::string buffer = "a\nb,c\nd,e,f";
+    auto records = lz::csv(buffer);
+
+    SUBCASE("Operator++") {
+        auto it = records.begin();
+        REQUIRE(it->size() == 1);
+        ++it;
+        REQUIRE(it->size() == 2);
+        ++it;
+        REQUIRE(it->size() == 3);
+        ++it;
+        REQUIRE(it == records.end());
+    }
+
+    SUBCASE("Operator--") {
+        auto it = records.end();
+        --it;
+        REQUIRE((*it)[2] == lz::string_view("f"));
+        --it;
+        REQUIRE((*it)[1] == lz::string_view("c"));
+    }
+
+    SUBCASE("Operator== & Operator!=") {
+        auto it = records.begin();
+        REQUIRE(it != records.end());
+        it += 3;
+        REQUIRE(it == records.end());
+    }
+
+    SUBCASE("Operator+") {
+        std::vector<std::vector<lz::string_view>> expected = { { "a" }, { "b", "c" }, { "d", "e", "f" } };
+        auto field_eq = [](const lz::csv_field& field, lz::string_view v) {
+            return field == v;
+        };
+        test_procs::test_operator_plus(records, expected,
+                                       [field_eq](const lz::csv_record& record, const std::vector<lz::string_view>& e) {
+                                           return lz::equal(record, e, field_eq);
+                                       });
+    }
+
+    SUBCASE("Operator-") {
+        test_procs::test_operator_minus(records);
+    }
+
+    SUBCASE("Fields random access") {
+        auto record = records.begin()[2];
+        REQUIRE(record.end() - record.begin() == 3);
+        REQUIRE((record.begin() + 2)->value() == lz::string_view("f"));
+        REQUIRE(*(record.end() - 3) == lz::string_view("d"));
+    }
+}
+
+TEST_CASE("csv to containers") {
+    std::string buffer = "a,b\nc,d";
+    auto records = lz::csv(buffer);
+
+    SUBCASE("To vector") {
+        std::vector<std::vector<std::string>> expected = { { "a", "b" }, { "c", "d" } };
+        REQUIRE(to_strings(records) == expected);
+    }
+
+    SUBCASE("To list") {
+        auto list = records | lz::map([](const lz::csv_record& record) { return record[0].str(); }) | lz::to<std::list>();
+        std::list<std::string> expected = { "a", "c" };
+        REQUIRE(list == expected);
+    }
+}
@@ -0,0 +1,275 @@
+#include <Lz/detail/compiler_config.hpp>
+
+#ifdef LZ_HAS_COROUTINES
+
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/algorithm/has_many.hpp>
+#include <Lz/algorithm/has_one.hpp>
+#include <Lz/filter.hpp>
+#include <Lz/generator.hpp>
+#include <Lz/map.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/range.hpp>
+#include <Lz/take_while.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <doctest/doctest.h>
+#include <stdexcept>
+
+// GCC reports these warnings for code it generates for coroutines
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wswitch-default"
+#pragma GCC diagnostic ignored "-Wzero-as-null-pointer-constant"
+#endif
+
+namespace {
+std::vector<int> make_vector(const int from, const int to) {
+    return lz::range(from, to) | lz::to<std::vector>();
+}
+
+lz::generator<int> fibonacci() {
+    int a = 0;
+    int b = 1;
+    while (true) {
+        co_yield a;
+        a = std::exchange(b, a + b);
+    }
+}
+
+lz::generator<int> count_to(const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+struct node {
+    int value;
+    std::unique_ptr<node> left;
+    std::unique_ptr<node> right;
+};
+
+std::unique_ptr<node> make_tree(const int from, const int to) {
+    if (from >= to) {
+        return nullptr;
+    }
+    const int middle = from + (to - from) / 2;
+    return std::unique_ptr<node>(new node{ middle, make_tree(from, middle), make_tree(middle + 1, to) });
+}
+
+lz::generator<int> walk(const node* n) {
+    if (n == nullptr) {
+        co_return;
+    }
+    co_yield lz::elements_of(walk(n->left.get()));
+    co_yield n->value;
+    co_yield lz::elements_of(walk(n->right.get()));
+}
+
+std::size_t allocations = 0;
+
+template<class T>
+struct counting_allocator {
+    using value_type = T;
+
+    int id = 0;
+
+    counting_allocator() = default;
+
+    explicit counting_allocator(const int i) noexcept : id{ i } {
+    }
+
+    template<class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept : id{ other.id } {
+    }
+
+    T* allocate(const std::size_t n) {
+        ++allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* ptr, const std::size_t n) noexcept {
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    template<class U>
+    bool operator==(const counting_allocator<U>& other) const noexcept {
+        return id == other.id;
+    }
+};
+
+// GCC does not see that the usual operator delete of the frame matches the operator new overload that takes the allocator,
+// and reports a false positive for the frame deallocation of coroutines that are passed an allocator
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+lz::generator<int, counting_allocator<int>> counted(std::allocator_arg_t, const counting_allocator<int>&, const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+lz::generator<int, counting_allocator<int>> counted_default(const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+} // namespace
+
+TEST_CASE("generator is a sentinel terminated input lazy_view") {
+    auto gen = count_to(3);
+    static_assert(std::is_base_of<lz::lazy_view, decltype(gen)>::value, "Should be a lazy_view");
+    static_assert(std::is_same<decltype(gen.end()), lz::default_sentinel_t>::value, "Should be sentinel");
+    static_assert(std::is_same<lz::detail::iter_cat_t<decltype(gen.begin())>, std::input_iterator_tag>::value,
+                  "Should be input iterator");
+    REQUIRE(lz::equal(gen, lz::range(3)));
+}
+
+TEST_CASE("generator in pipelines") {
+    SUBCASE("Infinite") {
+        auto first = fibonacci() | lz::take_while([](int i) { return i < 10; });
+        std::vector<int> expected = { 0, 1, 1, 2, 3, 5, 8 };
+        REQUIRE(lz::equal(first, expected));
+    }
+
+    SUBCASE("Filter and map") {
+        auto result = count_to(10) | lz::filter([](int i) { return i % 2 == 0; }) | lz::map([](int i) { return i * i; }) |
+                      lz::to<std::vector>();
+        REQUIRE(result == std::vector<int>{ 0, 4, 16, 36, 64 });
+    }
+
+    SUBCASE("Yielded values are not copied") {
+        auto strings = []() -> lz::generator<std::string> {
+            std::string s = "a";
+            co_yield s;
+            s += "b";
+            co_yield s;
+        }();
+        auto it = strings.begin();
+        const std::string* first = &*it;
+        REQUIRE(*it == "a");
+        ++it;
+        REQUIRE(&*it == first);
+        REQUIRE(*it == "ab");
+    }
+}
+
+TEST_CASE("generator with elements_of") {
+    SUBCASE("Recursive") {
+        auto tree = make_tree(0, 100);
+        REQUIRE(lz::equal(walk(tree.get()), lz::range(100)));
+    }
+
+    SUBCASE("Iterable") {
+        auto gen = []() -> lz::generator<int> {
+            auto vec = make_vector(1, 3);
+            co_yield 0;
+            co_yield lz::elements_of(vec);
+            co_yield lz::elements_of(make_vector(3, 5));
+            co_yield lz::elements_of(lz::range(5, 7));
+        }();
+        REQUIRE(lz::equal(gen, lz::range(7)));
+    }
+
+    SUBCASE("Empty nested") {
+        auto gen = []() -> lz::generator<int> {
+            co_yield lz::elements_of(count_to(0));
+            co_yield lz::elements_of(lz::generator<int>{});
+            co_yield 1;
+        }();
+        std::vector<int> expected = { 1 };
+        REQUIRE(lz::equal(gen, expected));
+    }
+}
+
+TEST_CASE("generator propagates exceptions") {
+    auto throwing = []() -> lz::generator<int> {
+        co_yield 1;
+        throw std::runtime_error("error");
+    };
+
+    SUBCASE("Top level") {
+        auto gen = throwing();
+        auto it = gen.begin();
+        REQUIRE(*it == 1);
+        bool thrown = false;
+        try {
+            ++it;
+        }
+        catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        REQUIRE(thrown);
+    }
+
+    SUBCASE("Nested") {
+        auto gen = [](auto inner) -> lz::generator<int> {
+            bool caught = false;
+            try {
+                co_yield lz::elements_of(inner());
+            }
+            catch (const std::runtime_error&) {
+                caught = true;
+            }
+            if (caught) {
+                co_yield 2;
+            }
+        }(throwing);
+        std::vector<int> expected = { 1, 2 };
+        REQUIRE(lz::equal(gen, expected));
+    }
+}
+
+TEST_CASE("generator allocates through its allocator") {
+    SUBCASE("Passed allocator") {
+        allocations = 0;
+        {
+            auto gen = counted(std::allocator_arg, counting_allocator<int>{ 1 }, 100);
+            REQUIRE(lz::equal(gen, lz::range(100)));
+        }
+        REQUIRE(allocations == 1);
+    }
+
+    SUBCASE("Default constructed allocator") {
+        allocations = 0;
+        {
+            auto gen = counted_default(100);
+            REQUIRE(lz::equal(gen, lz::range(100)));
+        }
+        REQUIRE(allocations == 1);
+    }
+}
+
+TEST_CASE("Copies of a generator share the same coroutine") {
+    auto gen = count_to(3);
+    auto copy = gen;
+    auto it = copy.begin();
+    REQUIRE(*it == 0);
+    ++it;
+    REQUIRE(*it == 1);
+    gen = lz::generator<int>{};
+    ++it;
+    REQUIRE(*it == 2);
+}
+
+TEST_CASE("Empty or one element generator") {
+    SUBCASE("Empty") {
+        REQUIRE(lz::empty(count_to(0)));
+        REQUIRE_FALSE(lz::has_one(count_to(0)));
+        REQUIRE_FALSE(lz::has_many(count_to(0)));
+        REQUIRE(lz::empty(lz::generator<int>{}));
+    }
+
+    SUBCASE("One element") {
+        REQUIRE_FALSE(lz::empty(count_to(1)));
+        REQUIRE(lz::has_one(count_to(1)));
+        REQUIRE_FALSE(lz::has_many(count_to(1)));
+    }
+}
+
+#endif // LZ_HAS_COROUTINES
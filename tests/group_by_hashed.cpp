@@ -0,0 +1,121 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/algorithm/has_many.hpp>
+#include <Lz/algorithm/has_one.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/filter.hpp>
+#include <Lz/group_by_hashed.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/range.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <doctest/doctest.h>
+
+namespace {
+struct order {
+    int customer;
+    double amount;
+};
+} // namespace
+
+TEST_CASE("group_by_hashed with sentinels") {
+    auto cstr = lz::c_string("abacabad");
+    auto grouped = lz::group_by_hashed(
+        cstr, [](char c) { return c; }, [](int acc, char) { return acc + 1; }, 0);
+    static_assert(std::is_same<decltype(grouped.end()), lz::default_sentinel_t>::value, "Should be sentinel");
+    static_assert(!lz::detail::is_bidi<decltype(grouped.begin())>::value, "Should not be bidirectional");
+
+    std::vector<std::pair<char, int>> expected = { { 'a', 4 }, { 'b', 2 }, { 'c', 1 }, { 'd', 1 } };
+    REQUIRE(lz::equal(grouped, expected));
+}
+
+TEST_CASE("group_by_hashed groups unsorted input by key") {
+    std::vector<order> orders = { { 3, 1.5 }, { 1, 10.0 }, { 2, 5.0 }, { 1, 2.5 }, { 3, 0.5 }, { 1, 1.0 } };
+
+    SUBCASE("Full call") {
+        lz::group_by_hashed_iterable<std::vector<order>, std::function<int(const order&)>, double,
+                                     std::function<double(double, const order&)>>
+            totals = lz::group_by_hashed(
+                orders, std::function<int(const order&)>([](const order& o) { return o.customer; }),
+                std::function<double(double, const order&)>([](double acc, const order& o) { return acc + o.amount; }), 0.0);
+
+        std::vector<std::pair<int, double>> expected = { { 3, 2.0 }, { 1, 13.5 }, { 2, 5.0 } };
+        REQUIRE(lz::equal(totals, expected));
+    }
+
+    SUBCASE("Piped") {
+        auto totals = orders | lz::group_by_hashed([](const order& o) { return o.customer; },
+                                                   [](double acc, const order& o) { return acc + o.amount; }, 0.0);
+        std::vector<std::pair<int, double>> expected = { { 3, 2.0 }, { 1, 13.5 }, { 2, 5.0 } };
+        REQUIRE(lz::equal(totals, expected));
+    }
+
+    SUBCASE("Default init") {
+        std::vector<int> vec = { 1, 2, 3, 4, 5 };
+        auto sums = lz::group_by_hashed(vec, [](int i) { return i % 2; }, LZ_BIN_OP(plus, int){});
+        std::vector<std::pair<int, int>> expected = { { 1, 9 }, { 0, 6 } };
+        REQUIRE(lz::equal(sums, expected));
+
+        auto piped = vec | lz::group_by_hashed([](int i) { return i % 2; }, LZ_BIN_OP(plus, int){});
+        REQUIRE(lz::equal(piped, expected));
+    }
+}
+
+TEST_CASE("group_by_hashed with many keys") {
+    auto numbers = lz::range(10000) | lz::filter([](int) { return true; });
+    auto check = [](const lz::group_by_hashed_iterable<decltype(numbers), int (*)(int), int, int (*)(int, int)>& grouped) {
+        std::size_t count = 0;
+        int expected_key = 0;
+        for (auto it = grouped.begin(); it != grouped.end(); ++it) {
+            REQUIRE(it->first == expected_key);
+            REQUIRE(it->second == 10);
+            ++expected_key;
+            ++count;
+        }
+        REQUIRE(count == 1000);
+    };
+    int (*key_fn)(int) = [](int i) { return i % 1000; };
+    int (*count_fn)(int, int) = [](int acc, int) { return acc + 1; };
+
+    SUBCASE("Growing") {
+        // Forces the table to grow multiple times
+        check(lz::group_by_hashed(numbers, key_fn, count_fn, 0));
+    }
+
+    SUBCASE("Expected keys") {
+        check(lz::group_by_hashed(numbers, key_fn, count_fn, 0, 1000));
+        check(numbers | lz::group_by_hashed(key_fn, count_fn, 0, 1000));
+        // A wrong estimate only affects performance
+        check(lz::group_by_hashed(numbers, key_fn, count_fn, 0, 3));
+    }
+}
+
+TEST_CASE("group_by_hashed with string keys") {
+    std::vector<std::string> words = { "apple", "pear", "apple", "fig", "pear", "apple" };
+    auto counted = words | lz::group_by_hashed([](const std::string& s) -> const std::string& { return s; },
+                                               [](std::size_t acc, const std::string&) { return acc + 1; }, std::size_t{ 0 });
+    using value_type = lz::detail::val_iterable_t<decltype(counted)>;
+    static_assert(std::is_same<value_type, std::pair<std::string, std::size_t>>::value, "Key should be decayed");
+
+    std::vector<std::pair<std::string, std::size_t>> expected = { { "apple", 3 }, { "pear", 2 }, { "fig", 1 } };
+    REQUIRE(lz::equal(counted, expected));
+    REQUIRE((counted | lz::to<std::vector>()) == expected);
+}
+
+TEST_CASE("Empty or one element group_by_hashed") {
+    SUBCASE("Empty") {
+        std::vector<int> vec;
+        auto grouped = lz::group_by_hashed(vec, [](int i) { return i; }, LZ_BIN_OP(plus, int){});
+        REQUIRE(lz::empty(grouped));
+        REQUIRE_FALSE(lz::has_one(grouped));
+        REQUIRE_FALSE(lz::has_many(grouped));
+    }
+
+    SUBCASE("One element") {
+        std::vector<int> vec = { 1, 1, 1 };
+        auto grouped = lz::group_by_hashed(vec, [](int i) { return i; }, LZ_BIN_OP(plus, int){});
+        REQUIRE_FALSE(lz::empty(grouped));
+        REQUIRE(lz::has_one(grouped));
+        REQUIRE_FALSE(lz::has_many(grouped));
+        REQUIRE(grouped.begin()->second == 3);
+    }
+}
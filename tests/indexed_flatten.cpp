@@ -0,0 +1,121 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/indexed_flatten.hpp>
+#include <Lz/map.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/reverse.hpp>
+#include <Lz/range.hpp>
+#include <array>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <cpp-lazy-ut-helper/test_procs.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("Indexed flatten basic functionality") {
+    std::vector<std::vector<int>> vectors = { {}, { 1, 2, 3 }, {}, {}, { 4 }, { 5, 6 }, {} };
+    auto flattened = vectors | lz::indexed_flatten;
+    static_assert(lz::detail::is_ra<decltype(flattened.begin())>::value, "Should be random access");
+    static_assert(std::is_same<decltype(flattened.begin()), decltype(flattened.end())>::value, "Should not be sentinelled");
+
+    std::vector<int> expected = { 1, 2, 3, 4, 5, 6 };
+    REQUIRE(flattened.size() == expected.size());
+    REQUIRE(lz::equal(flattened, expected));
+    REQUIRE(lz::equal(flattened | lz::reverse, expected | lz::reverse));
+
+    SUBCASE("operator[]") {
+        auto begin = flattened.begin();
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            REQUIRE(begin[static_cast<std::ptrdiff_t>(i)] == expected[i]);
+        }
+        REQUIRE(flattened.end()[-1] == 6);
+    }
+
+    SUBCASE("Operator+ and operator-") {
+        test_procs::test_operator_plus(flattened, expected);
+        test_procs::test_operator_minus(flattened);
+    }
+
+    SUBCASE("Mutable references") {
+        *(flattened.begin() + 3) = 40;
+        REQUIRE(vectors[4].front() == 40);
+    }
+
+    SUBCASE("Copies share the index") {
+        auto copy = flattened;
+        REQUIRE(lz::equal(copy, expected));
+        REQUIRE(copy.begin() + 6 == flattened.end());
+    }
+}
+
+TEST_CASE("Empty or one element indexed flatten") {
+    SUBCASE("Empty") {
+        std::vector<std::vector<int>> vectors;
+        auto flattened = lz::indexed_flatten(vectors);
+        REQUIRE(lz::empty(flattened));
+        REQUIRE(flattened.size() == 0);
+        REQUIRE(flattened.begin() == flattened.end());
+    }
+
+    SUBCASE("Only empty inner iterables") {
+        std::vector<std::vector<int>> vectors(3);
+        auto flattened = lz::indexed_flatten(vectors);
+        REQUIRE(lz::empty(flattened));
+        REQUIRE(flattened.begin() == flattened.end());
+    }
+
+    SUBCASE("Default constructed") {
+        lz::indexed_flatten_iterable<std::vector<std::vector<int>>> flattened;
+        REQUIRE(lz::empty(flattened));
+        REQUIRE(flattened.size() == 0);
+    }
+
+    SUBCASE("One element") {
+        std::vector<std::vector<int>> vectors = { {}, { 1 }, {} };
+        auto flattened = lz::indexed_flatten(vectors);
+        REQUIRE(flattened.size() == 1);
+        REQUIRE(*flattened.begin() == 1);
+        REQUIRE(flattened.begin() + 1 == flattened.end());
+        REQUIRE(flattened.end() - 1 == flattened.begin());
+    }
+}
+
+TEST_CASE("Indexed flatten with other iterables") {
+    SUBCASE("Array of arrays") {
+        std::array<std::array<int, 2>, 3> arrays = { { { { 1, 2 } }, { { 3, 4 } }, { { 5, 6 } } } };
+        auto flattened = lz::indexed_flatten(arrays);
+        REQUIRE(lz::equal(flattened, lz::range(1, 7)));
+    }
+
+    SUBCASE("Inner iterables of different types") {
+        std::vector<std::string> words = { "hello", "", "world" };
+        auto flattened = lz::indexed_flatten(words);
+        REQUIRE(flattened.size() == 10);
+        REQUIRE(lz::equal(flattened, lz::c_string("helloworld")));
+        REQUIRE(flattened.begin()[5] == 'w');
+    }
+
+    SUBCASE("Map over flattened") {
+        std::vector<std::vector<int>> vectors = { { 1, 2 }, { 3 } };
+        auto squared = vectors | lz::indexed_flatten | lz::map([](int i) { return i * i; });
+        REQUIRE(lz::equal(squared, std::vector<int>{ 1, 4, 9 }));
+        REQUIRE(squared.size() == 3);
+    }
+}
+
+TEST_CASE("Indexed flatten to container") {
+    std::vector<std::vector<int>> vectors;
+    std::vector<int> expected;
+    for (int i = 0; i < 100; ++i) {
+        vectors.emplace_back(static_cast<std::size_t>(i % 7), i);
+        expected.insert(expected.end(), static_cast<std::size_t>(i % 7), i);
+    }
+    auto flattened = lz::indexed_flatten(vectors);
+
+    SUBCASE("To vector") {
+        REQUIRE((flattened | lz::to<std::vector>()) == expected);
+    }
+
+    SUBCASE("To vector in parallel") {
+        REQUIRE((flattened | lz::to<std::vector>(lz::parallel_execution(4, 1))) == expected);
+    }
+}
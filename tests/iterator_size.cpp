@@ -0,0 +1,116 @@
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/duplicates.hpp>
+#include <Lz/except.hpp>
+#include <Lz/filter.hpp>
+#include <Lz/join_where.hpp>
+#include <Lz/map.hpp>
+#include <Lz/reverse.hpp>
+#include <Lz/zip.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <doctest/doctest.h>
+
+// Size budgets of common pipeline iterators, in pointers. Iterators are copied by begin(), end() and every algorithm, so these
+// tests make sure they don't grow unnoticed.
+namespace {
+constexpr std::size_t ptr_size = sizeof(void*);
+
+struct is_even {
+    bool operator()(int i) const {
+        return i % 2 == 0;
+    }
+};
+
+struct identity {
+    int operator()(int i) const {
+        return i;
+    }
+};
+
+struct add {
+    int operator()(int a, int b) const {
+        return a + b;
+    }
+};
+
+template<class Iterable>
+constexpr std::size_t iterator_size() {
+    return sizeof(lz::iter_t<Iterable>);
+}
+
+// Whether LZ_NO_UNIQUE_ADDRESS has any effect on this compiler/standard
+struct no_unique_address_probe {
+    LZ_NO_UNIQUE_ADDRESS is_even predicate;
+    int* pointer;
+};
+
+constexpr bool has_no_unique_address = sizeof(no_unique_address_probe) == sizeof(int*);
+} // namespace
+
+TEST_CASE("Filter iterator size") {
+    using list = std::forward_list<int>;
+    using filtered = lz::filter_iterable<list, is_even>;
+    static_assert(iterator_size<filtered>() <= 3 * ptr_size, "filter iterator too large");
+
+    // Forward filters only store the end of their input, instead of a copy of the (nested) input view
+    using mapped_filtered = lz::filter_iterable<lz::map_iterable<list, identity>, is_even>;
+    static_assert(iterator_size<mapped_filtered>() <= 4 * ptr_size, "filter iterator too large");
+
+    using nested = lz::filter_iterable<lz::filter_iterable<filtered, is_even>, is_even>;
+    static_assert(iterator_size<nested>() <= 5 * ptr_size, "nested filter iterator too large");
+    static_assert(iterator_size<lz::zip_iterable<nested, nested, nested>>() <= 15 * ptr_size, "zip iterator too large");
+
+    using sentinelled = lz::filter_iterable<lz::filter_iterable<lz::c_string_iterable<const char>, is_even>, is_even>;
+    static_assert(iterator_size<sentinelled>() <= 3 * ptr_size, "sentinelled filter iterator too large");
+
+    // Bidirectional filters need the begin of their input too, so they keep referring to containers with a pointer
+    using bidi_filtered = lz::filter_iterable<std::vector<int>, is_even>;
+    static_assert(iterator_size<bidi_filtered>() <= 3 * ptr_size, "filter iterator too large");
+
+    std::vector<int> vec = { 1, 2, 3, 4 };
+    list l = { 1, 2, 3, 4 };
+    auto forward = l | lz::map(identity{}) | lz::filter(is_even{}) | lz::filter(is_even{});
+    auto bidi = vec | lz::filter(is_even{}) | lz::filter(is_even{});
+    REQUIRE(lz::equal(forward, std::vector<int>{ 2, 4 }));
+    REQUIRE(lz::equal(bidi | lz::reverse, std::vector<int>{ 4, 2 }));
+}
+
+TEST_CASE("Duplicates, except and join_where iterator size") {
+    using list = std::forward_list<int>;
+    using mapped = lz::map_iterable<list, identity>;
+
+    static_assert(iterator_size<lz::duplicates_iterable<mapped>>() <= 7 * ptr_size, "duplicates iterator too large");
+    static_assert(iterator_size<lz::except_iterable<mapped, std::vector<int>>>() <= 5 * ptr_size, "except iterator too large");
+    static_assert(iterator_size<lz::join_where_iterable<mapped, std::vector<int>, identity, identity, add>>() <= 7 * ptr_size,
+                  "join_where iterator too large");
+
+    list l = { 1, 1, 2, 3, 3 };
+    std::vector<int> to_except = { 2 };
+    auto except = l | lz::map(identity{}) | lz::except(to_except);
+    REQUIRE(lz::equal(except, std::vector<int>{ 1, 1, 3, 3 }));
+}
+
+TEST_CASE("Stateless function objects take no space") {
+    using vec_iter = std::vector<int>::iterator;
+    using list_iter = std::forward_list<int>::iterator;
+
+    // A filter iterator over a container stores the iterator and a pointer to the container, the predicate is free
+    static_assert(!has_no_unique_address ||
+                      iterator_size<lz::filter_iterable<std::vector<int>, is_even>>() == sizeof(vec_iter) + ptr_size,
+                  "stateless predicate takes space");
+    static_assert(!has_no_unique_address ||
+                      iterator_size<lz::filter_iterable<std::forward_list<int>, is_even>>() == 2 * sizeof(list_iter),
+                  "stateless predicate takes space");
+    static_assert(!has_no_unique_address || iterator_size<lz::map_iterable<std::vector<int>, identity>>() == sizeof(vec_iter),
+                  "stateless function takes space");
+
+    std::vector<int> vec = { 1, 2, 3, 4 };
+    auto filtered = lz::filter(vec, [](int i) { return i % 2 == 0; });
+    auto mapped = lz::map(vec, [](int i) { return i * 2; });
+    if (has_no_unique_address) {
+        REQUIRE(sizeof(filtered.begin()) == sizeof(vec_iter) + ptr_size);
+        REQUIRE(sizeof(mapped.begin()) == sizeof(vec_iter));
+    }
+    REQUIRE(lz::equal(filtered, std::vector<int>{ 2, 4 }));
+    REQUIRE(lz::equal(mapped, std::vector<int>{ 2, 4, 6, 8 }));
+}
@@ -0,0 +1,106 @@
+#include <Lz/c_string.hpp>
+#include <Lz/csv.hpp>
+#include <Lz/filter.hpp>
+#include <Lz/join_to_string.hpp>
+#include <Lz/map.hpp>
+#include <Lz/split.hpp>
+#include <Lz/util/string_view.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <cpp-lazy-ut-helper/ut_helper.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("join_to_string basic functionality") {
+    SUBCASE("Strings") {
+        std::vector<std::string> vec = { "a", "bc", "def" };
+        REQUIRE(lz::join_to_string(vec, ", ") == "a, bc, def");
+        REQUIRE((vec | lz::join_to_string("")) == "abcdef");
+    }
+
+    SUBCASE("String views and c-strings") {
+        std::vector<lz::string_view> views = { "x", "y" };
+        REQUIRE(lz::join_to_string(views, "-") == "x-y");
+        std::vector<const char*> c_strings = { "x", "y" };
+        REQUIRE(lz::join_to_string(c_strings, "-") == "x-y");
+    }
+
+    SUBCASE("Characters") {
+        REQUIRE((lz::c_string("abc") | lz::join_to_string(",")) == "a,b,c");
+        std::string str = "abc";
+        REQUIRE(lz::join_to_string(str, "") == "abc");
+    }
+
+    SUBCASE("Split") {
+        std::string sentence = "hello big world";
+        REQUIRE((sentence | lz::sv_split(' ') | lz::join_to_string("_")) == "hello_big_world");
+    }
+
+    SUBCASE("Temporary elements") {
+        std::vector<int> vec = { 1, 2, 3 };
+        int calls = 0;
+        auto strings = vec | lz::map([&calls](int i) {
+                           ++calls;
+                           return std::string(static_cast<std::size_t>(i), 'x');
+                       });
+        REQUIRE(lz::join_to_string(strings, "|") == "x|xx|xxx");
+        // Elements that own their contents are not created twice to calculate the length
+        REQUIRE(calls == 3);
+    }
+
+    SUBCASE("Csv fields") {
+        std::string buffer = "a,\"b\"\"\",c";
+        REQUIRE((lz::csv(buffer).begin()[0] | lz::join_to_string(";")) == "a;b\";c");
+    }
+
+    SUBCASE("Exact size") {
+        std::vector<std::string> vec = { "ab", "", "cde" };
+        REQUIRE(lz::detail::joined_size(vec.begin(), vec.end(), 2) == 9);
+        REQUIRE(lz::join_to_string(vec, ", ").size() == 9);
+    }
+}
+
+TEST_CASE("join_to") {
+    std::vector<std::string> vec = { "a", "b", "c" };
+
+    SUBCASE("Append to string") {
+        std::string output = "letters: ";
+        lz::join_to(vec, output, ", ");
+        REQUIRE(output == "letters: a, b, c");
+        vec | lz::join_to(output, "");
+        REQUIRE(output == "letters: a, b, cabc");
+    }
+
+    SUBCASE("Contiguous buffer") {
+        char buffer[16] = {};
+        char* end = lz::join_to(vec, buffer, ", ");
+        REQUIRE(end == buffer + 7);
+        REQUIRE(std::string(buffer, end) == "a, b, c");
+        end = vec | lz::join_to(buffer, "");
+        REQUIRE(std::string(buffer, end) == "abc");
+    }
+
+    SUBCASE("Output iterator") {
+        std::vector<char> chars;
+        lz::join_to(vec, std::back_inserter(chars), "+");
+        std::vector<char> expected = { 'a', '+', 'b', '+', 'c' };
+        REQUIRE(chars == expected);
+    }
+}
+
+TEST_CASE("Empty or one element join_to_string") {
+    SUBCASE("Empty") {
+        std::vector<std::string> vec;
+        REQUIRE(lz::join_to_string(vec, ", ").empty());
+        std::string output = "x";
+        lz::join_to(vec, output, ", ");
+        REQUIRE(output == "x");
+        char buffer[1] = {};
+        REQUIRE(lz::join_to(vec, buffer, ", ") == buffer);
+    }
+
+    SUBCASE("One element") {
+        std::vector<std::string> vec = { "abc" };
+        REQUIRE(lz::join_to_string(vec, ", ") == "abc");
+        auto filtered = vec | lz::filter([](const std::string& s) { return !s.empty(); });
+        REQUIRE(lz::join_to_string(filtered, ", ") == "abc");
+    }
+}
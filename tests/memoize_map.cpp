@@ -0,0 +1,154 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/algorithm/has_many.hpp>
+#include <Lz/algorithm/has_one.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/memoize_map.hpp>
+#include <Lz/pairwise.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/repeat.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <cpp-lazy-ut-helper/test_procs.hpp>
+#include <cpp-lazy-ut-helper/ut_helper.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("Memoize map calls function once per element") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    std::vector<int> calls(vec.size());
+    auto memoized = vec | lz::memoize_map([&calls](int i) {
+                        ++calls[static_cast<size_t>(i - 1)];
+                        return i * 2;
+                    });
+    static_assert(lz::detail::is_ra<decltype(memoized.begin())>::value, "Should be random access");
+    REQUIRE(memoized.size() == vec.size());
+
+    std::vector<int> expected = { 2, 4, 6, 8, 10 };
+    REQUIRE(lz::equal(memoized, expected));
+    REQUIRE(lz::equal(memoized, expected));
+    REQUIRE(calls == std::vector<int>(vec.size(), 1));
+
+    SUBCASE("Pairwise") {
+        auto pairs = memoized | lz::pairwise(2);
+        std::vector<std::vector<int>> expected_pairs = { { 2, 4 }, { 4, 6 }, { 6, 8 }, { 8, 10 } };
+        using value_type = lz::detail::val_iterable_t<decltype(pairs)>;
+        REQUIRE(lz::equal(pairs, expected_pairs, [](value_type a, const std::vector<int>& b) { return lz::equal(a, b); }));
+        REQUIRE(calls == std::vector<int>(vec.size(), 1));
+    }
+
+    SUBCASE("Copies share results") {
+        auto copy = memoized;
+        REQUIRE(lz::equal(copy, expected));
+        REQUIRE(calls == std::vector<int>(vec.size(), 1));
+    }
+}
+
+TEST_CASE("Memoize map only computes dereferenced elements") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    int calls = 0;
+    auto counter = [&calls](int i) {
+        ++calls;
+        return i * 2;
+    };
+
+    SUBCASE("Random access") {
+        auto memoized = lz::memoize_map(vec, counter);
+        auto it = memoized.begin() + 3;
+        REQUIRE(*it == 8);
+        REQUIRE(memoized.begin()[3] == 8);
+        REQUIRE(calls == 1);
+    }
+
+    SUBCASE("Forward") {
+        std::forward_list<int> list = { 1, 2, 3, 4, 5 };
+        auto memoized = lz::memoize_map(list, counter);
+        static_assert(std::is_same<decltype(memoized.begin())::iterator_category, std::forward_iterator_tag>::value,
+                      "Should be forward");
+        auto it = std::next(memoized.begin(), 3);
+        REQUIRE(*it == 8);
+        REQUIRE(calls == 1);
+        REQUIRE(*std::next(memoized.begin(), 3) == 8);
+        REQUIRE(calls == 1);
+
+        std::vector<int> expected = { 2, 4, 6, 8, 10 };
+        REQUIRE(lz::equal(memoized, expected));
+        REQUIRE(lz::equal(memoized, expected));
+        REQUIRE(calls == 5);
+    }
+}
+
+TEST_CASE("Memoize map with sentinels") {
+    auto cstr = lz::c_string("Hello, World!");
+    auto memoized = lz::memoize_map(cstr, [](char c) { return static_cast<char>(std::toupper(c)); });
+    static_assert(!std::is_same<decltype(memoized.end()), decltype(memoized.begin())>::value, "Should be sentinels");
+    auto c_str_expected = lz::c_string("HELLO, WORLD!");
+    REQUIRE(lz::equal(memoized, c_str_expected));
+}
+
+TEST_CASE("Memoize map operator=(default_sentinel_t)") {
+    SUBCASE("forward") {
+        std::forward_list<int> a = { 1, 3, 5 };
+        auto memoized = lz::memoize_map(a, [](int i) { return i; });
+        auto common = make_sentinel_assign_op_tester(memoized);
+        auto expected = { 1, 3, 5 };
+        REQUIRE(lz::equal(common, expected));
+    }
+
+    SUBCASE("random access") {
+        auto a = lz::repeat(1, 3);
+        auto memoized = lz::memoize_map(a, [](int i) { return i; });
+        auto common = make_sentinel_assign_op_tester(memoized);
+        auto expected = { 1, 1, 1 };
+        test_procs::test_operator_plus(common, expected);
+        test_procs::test_operator_minus(common);
+    }
+}
+
+TEST_CASE("Memoize map binary operations") {
+    std::vector<std::string> vec = { "a", "bb", "ccc" };
+    auto memoized = lz::memoize_map(vec, [](const std::string& s) { return s + s; });
+    auto it = memoized.begin();
+
+    SUBCASE("Operator-> and operator*") {
+        REQUIRE(it->size() == 2);
+        REQUIRE(*it == "aa");
+        REQUIRE(&*it == &*memoized.begin());
+    }
+
+    SUBCASE("Operator== & operator!=") {
+        REQUIRE(it != memoized.end());
+        it = memoized.end();
+        REQUIRE(it == memoized.end());
+    }
+
+    SUBCASE("Operator+") {
+        std::vector<std::string> expected = { "aa", "bbbb", "cccccc" };
+        test_procs::test_operator_plus(memoized, expected);
+    }
+
+    SUBCASE("Operator-") {
+        test_procs::test_operator_minus(memoized);
+    }
+}
+
+TEST_CASE("Empty or one element memoize map") {
+    SUBCASE("Empty") {
+        std::vector<int> vec;
+        auto memoized = lz::memoize_map(vec, [](int i) { return i; });
+        REQUIRE(lz::empty(memoized));
+    }
+
+    SUBCASE("One element") {
+        std::vector<int> vec = { 1 };
+        auto memoized = lz::memoize_map(vec, [](int i) { return i; });
+        REQUIRE_FALSE(lz::empty(memoized));
+        REQUIRE(lz::has_one(memoized));
+        REQUIRE_FALSE(lz::has_many(memoized));
+    }
+}
+
+TEST_CASE("Memoize map to containers") {
+    std::vector<int> vec = { 1, 2, 3 };
+    auto memoized = vec | lz::memoize_map([](int i) { return i + 1; });
+    REQUIRE((memoized | lz::to<std::vector>()) == std::vector<int>{ 2, 3, 4 });
+    REQUIRE((memoized | lz::to<std::list<int>>()) == std::list<int>{ 2, 3, 4 });
+}
@@ -0,0 +1,145 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/algorithm/has_many.hpp>
+#include <Lz/algorithm/has_one.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/filter.hpp>
+#include <Lz/map.hpp>
+#include <Lz/parallel_map.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/range.hpp>
+#include <atomic>
+#include <chrono>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <doctest/doctest.h>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+TEST_CASE("parallel_map with sentinels") {
+    auto cstr = lz::c_string("Hello, World!");
+    auto upper = lz::parallel_map(cstr, [](char c) { return static_cast<char>(std::toupper(c)); }, 2, 4);
+    static_assert(std::is_same<decltype(upper.end()), lz::default_sentinel_t>::value, "Should be sentinel");
+    static_assert(std::is_same<lz::detail::iter_cat_t<decltype(upper.begin())>, std::input_iterator_tag>::value,
+                  "Should be input iterator");
+    auto expected = lz::c_string("HELLO, WORLD!");
+    REQUIRE(lz::equal(upper, expected));
+}
+
+TEST_CASE("parallel_map preserves input order") {
+    std::vector<int> vec = lz::range(1000) | lz::to<std::vector>();
+
+    SUBCASE("Full call") {
+        lz::parallel_map_iterable<std::vector<int>, std::function<int(int)>> mapped =
+            lz::parallel_map(vec, std::function<int(int)>([](int i) { return i * 2; }), 4, 8);
+        REQUIRE(mapped.size() == vec.size());
+        REQUIRE(lz::equal(mapped, vec | lz::map([](int i) { return i * 2; })));
+    }
+
+    SUBCASE("Piped") {
+        auto mapped = vec | lz::parallel_map([](int i) { return i * 2; }, 4, 8);
+        REQUIRE(lz::equal(mapped, vec | lz::map([](int i) { return i * 2; })));
+    }
+
+    SUBCASE("Default threads and window") {
+        auto mapped = vec | lz::parallel_map([](int i) { return std::to_string(i); });
+        auto expected = vec | lz::map([](int i) { return std::to_string(i); }) | lz::to<std::vector>();
+        REQUIRE((mapped | lz::to<std::vector>()) == expected);
+    }
+
+    SUBCASE("Window of one") {
+        auto mapped = vec | lz::parallel_map([](int i) { return i + 1; }, 3, 1);
+        REQUIRE(lz::equal(mapped, lz::range(1, 1001)));
+    }
+
+    SUBCASE("Unsized input") {
+        auto evens = lz::range(1000) | lz::filter([](int i) { return i % 2 == 0; });
+        auto mapped = evens | lz::parallel_map([](int i) { return i / 2; }, 4, 8);
+        REQUIRE(lz::equal(mapped, lz::range(500)));
+    }
+}
+
+TEST_CASE("parallel_map does not pull more than window elements ahead") {
+    std::atomic<int> pulled{ 0 };
+    auto counted = lz::range(100) | lz::map([&pulled](int i) {
+                       ++pulled;
+                       return i;
+                   });
+    auto mapped = counted | lz::parallel_map([](int i) { return i; }, 4, 5);
+
+    auto it = mapped.begin();
+    REQUIRE(*it == 0);
+    // Give the workers some time to fill the window
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    REQUIRE(pulled.load() <= 6);
+    ++it;
+    REQUIRE(*it == 1);
+}
+
+TEST_CASE("unordered_parallel_map yields every element once") {
+    std::vector<int> vec = lz::range(1000) | lz::to<std::vector>();
+
+    SUBCASE("Full call") {
+        lz::unordered_parallel_map_iterable<std::vector<int>, std::function<int(int)>> mapped =
+            lz::unordered_parallel_map(vec, std::function<int(int)>([](int i) { return i * 2; }), 4, 8);
+        auto result = mapped | lz::to<std::vector>();
+        std::sort(result.begin(), result.end());
+        REQUIRE(lz::equal(result, vec | lz::map([](int i) { return i * 2; })));
+    }
+
+    SUBCASE("Piped") {
+        auto result = vec | lz::unordered_parallel_map([](int i) { return i * 2; }, 3) | lz::to<std::vector>();
+        std::sort(result.begin(), result.end());
+        REQUIRE(lz::equal(result, vec | lz::map([](int i) { return i * 2; })));
+    }
+}
+
+TEST_CASE("parallel_map rethrows exceptions") {
+    std::vector<int> vec = lz::range(100) | lz::to<std::vector>();
+    auto mapped = vec | lz::parallel_map(
+                            [](int i) {
+                                if (i == 50) {
+                                    throw std::runtime_error("error");
+                                }
+                                return i;
+                            },
+                            4, 4);
+
+    bool thrown = false;
+    try {
+        for (auto it = mapped.begin(); it != mapped.end(); ++it) {
+        }
+    }
+    catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    REQUIRE(thrown);
+}
+
+TEST_CASE("parallel_map stops early when the iterator is destroyed") {
+    auto infinite = lz::range(std::numeric_limits<int>::max()) | lz::filter([](int) { return true; });
+    auto mapped = infinite | lz::parallel_map([](int i) { return i * 2; }, 2, 4);
+    auto it = mapped.begin();
+    REQUIRE(*it == 0);
+    ++it;
+    REQUIRE(*it == 2);
+}
+
+TEST_CASE("Empty or one element parallel_map") {
+    SUBCASE("Empty") {
+        std::vector<int> vec;
+        auto mapped = lz::parallel_map(vec, [](int i) { return i; }, 2);
+        REQUIRE(lz::empty(mapped));
+        REQUIRE_FALSE(lz::has_one(mapped));
+        REQUIRE_FALSE(lz::has_many(mapped));
+    }
+
+    SUBCASE("One element") {
+        std::vector<int> vec = { 1 };
+        auto mapped = lz::parallel_map(vec, [](int i) { return i * 3; }, 2);
+        REQUIRE_FALSE(lz::empty(mapped));
+        REQUIRE(lz::has_one(mapped));
+        REQUIRE_FALSE(lz::has_many(mapped));
+        REQUIRE(*mapped.begin() == 3);
+    }
+}
@@ -0,0 +1,206 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/csv.hpp>
+#include <Lz/map.hpp>
+#include <Lz/parse.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/split.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <cpp-lazy-ut-helper/test_procs.hpp>
+#include <cpp-lazy-ut-helper/ut_helper.hpp>
+#include <doctest/doctest.h>
+
+#ifdef LZ_HAS_CXX_11
+#define LZ_PARSE(T) lz::parse<T>{}
+#else
+#define LZ_PARSE(T) lz::parse<T>
+#endif
+
+namespace {
+template<class T>
+lz::optional<T> parse_one(const lz::string_view str) {
+    const std::vector<lz::string_view> strings = { str };
+    return *LZ_PARSE(T)(strings).begin();
+}
+
+template<class T>
+bool parses_to(const lz::string_view str, const T expected) {
+    const auto parsed = parse_one<T>(str);
+    return parsed.has_value() && !(*parsed < expected) && !(expected < *parsed);
+}
+
+bool parses_close_to(const lz::string_view str, const double expected) {
+    const auto parsed = parse_one<double>(str);
+    return parsed.has_value() && *parsed == doctest::Approx(expected);
+}
+} // namespace
+
+TEST_CASE("parse basic functionality") {
+    SUBCASE("Integers") {
+        std::vector<lz::string_view> strings = { "1", "-2", "x", "300" };
+        lz::parse_iterable<int, std::vector<lz::string_view>> parsed = LZ_PARSE(int)(strings);
+        std::vector<lz::optional<int>> expected = { 1, -2, lz::nullopt, 300 };
+        REQUIRE(parsed.size() == 4);
+        REQUIRE(lz::equal(parsed, expected));
+    }
+
+    SUBCASE("Bounds") {
+        REQUIRE(parses_to<std::int8_t>("-128", std::numeric_limits<std::int8_t>::min()));
+        REQUIRE(parses_to<std::int8_t>("127", std::numeric_limits<std::int8_t>::max()));
+        REQUIRE_FALSE(parse_one<std::int8_t>("128").has_value());
+        REQUIRE_FALSE(parse_one<std::int8_t>("-129").has_value());
+        REQUIRE(parses_to<std::uint8_t>("255", std::numeric_limits<std::uint8_t>::max()));
+        REQUIRE_FALSE(parse_one<std::uint8_t>("256").has_value());
+        REQUIRE(parses_to<std::int64_t>("-9223372036854775808", std::numeric_limits<std::int64_t>::min()));
+        REQUIRE(parses_to<std::int64_t>("9223372036854775807", std::numeric_limits<std::int64_t>::max()));
+        REQUIRE_FALSE(parse_one<std::int64_t>("9223372036854775808").has_value());
+        REQUIRE(parses_to<std::uint64_t>("18446744073709551615", std::numeric_limits<std::uint64_t>::max()));
+        REQUIRE_FALSE(parse_one<std::uint64_t>("18446744073709551616").has_value());
+        REQUIRE_FALSE(parse_one<std::uint64_t>("99999999999999999999999999").has_value());
+    }
+
+    SUBCASE("Long digit sequences") {
+        REQUIRE(parses_to<std::uint64_t>("12345678", 12345678));
+        REQUIRE(parses_to<std::uint64_t>("1234567890123456", 1234567890123456));
+        REQUIRE(parses_to<std::uint64_t>("00000000000000000000000000042", 42));
+        REQUIRE(parses_to<std::int64_t>("-1234567890123456789", -1234567890123456789));
+        REQUIRE_FALSE(parse_one<std::uint64_t>("1234567x12345678").has_value());
+        REQUIRE_FALSE(parse_one<std::uint64_t>("12345678/").has_value());
+        REQUIRE_FALSE(parse_one<std::uint64_t>("1234567:").has_value());
+    }
+
+    SUBCASE("Invalid integers") {
+        REQUIRE_FALSE(parse_one<int>("").has_value());
+        REQUIRE_FALSE(parse_one<int>("-").has_value());
+        REQUIRE_FALSE(parse_one<int>("+1").has_value());
+        REQUIRE_FALSE(parse_one<int>(" 1").has_value());
+        REQUIRE_FALSE(parse_one<int>("1 ").has_value());
+        REQUIRE_FALSE(parse_one<int>("1.5").has_value());
+        REQUIRE_FALSE(parse_one<unsigned>("-1").has_value());
+        REQUIRE(parses_to<int>("-0", 0));
+    }
+
+    SUBCASE("Floating point") {
+        REQUIRE(parses_close_to("1.5", 1.5));
+        REQUIRE(parses_close_to("-0.25", -0.25));
+        REQUIRE(parses_close_to("3", 3.0));
+        REQUIRE(parses_close_to(".5", 0.5));
+        REQUIRE(parses_close_to("5.", 5.0));
+        REQUIRE(parses_close_to("1e3", 1000.0));
+        REQUIRE(parses_close_to("2.5E-3", 0.0025));
+        REQUIRE(parses_close_to("1e+2", 100.0));
+        REQUIRE(parses_close_to("123456789012345678901234567890", 1.2345678901234568e29));
+        REQUIRE(parses_close_to("0.000000000000000000000000000001", 1e-30));
+        REQUIRE(parses_to<double>("0.1", 0.1));
+        REQUIRE(parses_to<double>("1.7976931348623157e308", std::numeric_limits<double>::max()));
+        REQUIRE(parses_to<float>("0.1", 0.1f));
+        REQUIRE(parses_to<float>("16777217", 16777216.0f));
+    }
+
+    SUBCASE("Special floating point values") {
+        REQUIRE(parses_to<double>("inf", std::numeric_limits<double>::infinity()));
+        REQUIRE(parses_to<double>("-Infinity", -std::numeric_limits<double>::infinity()));
+        const auto nan = parse_one<double>("nan");
+        REQUIRE(nan.has_value());
+        REQUIRE(std::isnan(*nan));
+    }
+
+    SUBCASE("Invalid floating point") {
+        REQUIRE_FALSE(parse_one<double>("").has_value());
+        REQUIRE_FALSE(parse_one<double>("-").has_value());
+        REQUIRE_FALSE(parse_one<double>(".").has_value());
+        REQUIRE_FALSE(parse_one<double>("+1.0").has_value());
+        REQUIRE_FALSE(parse_one<double>("1e").has_value());
+        REQUIRE_FALSE(parse_one<double>("1.0x").has_value());
+        REQUIRE_FALSE(parse_one<double>("infinite").has_value());
+        REQUIRE_FALSE(parse_one<double>("1e999").has_value());
+    }
+
+    SUBCASE("Strings") {
+        std::vector<std::string> strings = { "10", "20" };
+        auto parsed = strings | LZ_PARSE(unsigned);
+        std::vector<lz::optional<unsigned>> expected = { 10u, 20u };
+        REQUIRE(lz::equal(parsed, expected));
+    }
+
+    SUBCASE("Split") {
+        std::string str = "1,2,,4";
+        auto parsed = str | lz::sv_split(',') | LZ_PARSE(long);
+        std::vector<lz::optional<long>> expected = { 1L, 2L, lz::nullopt, 4L };
+        REQUIRE(lz::equal(parsed, expected));
+    }
+
+    SUBCASE("Csv fields") {
+        std::string buffer = "x,y\n1,\"2\"\n3,\"4\"\"\"";
+        auto records = lz::csv(buffer);
+        auto second = records.begin()[1] | LZ_PARSE(int);
+        std::vector<lz::optional<int>> expected = { 1, 2 };
+        REQUIRE(lz::equal(second, expected));
+        auto third = records.begin()[2] | LZ_PARSE(int);
+        expected = { 3, lz::nullopt };
+        REQUIRE(lz::equal(third, expected));
+    }
+}
+
+TEST_CASE("Empty or one element parse") {
+    SUBCASE("Empty") {
+        std::vector<lz::string_view> strings;
+        auto parsed = LZ_PARSE(int)(strings);
+        REQUIRE(lz::empty(parsed));
+        REQUIRE(parsed.size() == 0);
+    }
+
+    SUBCASE("One element") {
+        std::vector<lz::string_view> strings = { "42" };
+        auto parsed = LZ_PARSE(int)(strings);
+        REQUIRE(parsed.size() == 1);
+        REQUIRE(**parsed.begin() == 42);
+    }
+}
+
+TEST_CASE("parse binary operations") {
+    std::vector<lz::string_view> strings = { "1", "2", "3" };
+    auto parsed = LZ_PARSE(int)(strings);
+
+    SUBCASE("Operator++") {
+        auto it = parsed.begin();
+        REQUIRE(**it == 1);
+        ++it;
+        REQUIRE(**it == 2);
+    }
+
+    SUBCASE("Operator--") {
+        auto it = parsed.end();
+        --it;
+        REQUIRE(**it == 3);
+    }
+
+    SUBCASE("Operator+") {
+        std::vector<lz::optional<int>> expected = { 1, 2, 3 };
+        test_procs::test_operator_plus(parsed, expected);
+    }
+
+    SUBCASE("Operator-") {
+        test_procs::test_operator_minus(parsed);
+    }
+}
+
+TEST_CASE("parse to containers") {
+    std::string str = "1 2 3";
+    auto parsed = str | lz::sv_split(' ') | LZ_PARSE(int) | lz::map([](lz::optional<int> i) { return i.value_or(0); });
+
+    SUBCASE("To array") {
+        std::array<int, 3> expected = { 1, 2, 3 };
+        REQUIRE((parsed | lz::to<std::array<int, 3>>()) == expected);
+    }
+
+    SUBCASE("To vector") {
+        std::vector<int> expected = { 1, 2, 3 };
+        REQUIRE((parsed | lz::to<std::vector>()) == expected);
+    }
+
+    SUBCASE("To other container using to<>()") {
+        std::list<int> expected = { 1, 2, 3 };
+        REQUIRE((parsed | lz::to<std::list<int>>()) == expected);
+    }
+}
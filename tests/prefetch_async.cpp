@@ -0,0 +1,117 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/algorithm/has_many.hpp>
+#include <Lz/algorithm/has_one.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/filter.hpp>
+#include <Lz/generate_while.hpp>
+#include <Lz/map.hpp>
+#include <Lz/prefetch_async.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/range.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <doctest/doctest.h>
+#include <limits>
+#include <stdexcept>
+
+TEST_CASE("prefetch_async with sentinels") {
+    auto cstr = lz::c_string("Hello, World!");
+    auto prefetched = lz::prefetch_async(cstr, 4);
+    static_assert(std::is_same<decltype(prefetched.end()), lz::default_sentinel_t>::value, "Should be sentinel");
+    static_assert(std::is_same<lz::detail::iter_cat_t<decltype(prefetched.begin())>, std::input_iterator_tag>::value,
+                  "Should be input iterator");
+    REQUIRE(lz::equal(prefetched, lz::c_string("Hello, World!")));
+}
+
+TEST_CASE("prefetch_async yields all elements in order") {
+    std::vector<int> vec = lz::range(10000) | lz::to<std::vector>();
+
+    SUBCASE("Full call") {
+        lz::prefetch_async_iterable<std::vector<int>> prefetched = lz::prefetch_async(vec, 16);
+        REQUIRE(prefetched.size() == vec.size());
+        REQUIRE(lz::equal(prefetched, vec));
+    }
+
+    SUBCASE("Piped with capacity") {
+        auto prefetched = vec | lz::prefetch_async(3);
+        REQUIRE(lz::equal(prefetched, vec));
+    }
+
+    SUBCASE("Piped with default capacity") {
+        auto prefetched = vec | lz::prefetch_async;
+        REQUIRE(lz::equal(prefetched, vec));
+    }
+
+    SUBCASE("Capacity of one") {
+        auto prefetched = vec | lz::prefetch_async(1);
+        REQUIRE(lz::equal(prefetched, vec));
+    }
+
+    SUBCASE("In the middle of a pipeline") {
+        auto result = vec | lz::filter([](int i) { return i % 2 == 0; }) | lz::prefetch_async(8) |
+                      lz::map([](int i) { return std::to_string(i); }) | lz::to<std::vector>();
+        auto expected = vec | lz::filter([](int i) { return i % 2 == 0; }) | lz::map([](int i) { return std::to_string(i); }) |
+                        lz::to<std::vector>();
+        REQUIRE(result == expected);
+    }
+}
+
+TEST_CASE("prefetch_async with generate_while producer") {
+    int counter = 0;
+    auto producer = lz::generate_while([&counter]() {
+        const int current = counter++;
+        return std::make_pair(current, current < 100);
+    });
+    auto prefetched = producer | lz::prefetch_async(8);
+    REQUIRE(lz::equal(prefetched, lz::range(100)));
+}
+
+TEST_CASE("prefetch_async rethrows exceptions") {
+    auto throwing = lz::range(100) | lz::map([](int i) {
+                        if (i == 50) {
+                            throw std::runtime_error("error");
+                        }
+                        return i;
+                    });
+    auto prefetched = throwing | lz::prefetch_async(4);
+
+    int count = 0;
+    bool thrown = false;
+    try {
+        for (auto it = prefetched.begin(); it != prefetched.end(); ++it) {
+            ++count;
+        }
+    }
+    catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    REQUIRE(thrown);
+    REQUIRE(count == 50);
+}
+
+TEST_CASE("prefetch_async stops early when the iterator is destroyed") {
+    auto infinite = lz::range(std::numeric_limits<int>::max()) | lz::filter([](int) { return true; });
+    auto prefetched = infinite | lz::prefetch_async(4);
+    auto it = prefetched.begin();
+    REQUIRE(*it == 0);
+    ++it;
+    REQUIRE(*it == 1);
+}
+
+TEST_CASE("Empty or one element prefetch_async") {
+    SUBCASE("Empty") {
+        std::vector<int> vec;
+        auto prefetched = lz::prefetch_async(vec);
+        REQUIRE(lz::empty(prefetched));
+        REQUIRE_FALSE(lz::has_one(prefetched));
+        REQUIRE_FALSE(lz::has_many(prefetched));
+    }
+
+    SUBCASE("One element") {
+        std::vector<int> vec = { 1 };
+        auto prefetched = lz::prefetch_async(vec);
+        REQUIRE_FALSE(lz::empty(prefetched));
+        REQUIRE(lz::has_one(prefetched));
+        REQUIRE_FALSE(lz::has_many(prefetched));
+    }
+}
@@ -1,6 +1,8 @@
 #include <Lz/algorithm/empty.hpp>
 #include <Lz/algorithm/all_of.hpp>
+#include <Lz/algorithm/copy.hpp>
 #include <Lz/algorithm/equal.hpp>
+#include <Lz/algorithm/for_each.hpp>
 #include <Lz/algorithm/has_many.hpp>
 #include <Lz/algorithm/has_one.hpp>
 #include <Lz/map.hpp>
@@ -171,3 +173,142 @@ TEST_CASE("random_iterable to containers") {
         REQUIRE(actual.size() == size);
     }
 }
+
+template<class Engine>
+void test_engine_block_generation(Engine engine) {
+    Engine copy = engine;
+    std::vector<typename Engine::result_type> block(37);
+    engine.generate(block.begin(), block.end());
+    for (const auto value : block) {
+        REQUIRE(value == copy());
+    }
+    REQUIRE(engine == copy);
+}
+
+template<class Engine>
+void test_engine_discard(Engine engine) {
+    Engine copy = engine;
+    engine.discard(1001);
+    for (int i = 0; i < 1001; ++i) {
+        copy();
+    }
+    REQUIRE(engine == copy);
+    REQUIRE(engine() == copy());
+}
+
+TEST_CASE("Random engines") {
+    SUBCASE("Engines are deterministic and can be reseeded") {
+        lz::xoshiro256ss xoshiro(42);
+        lz::pcg64 pcg(42);
+        lz::philox4x32 philox(42);
+        const auto first_xoshiro = xoshiro();
+        const auto first_pcg = pcg();
+        const auto first_philox = philox();
+        REQUIRE(first_xoshiro != xoshiro());
+        REQUIRE(first_pcg != pcg());
+        REQUIRE(first_philox != philox());
+
+        xoshiro.seed(42);
+        pcg.seed(42);
+        philox.seed(42);
+        REQUIRE(first_xoshiro == xoshiro());
+        REQUIRE(first_pcg == pcg());
+        REQUIRE(first_philox == philox());
+
+        REQUIRE(lz::xoshiro256ss(1) != lz::xoshiro256ss(2));
+        REQUIRE(lz::pcg64(1) != lz::pcg64(2));
+        REQUIRE(lz::pcg64(1, 1)() != lz::pcg64(1, 2)());
+        REQUIRE(lz::philox4x32(1)() != lz::philox4x32(2)());
+    }
+
+    SUBCASE("Seed sequences") {
+        std::seed_seq seq{ 1, 2, 3 };
+        lz::xoshiro256ss xoshiro(seq);
+        lz::pcg64 pcg(seq);
+        lz::philox4x32 philox(seq);
+        std::seed_seq same{ 1, 2, 3 };
+        REQUIRE(xoshiro == lz::xoshiro256ss(same));
+        REQUIRE(pcg == lz::pcg64(same));
+        REQUIRE(philox == lz::philox4x32(same));
+    }
+
+    SUBCASE("Philox known answers") {
+        const auto zero = lz::philox4x32::block(0, 0, 0);
+        REQUIRE(zero.words[0] == 0x6627e8d5u);
+        REQUIRE(zero.words[1] == 0xe169c58du);
+        REQUIRE(zero.words[2] == 0xbc57ac4cu);
+        REQUIRE(zero.words[3] == 0x9b00dbd8u);
+
+        const auto ones = lz::philox4x32::block(~std::uint64_t{}, ~std::uint64_t{}, ~std::uint64_t{});
+        REQUIRE(ones.words[0] == 0x408f276du);
+        REQUIRE(ones.words[1] == 0x41c83b0eu);
+        REQUIRE(ones.words[2] == 0xa20bc7c6u);
+        REQUIRE(ones.words[3] == 0x6d5451fdu);
+
+        lz::philox4x32 engine(0);
+        REQUIRE(engine() == 0x6627e8d5u);
+        REQUIRE(engine() == 0xe169c58du);
+    }
+
+    SUBCASE("Block generation") {
+        test_engine_block_generation(lz::xoshiro256ss(7));
+        test_engine_block_generation(lz::pcg64(7, 3));
+        lz::philox4x32 philox(7);
+        philox.discard(2); // Start in the middle of a block
+        test_engine_block_generation(philox);
+    }
+
+    SUBCASE("Discard") {
+        test_engine_discard(lz::xoshiro256ss(7));
+        test_engine_discard(lz::pcg64(7, 3));
+        test_engine_discard(lz::philox4x32(7));
+        lz::philox4x32 philox(7);
+        philox();
+        test_engine_discard(philox);
+    }
+
+    SUBCASE("Jump") {
+        lz::xoshiro256ss engine(7);
+        lz::xoshiro256ss jumped = engine;
+        jumped.jump();
+        REQUIRE(engine != jumped);
+        REQUIRE(engine() != jumped());
+    }
+}
+
+TEST_CASE("random_iterable bulk copy") {
+    std::uniform_real_distribution<double> dist(-1., 1.);
+    lz::xoshiro256ss engine(5);
+    lz::xoshiro256ss copy = engine;
+    auto random = lz::random(dist, engine, 100);
+    static_assert(lz::detail::has_copy_to<decltype(random), double*>::value, "Should have a bulk path");
+
+    SUBCASE("Same values as iterating") {
+        const auto bulk = random | lz::to<std::vector>();
+        std::vector<double> iterated;
+        lz::for_each(lz::random(dist, copy, 100), [&iterated](double value) { iterated.push_back(value); });
+        REQUIRE(bulk == iterated);
+        REQUIRE(engine == copy);
+        REQUIRE(lz::all_of(bulk, [](double value) { return value >= -1. && value < 1.; }));
+    }
+
+    SUBCASE("lz::copy and lz::to<std::array> use the bulk path") {
+        std::array<double, 100> copied{};
+        lz::copy(random, copied.begin());
+        const auto array = lz::random(dist, copy, 100) | lz::to<std::array<double, 100>>();
+        REQUIRE(copied == array);
+    }
+
+    SUBCASE("Parallel execution converts on the calling thread") {
+        static_assert(!lz::detail::is_parallelizable<decltype(random)>::value, "Iterators share the engine");
+        const auto parallel = random | lz::to<std::vector>(lz::parallel_execution(4, 1));
+        const auto serial = lz::random(dist, copy, 100) | lz::to<std::vector>();
+        REQUIRE(parallel == serial);
+        REQUIRE(engine == copy);
+    }
+
+    SUBCASE("Empty") {
+        REQUIRE((lz::random(dist, engine, 0) | lz::to<std::vector>()).empty());
+        REQUIRE(engine == copy);
+    }
+}
@@ -2,6 +2,7 @@
 #include <Lz/algorithm/equal.hpp>
 #include <Lz/algorithm/has_many.hpp>
 #include <Lz/algorithm/has_one.hpp>
+#include <Lz/map.hpp>
 #include <Lz/procs/to.hpp>
 #include <Lz/regex_split.hpp>
 #include <cpp-lazy-ut-helper/pch.hpp>
@@ -119,3 +120,106 @@ TEST_CASE("regex_split_iterable to containers") {
         REQUIRE(lz::equal(list, expected));
     }
 }
+
+namespace {
+template<class Regex>
+std::vector<std::string> split_to_strings(const std::string& s, const Regex& r) {
+    return lz::regex_split(s, r) | lz::map([](lz::string_view v) { return std::string(v.data(), v.size()); }) |
+           lz::to<std::vector>();
+}
+
+struct char_matcher {
+    using char_type = char;
+
+    char c;
+
+    std::pair<const char*, const char*> find(const char* first, const char* last) const {
+        const auto it = std::find(first, last, c);
+        return { it, it == last ? last : it + 1 };
+    }
+};
+} // namespace
+
+TEST_CASE("regex_split with matcher") {
+    SUBCASE("Same as std::regex") {
+        const std::vector<std::string> patterns = { R"(\s+)", ",", R"(\s*[,;]\s*)", "ab|a", "[0-9]{2,3}", R"(\d+|x)", "(ab)+" };
+        const std::vector<std::string> inputs = { "",          " ",          "a",           "  hello   world  ", "a, b ;c,,d; ",
+                                                  ",,a,b,,",   "aababab a", "1 12 123 1234 12345x", "xyx" };
+        for (const auto& pattern : patterns) {
+            const std::regex std_regex(pattern);
+            const lz::dfa_regex dfa(pattern);
+            for (const auto& input : inputs) {
+                INFO("pattern: " << pattern << ", input: " << input);
+                REQUIRE(split_to_strings(input, dfa) == split_to_strings(input, std_regex));
+            }
+        }
+    }
+
+    SUBCASE("Starting and ending with delimiter") {
+        lz::dfa_regex r(R"(\s+)");
+        std::string s = "    Hello, world! How are you?    ";
+        lz::matcher_split_iterable<lz::dfa_regex> splitter = lz::regex_split(s, r);
+        std::vector<std::string> expected = { "Hello,", "world!", "How", "are", "you?" };
+        REQUIRE(lz::equal(splitter, expected));
+        REQUIRE(lz::equal(s | lz::regex_split(r), expected));
+    }
+
+    SUBCASE("Empty tokens in the middle") {
+        lz::dfa_regex r(",");
+        std::string s = ",a,,b,";
+        std::vector<std::string> expected = { "a", "", "b" };
+        REQUIRE(lz::equal(lz::regex_split(s, r), expected));
+    }
+
+    SUBCASE("Leftmost longest") {
+        lz::dfa_regex r("a|ab|abc");
+        std::string s = "1abc2ab3a4";
+        std::vector<std::string> expected = { "1", "2", "3", "4" };
+        REQUIRE(lz::equal(lz::regex_split(s, r), expected));
+    }
+
+    SUBCASE("Classes and escapes") {
+        lz::dfa_regex r(R"([^\w.]+)");
+        std::string s = "a.b - c_d!!e";
+        std::vector<std::string> expected = { "a.b", "c_d", "e" };
+        REQUIRE(lz::equal(lz::regex_split(s, r), expected));
+        const std::string all = " -!";
+        REQUIRE(r.matches(all.data(), all.data() + all.size()));
+        const std::string none = "a";
+        REQUIRE_FALSE(r.matches(none.data(), none.data() + none.size()));
+    }
+
+    SUBCASE("Custom matcher") {
+        char_matcher matcher{ ';' };
+        std::string s = "a;b;;c";
+        std::vector<std::string> expected = { "a", "b", "", "c" };
+        REQUIRE(lz::equal(lz::regex_split(s, matcher), expected));
+    }
+
+    SUBCASE("Operator=(default_sentinel_t)") {
+        std::string s = "hello, world! This is a test.";
+        lz::dfa_regex r("\\s+");
+        auto splitted = lz::regex_split(s, r);
+        auto common = make_sentinel_assign_op_tester(splitted);
+        auto expected = { "hello,", "world!", "This", "is", "a", "test." };
+        REQUIRE(lz::equal(common, expected));
+    }
+
+    SUBCASE("Empty or one element") {
+        lz::dfa_regex r(R"(\s+)");
+        std::string empty;
+        REQUIRE(lz::empty(lz::regex_split(empty, r)));
+        std::string one = "Hello ";
+        REQUIRE(lz::has_one(lz::regex_split(one, r)));
+        REQUIRE(lz::empty(lz::matcher_split_iterable<lz::dfa_regex>{}));
+    }
+
+    SUBCASE("Invalid patterns") {
+        REQUIRE_THROWS_AS(lz::dfa_regex("(a"), std::regex_error);
+        REQUIRE_THROWS_AS(lz::dfa_regex("a{2"), std::regex_error);
+        REQUIRE_THROWS_AS(lz::dfa_regex("[a"), std::regex_error);
+        REQUIRE_THROWS_AS(lz::dfa_regex("*"), std::regex_error);
+        REQUIRE_THROWS_AS(lz::dfa_regex("a*"), std::invalid_argument);
+        REQUIRE_THROWS_AS(lz::dfa_regex("^a"), std::invalid_argument);
+    }
+}
@@ -0,0 +1,90 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/range.hpp>
+#include <Lz/sample.hpp>
+#include <algorithm>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <doctest/doctest.h>
+#include <forward_list>
+#include <set>
+
+TEST_CASE("Sample basic functionality") {
+    std::vector<int> vec = lz::range(1000) | lz::to<std::vector>();
+    auto sample = vec | lz::sample(10, 42);
+    static_assert(lz::detail::is_ra<decltype(sample.begin())>::value, "Should be random access");
+
+    REQUIRE(sample.size() == 10);
+    const std::set<int> unique(sample.begin(), sample.end());
+    REQUIRE(unique.size() == 10);
+    REQUIRE(std::all_of(sample.begin(), sample.end(), [](int i) { return i >= 0 && i < 1000; }));
+
+    SUBCASE("Same seed, same sample") {
+        REQUIRE((lz::sample(vec, 10, 42) | lz::to<std::vector>()) == (sample | lz::to<std::vector>()));
+        REQUIRE((lz::sample(vec, 10, 43) | lz::to<std::vector>()) != (sample | lz::to<std::vector>()));
+    }
+
+    SUBCASE("Copies share the sample") {
+        auto copy = sample;
+        REQUIRE(copy.begin() == sample.begin());
+    }
+
+    SUBCASE("Random seed") {
+        auto random = lz::sample(vec, 10);
+        REQUIRE(random.size() == 10);
+        auto piped = vec | lz::sample(10);
+        REQUIRE(piped.size() == 10);
+    }
+}
+
+TEST_CASE("Sample from forward and input iterables") {
+    SUBCASE("Forward") {
+        std::forward_list<int> list = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        auto sample = lz::sample(list, 3, 1);
+        REQUIRE(sample.size() == 3);
+        REQUIRE(std::all_of(sample.begin(), sample.end(), [](int i) { return i >= 1 && i <= 10; }));
+    }
+
+    SUBCASE("Input with sentinel") {
+        auto sample = lz::c_string("hello world") | lz::sample(4, 1);
+        REQUIRE(sample.size() == 4);
+        const std::string str = "hello world";
+        REQUIRE(std::all_of(sample.begin(), sample.end(), [&str](char c) { return str.find(c) != std::string::npos; }));
+    }
+}
+
+TEST_CASE("Sample is uniform") {
+    // Every element should be picked about 2000 * 10 / 100 = 200 times
+    std::vector<int> counts(100);
+    for (std::uint64_t seed = 0; seed < 2000; ++seed) {
+        for (const int i : lz::range(100) | lz::sample(10, seed)) {
+            ++counts[static_cast<std::size_t>(i)];
+        }
+    }
+    REQUIRE(*std::min_element(counts.begin(), counts.end()) > 120);
+    REQUIRE(*std::max_element(counts.begin(), counts.end()) < 280);
+}
+
+TEST_CASE("Empty or one element sample") {
+    SUBCASE("Empty input") {
+        std::vector<int> vec;
+        lz::sample_iterable<std::vector<int>> sample = lz::sample(vec, 3, 1);
+        REQUIRE(lz::empty(sample));
+    }
+
+    SUBCASE("k is 0") {
+        std::vector<int> vec = { 1, 2, 3 };
+        REQUIRE(lz::empty(lz::sample(vec, 0, 1)));
+    }
+
+    SUBCASE("Less elements than k") {
+        std::vector<int> vec = { 1, 2, 3 };
+        auto sample = lz::sample(vec, 5, 1);
+        REQUIRE((sample | lz::to<std::vector>()) == vec);
+    }
+
+    SUBCASE("Default constructed") {
+        lz::sample_iterable<std::vector<int>> sample;
+        REQUIRE(lz::empty(sample));
+    }
+}
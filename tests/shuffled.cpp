@@ -0,0 +1,86 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/range.hpp>
+#include <Lz/reverse.hpp>
+#include <Lz/shuffled.hpp>
+#include <algorithm>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <cpp-lazy-ut-helper/test_procs.hpp>
+#include <doctest/doctest.h>
+#include <set>
+
+TEST_CASE("Shuffled basic functionality") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    auto shuffled = vec | lz::shuffled(42);
+    static_assert(lz::detail::is_ra<decltype(shuffled.begin())>::value, "Should be random access");
+    static_assert(std::is_same<decltype(shuffled.begin()), decltype(shuffled.end())>::value, "Should not be sentinelled");
+
+    const auto expected = shuffled | lz::to<std::vector>();
+    REQUIRE(shuffled.size() == vec.size());
+    REQUIRE(std::is_permutation(expected.begin(), expected.end(), vec.begin()));
+
+    SUBCASE("Same seed, same order") {
+        REQUIRE(lz::equal(lz::shuffled(vec, 42), expected));
+        REQUIRE(lz::equal(shuffled | lz::reverse, expected | lz::reverse));
+        REQUIRE_FALSE(lz::equal(lz::shuffled(vec, 43), expected));
+    }
+
+    SUBCASE("operator[]") {
+        auto begin = shuffled.begin();
+        for (std::ptrdiff_t i = 9; i >= 0; --i) {
+            REQUIRE(begin[i] == expected[static_cast<std::size_t>(i)]);
+        }
+    }
+
+    SUBCASE("Operator+ and operator-") {
+        test_procs::test_operator_plus(shuffled, expected);
+        test_procs::test_operator_minus(shuffled);
+    }
+
+    SUBCASE("Mutable references") {
+        *shuffled.begin() = 100;
+        REQUIRE(std::count(vec.begin(), vec.end(), 100) == 1);
+    }
+}
+
+TEST_CASE("Shuffled is a permutation for every size") {
+    for (int size = 0; size <= 300; ++size) {
+        auto shuffled = lz::range(size) | lz::shuffled(static_cast<std::uint64_t>(size));
+        auto values = shuffled | lz::to<std::vector>();
+        std::sort(values.begin(), values.end());
+        REQUIRE(lz::equal(values, lz::range(size)));
+    }
+}
+
+TEST_CASE("Shuffled huge index space") {
+    auto shuffled = lz::range(std::int64_t{ 1000000000 }) | lz::shuffled(7);
+    REQUIRE(shuffled.size() == 1000000000);
+    std::set<std::int64_t> seen;
+    auto begin = shuffled.begin();
+    for (std::int64_t i = 0; i < 1000; ++i) {
+        const auto value = begin[i * 999999];
+        REQUIRE(value >= 0);
+        REQUIRE(value < 1000000000);
+        REQUIRE(seen.insert(value).second);
+    }
+}
+
+TEST_CASE("Empty or one element shuffled") {
+    SUBCASE("Empty") {
+        std::vector<int> vec;
+        lz::shuffled_iterable<std::vector<int>> shuffled = lz::shuffled(vec, 1);
+        REQUIRE(lz::empty(shuffled));
+        REQUIRE(shuffled.size() == 0);
+        REQUIRE(shuffled.begin() == shuffled.end());
+    }
+
+    SUBCASE("One element") {
+        std::vector<int> vec = { 1 };
+        auto shuffled = lz::shuffled(vec, 1);
+        REQUIRE(shuffled.size() == 1);
+        REQUIRE(*shuffled.begin() == 1);
+        REQUIRE(shuffled.begin() + 1 == shuffled.end());
+    }
+}
@@ -527,3 +527,55 @@ TEST_CASE("One element splitter to containers") {
         REQUIRE(actual == expected);
     }
 }
+
+TEST_CASE("Split on any of compile time delimiters") {
+#ifdef LZ_HAS_CXX_11
+#define LZ_SPLIT_ANY(...) lz::split_any<__VA_ARGS__>{}
+#else
+#define LZ_SPLIT_ANY(...) lz::split_any<__VA_ARGS__>
+#endif
+
+    SUBCASE("Multiple delimiters") {
+        const std::string to_split = "Hello world\ttest\n123";
+        lz::split_any_iterable<const std::string, ' ', '\t', '\n'> splitter = LZ_SPLIT_ANY(' ', '\t', '\n')(to_split);
+        std::vector<lz::string_view> expected = { "Hello", "world", "test", "123" };
+        REQUIRE(lz::equal(splitter, expected));
+    }
+
+    SUBCASE("Same as lz::sv_split with one delimiter") {
+        const std::vector<std::string> inputs = { "", ",", ",,", "a", "a,", ",a", "a,,b", ",a,b,", "abc,def,,ghi,," };
+        for (const auto& input : inputs) {
+            INFO("input: " << input);
+            REQUIRE(lz::equal(input | LZ_SPLIT_ANY(','), lz::sv_split(input, ',')));
+        }
+    }
+
+    SUBCASE("Starting and ending with delimiters") {
+        const std::string to_split = " ;a; b;";
+        auto splitter = to_split | LZ_SPLIT_ANY(' ', ';');
+        std::vector<lz::string_view> expected = { "", "", "a", "", "b", "" };
+        REQUIRE(lz::equal(splitter, expected));
+    }
+
+    SUBCASE("Characters above 127") {
+        const std::string to_split = "a\xff" "b\x80" "c";
+        auto splitter = to_split | LZ_SPLIT_ANY('\xff', '\x80');
+        std::vector<lz::string_view> expected = { "a", "b", "c" };
+        REQUIRE(lz::equal(splitter, expected));
+    }
+
+    SUBCASE("Empty") {
+        const std::string to_split;
+        REQUIRE(lz::empty(to_split | LZ_SPLIT_ANY(' ', ',')));
+    }
+
+    SUBCASE("Operator=(default_sentinel_t)") {
+        const std::string to_split = "hello, world;this";
+        auto splitted = to_split | LZ_SPLIT_ANY(',', ';');
+        auto common = make_sentinel_assign_op_tester(splitted);
+        auto expected = { "hello", " world", "this" };
+        REQUIRE(lz::equal(common, expected));
+    }
+
+#undef LZ_SPLIT_ANY
+}
@@ -0,0 +1,63 @@
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/enumerate.hpp>
+#include <Lz/inclusive_scan.hpp>
+#include <Lz/map.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/reverse.hpp>
+#include <Lz/traits/static_size.hpp>
+#include <Lz/zip.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <doctest/doctest.h>
+
+namespace {
+struct square {
+    int operator()(int i) const {
+        return i * i;
+    }
+};
+} // namespace
+
+TEST_CASE("Static size of arrays") {
+    static_assert(lz::static_size<std::array<int, 4>>::value == 4, "std::array has a static size");
+    static_assert(lz::static_size<const std::array<int, 4>&>::value == 4, "std::array has a static size");
+    static_assert(lz::static_size<int[3]>::value == 3, "C arrays have a static size");
+    static_assert(lz::static_size<const int(&)[3]>::value == 3, "C arrays have a static size");
+    static_assert(!lz::has_static_size<std::vector<int>>::value, "vector has no static size");
+    static_assert(lz::has_static_size<std::array<int, 0>>::value, "Empty std::array has a static size");
+}
+
+TEST_CASE("Static size is propagated through adaptors") {
+    using arr = std::array<int, 4>;
+    using small_arr = std::array<int, 2>;
+    using mapped = lz::map_iterable<arr, square>;
+
+    static_assert(lz::static_size<mapped>::value == 4, "map has the static size of its input");
+    static_assert(lz::static_size<lz::map_iterable<const arr, square>>::value == 4, "map has the static size of its input");
+    static_assert(lz::static_size<lz::enumerate_iterable<mapped>>::value == 4, "enumerate has the static size of its input");
+    static_assert(lz::static_size<lz::reverse_iterable<mapped>>::value == 4, "reverse has the static size of its input");
+    static_assert(lz::static_size<lz::zip_iterable<arr, small_arr, mapped>>::value == 2, "zip has the smallest static size");
+    static_assert(!lz::has_static_size<lz::zip_iterable<arr, std::vector<int>>>::value, "vector has no static size");
+    static_assert(!lz::has_static_size<lz::map_iterable<std::vector<int>, square>>::value, "vector has no static size");
+
+    arr a = { 1, 2, 3, 4 };
+    auto squared = lz::map(a, square{});
+    static_assert(lz::static_size<decltype(squared)>::value == 4, "map has the static size of its input");
+    auto scanned = lz::inclusive_scan(squared);
+    static_assert(lz::static_size<decltype(scanned)>::value == 4, "inclusive_scan has the static size of its input");
+    REQUIRE(lz::equal(scanned, std::vector<int>{ 1, 5, 14, 30 }));
+}
+
+TEST_CASE("Static size to std::array") {
+    std::array<int, 4> a = { 1, 2, 3, 4 };
+    auto squared = lz::map(a, square{});
+
+    auto exact = squared | lz::to<std::array<int, 4>>();
+    REQUIRE(exact == std::array<int, 4>{ { 1, 4, 9, 16 } });
+
+    auto larger = lz::to<std::array<int, 6>>(squared);
+    REQUIRE(larger == std::array<int, 6>{ { 1, 4, 9, 16, 0, 0 } });
+
+    int c_array[3] = { 1, 2, 3 };
+    auto from_c_array = lz::map(c_array, square{}) | lz::to<std::array<int, 3>>();
+    REQUIRE(from_c_array == std::array<int, 3>{ { 1, 4, 9 } });
+}
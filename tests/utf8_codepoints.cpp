@@ -0,0 +1,140 @@
+#include <Lz/algorithm/empty.hpp>
+#include <Lz/algorithm/equal.hpp>
+#include <Lz/c_string.hpp>
+#include <Lz/map.hpp>
+#include <Lz/procs/to.hpp>
+#include <Lz/utf8_codepoints.hpp>
+#include <Lz/util/string_view.hpp>
+#include <cpp-lazy-ut-helper/pch.hpp>
+#include <cpp-lazy-ut-helper/ut_helper.hpp>
+#include <doctest/doctest.h>
+
+TEST_CASE("utf8_codepoints basic functionality") {
+    SUBCASE("ASCII") {
+        std::string str = "Hello";
+        lz::utf8_codepoints_iterable<const char*> codepoints = lz::utf8_codepoints(str);
+        std::u32string expected = U"Hello";
+        REQUIRE(lz::equal(codepoints, expected));
+    }
+
+    SUBCASE("Multi byte sequences") {
+        // h, e with acute, euro sign, grinning face, highest code point
+        std::string str = "h\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xF4\x8F\xBF\xBF";
+        auto codepoints = str | lz::utf8_codepoints;
+        std::vector<char32_t> expected = { 0x68, 0xE9, 0x20AC, 0x1F600, 0x10FFFF };
+        REQUIRE((codepoints | lz::to<std::vector>()) == expected);
+    }
+
+    SUBCASE("Embedded null characters") {
+        std::string str("a\0b", 3);
+        std::vector<char32_t> expected = { 0x61, 0, 0x62 };
+        REQUIRE((lz::utf8_codepoints(str) | lz::to<std::vector>()) == expected);
+    }
+
+    SUBCASE("Ill formed sequences") {
+        // Lone continuation byte, overlong encoding, surrogate, above U+10FFFF, invalid lead byte
+        std::string str = "\x80" "a" "\xC0\xAF" "b" "\xED\xA0\x80" "c" "\xF4\x90\x80\x80" "d" "\xFF";
+        std::vector<char32_t> expected = { 0xFFFD, 0x61, 0xFFFD, 0xFFFD, 0x62, 0xFFFD, 0xFFFD, 0xFFFD, 0x63,
+                                           0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0x64, 0xFFFD };
+        REQUIRE((lz::utf8_codepoints(str) | lz::to<std::vector>()) == expected);
+    }
+
+    SUBCASE("Truncated sequences") {
+        // A maximal well formed prefix is replaced by a single U+FFFD
+        std::string str = "\xE2\x82" "a" "\xF0\x9F\x98";
+        std::vector<char32_t> expected = { 0xFFFD, 0x61, 0xFFFD };
+        REQUIRE((lz::utf8_codepoints(str) | lz::to<std::vector>()) == expected);
+    }
+
+    SUBCASE("Null terminated strings") {
+        const char* str = "h\xC3\xA9\xF0\x9F\x98";
+        lz::utf8_codepoints_iterable<lz::default_sentinel_t> codepoints = lz::utf8_codepoints(str);
+        std::vector<char32_t> expected = { 0x68, 0xE9, 0xFFFD };
+        REQUIRE((codepoints | lz::to<std::vector>()) == expected);
+        REQUIRE((lz::c_string(str) | lz::utf8_codepoints | lz::to<std::vector>()) == expected);
+        REQUIRE((lz::utf8_codepoints("h\xC3\xA9\xF0\x9F\x98") | lz::to<std::vector>()) == expected);
+    }
+
+    SUBCASE("String views") {
+        lz::string_view str = "h\xC3\xA9";
+        std::vector<char32_t> expected = { 0x68, 0xE9 };
+        REQUIRE((lz::utf8_codepoints(str) | lz::to<std::vector>()) == expected);
+        expected = { 0x68, 0xFFFD };
+        REQUIRE((lz::utf8_codepoints(lz::string_view(str.data(), 2)) | lz::to<std::vector>()) == expected);
+    }
+}
+
+TEST_CASE("Empty or one element utf8_codepoints") {
+    SUBCASE("Empty") {
+        std::string str;
+        auto codepoints = lz::utf8_codepoints(str);
+        REQUIRE(lz::empty(codepoints));
+        REQUIRE(lz::empty(lz::utf8_codepoints("")));
+        REQUIRE(lz::empty(lz::utf8_codepoints_iterable<const char*>{}));
+    }
+
+    SUBCASE("One element") {
+        std::string str = "\xC3\xA9";
+        auto codepoints = lz::utf8_codepoints(str);
+        REQUIRE(!lz::empty(codepoints));
+        REQUIRE(*codepoints.begin() == 0xE9);
+        REQUIRE(std::next(codepoints.begin()) == codepoints.end());
+        auto c_codepoints = lz::utf8_codepoints("\xC3\xA9");
+        REQUIRE(*c_codepoints.begin() == 0xE9);
+        REQUIRE(std::next(c_codepoints.begin()) == c_codepoints.end());
+    }
+}
+
+TEST_CASE("utf8_codepoints binary operations") {
+    std::string str = "a\xC3\xA9z";
+    auto codepoints = lz::utf8_codepoints(str);
+
+    SUBCASE("Operator++") {
+        auto it = codepoints.begin();
+        REQUIRE(*it == U'a');
+        ++it;
+        REQUIRE(*it == 0xE9);
+        ++it;
+        REQUIRE(*it == U'z');
+        ++it;
+        REQUIRE(it == codepoints.end());
+    }
+
+    SUBCASE("Operator== and operator!=") {
+        auto it = codepoints.begin();
+        REQUIRE(it == codepoints.begin());
+        REQUIRE(it != codepoints.end());
+        auto c_codepoints = lz::utf8_codepoints("a");
+        auto c_it = c_codepoints.begin();
+        REQUIRE(c_it != c_codepoints.end());
+        ++c_it;
+        REQUIRE(c_it == c_codepoints.end());
+    }
+}
+
+TEST_CASE("utf8_codepoints to containers") {
+    std::string str = "a\xC3\xA9z";
+    auto codepoints = lz::utf8_codepoints(str);
+
+    SUBCASE("To array") {
+        std::array<char32_t, 3> expected = { U'a', 0xE9, U'z' };
+        REQUIRE((codepoints | lz::to<std::array<char32_t, 3>>()) == expected);
+    }
+
+    SUBCASE("To vector") {
+        std::vector<char32_t> expected = { U'a', 0xE9, U'z' };
+        REQUIRE((codepoints | lz::to<std::vector>()) == expected);
+    }
+
+    SUBCASE("To other container using to<>()") {
+        std::u32string expected = { U'a', 0xE9, U'z' };
+        REQUIRE((codepoints | lz::to<std::u32string>()) == expected);
+    }
+
+    SUBCASE("To map") {
+        auto map = codepoints | lz::map([](char32_t c) { return std::make_pair(c, c + 1); }) |
+                   lz::to<std::map<char32_t, char32_t>>();
+        std::map<char32_t, char32_t> expected = { { U'a', U'b' }, { 0xE9, 0xEA }, { U'z', U'{' } };
+        REQUIRE(map == expected);
+    }
+}